@@ -20,6 +20,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -270,5 +275,68 @@ Result<Datum> Quantile(const Datum& value,
                        const QuantileOptions& options = QuantileOptions::Defaults(),
                        ExecContext* ctx = NULLPTR);
 
+namespace internal {
+
+/// Internal use only: streaming group identifier.
+/// Consumes batches of keys and yields batches of the group ids.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// Construct a Grouper which receives the specified key types
+  static Result<std::unique_ptr<Grouper>> Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx = NULLPTR);
+
+  /// Consume a batch of keys, producing the corresponding group ids as a uint32 array.
+  ///
+  /// Group ids are assigned densely in order of first appearance, so that a
+  /// key which has not been seen before receives the id num_groups().
+  virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
+
+  /// Look up the group ids of a batch of keys without creating new groups.
+  ///
+  /// Rows whose key has never been consumed yield a null group id.
+  virtual Result<Datum> Lookup(const ExecBatch& batch) = 0;
+
+  /// Get current unique keys, in group id order. May be called multiple times.
+  virtual Result<ExecBatch> GetUniques() = 0;
+
+  /// Get the current number of groups.
+  virtual uint32_t num_groups() const = 0;
+};
+
+/// \brief Configure a grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  /// the name of the aggregation function
+  std::string function;
+
+  /// options for the aggregation function, or null to use the function's defaults
+  const FunctionOptions* options;
+};
+
+/// \brief Compute grouped aggregates over a set of argument and key columns
+///
+/// Each argument is aggregated by the HASH_AGGREGATE function of the
+/// corresponding Aggregate (for example "hash_sum"), for every distinct
+/// combination of the key columns. Input batches are consumed in a single pass;
+/// if ctx->use_threads() is true, they are distributed over the CPU thread pool
+/// and the resulting partial states are merged at the end.
+///
+/// \param[in] arguments the columns to aggregate, one per aggregate
+/// \param[in] keys the columns to group by
+/// \param[in] aggregates the aggregate functions to apply, one per argument
+/// \param[in] ctx the function execution context, optional
+/// \return a StructArray with one field per aggregate, followed by one field
+/// per key column, and one row per group
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates,
+                      ExecContext* ctx = NULLPTR);
+
+}  // namespace internal
+
 }  // namespace compute
 }  // namespace arrow
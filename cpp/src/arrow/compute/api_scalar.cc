@@ -140,5 +140,12 @@ Result<Datum> FillNull(const Datum& values, const Datum& fill_value, ExecContext
   return CallFunction("fill_null", {values, fill_value}, ctx);
 }
 
+// ----------------------------------------------------------------------
+// Hash functions
+
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx) {
+  return CallFunction("hash_64", values, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
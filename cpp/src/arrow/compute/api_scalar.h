@@ -22,6 +22,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/exec.h"  // IWYU pragma: keep
 #include "arrow/compute/function.h"
@@ -388,5 +389,21 @@ ARROW_EXPORT
 Result<Datum> FillNull(const Datum& values, const Datum& fill_value,
                        ExecContext* ctx = NULLPTR);
 
+/// \brief Hash64 computes a 64-bit hash of each row of `values`
+///
+/// The hashes of the values of each argument are combined, in order, into
+/// one hash per row.  Null values hash to a fixed seed, so the result is
+/// never null.  Hashes are not stable across Arrow versions.
+///
+/// \param[in] values one or more arrays of equal length, or scalars
+/// \param[in] ctx the function execution context, optional
+///
+/// \return the resulting datum, of type uint64
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Hash64(const std::vector<Datum>& values, ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
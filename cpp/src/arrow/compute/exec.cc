@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -29,7 +30,9 @@
 #include "arrow/array/data.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
@@ -40,6 +43,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -50,6 +54,8 @@
 
 namespace arrow {
 
+using internal::BinaryBitBlockCounter;
+using internal::BitBlockCount;
 using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
@@ -372,7 +378,44 @@ class NullPropagator {
     return Status::OK();
   }
 
+  Status PropagateSelected() {
+    // The array values aren't sliced to the batch, so the validity bits of
+    // the selected rows are gathered. No input bitmap can be reused as is.
+    if (!is_all_null_ && arrays_with_nulls_.empty()) {
+      output_->null_count = 0;
+      if (bitmap_preallocated_) {
+        BitUtil::SetBitsTo(bitmap_, output_->offset, output_->length, true);
+      }
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(EnsureAllocated());
+    if (is_all_null_) {
+      output_->null_count = output_->length;
+      BitUtil::SetBitsTo(bitmap_, output_->offset, output_->length, false);
+      return Status::OK();
+    }
+
+    output_->null_count = kUnknownNullCount;
+    const int32_t* indices = batch_.selection_vector->indices();
+    BitUtil::SetBitsTo(bitmap_, output_->offset, output_->length, true);
+    for (const ArrayData* arr : arrays_with_nulls_) {
+      if (arr->buffers[0] == nullptr) continue;
+      const uint8_t* arr_bitmap = arr->buffers[0]->data();
+      for (int64_t i = 0; i < output_->length; ++i) {
+        if (!BitUtil::GetBit(arr_bitmap, arr->offset + indices[i])) {
+          BitUtil::ClearBit(bitmap_, output_->offset + i);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
   Status Execute() {
+    if (batch_.selection_vector) {
+      return PropagateSelected();
+    }
+
     if (is_all_null_) {
       // An all-null value (scalar null or all-null array) gives us a short
       // circuit opportunity
@@ -522,6 +565,39 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
+  Status ExecuteSelected(const std::vector<Datum>& args, const SelectionVector& selection,
+                         ExecListener* listener) override {
+    if (output_descr_.shape == ValueDescr::SCALAR) {
+      // Only scalar arguments, whose result applies to every selected row
+      return Execute(args, listener);
+    }
+    output_length_ = selection.length();
+    output_position_ = 0;
+    RETURN_NOT_OK(SetupPreallocation(output_length_));
+
+    // Split the selection, rather than the arguments, into batches of at
+    // most exec_chunksize rows. The array arguments are passed whole.
+    const int64_t chunksize = exec_context()->exec_chunksize();
+    int64_t offset = 0;
+    do {
+      ExecBatch batch;
+      batch.values = args;
+      batch.length = std::min(chunksize, output_length_ - offset);
+      batch.selection_vector = std::make_shared<SelectionVector>(
+          selection.data()->Slice(offset, batch.length));
+      if (!kernel_->can_execute_selection) {
+        RETURN_NOT_OK(GatherSelection(&batch));
+      }
+      RETURN_NOT_OK(ExecuteBatch(batch, listener));
+      offset += batch.length;
+    } while (offset < output_length_);
+
+    if (preallocate_contiguous_) {
+      RETURN_NOT_OK(listener->OnResult(std::move(preallocated_)));
+    }
+    return Status::OK();
+  }
+
   Datum WrapResults(const std::vector<Datum>& inputs,
                     const std::vector<Datum>& outputs) override {
     if (output_descr_.shape == ValueDescr::SCALAR) {
@@ -576,6 +652,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
 
     kernel_->exec(kernel_ctx_, batch, &out);
     ARROW_CTX_RETURN_IF_ERROR(kernel_ctx_);
+    output_position_ += batch.length;
     if (!preallocate_contiguous_) {
       // If we are producing chunked output rather than one big array, then
       // emit each chunk as soon as it's available
@@ -584,8 +661,24 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
+  // Replace the array values of a batch with their selected rows, for
+  // kernels which can't evaluate a selection vector themselves
+  Status GatherSelection(ExecBatch* batch) {
+    const Datum indices(batch->selection_vector->data());
+    for (Datum& value : batch->values) {
+      if (value.is_array()) {
+        ARROW_ASSIGN_OR_RAISE(
+            value, Take(value, indices, TakeOptions::NoBoundsCheck(), exec_context()));
+      }
+    }
+    batch->selection_vector.reset();
+    return Status::OK();
+  }
+
   Status PrepareExecute(const std::vector<Datum>& args) {
     RETURN_NOT_OK(this->SetupArgIteration(args));
+    output_length_ = batch_iterator_->length();
+    output_position_ = 0;
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // If the executor is configured to produce a single large Array output for
@@ -615,12 +708,10 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       if (preallocate_contiguous_) {
         // The output is already fully preallocated
-        const int64_t batch_start_position = batch_iterator_->position() - batch.length;
-
-        if (batch.length < batch_iterator_->length()) {
+        if (batch.length < output_length_) {
           // If this is a partial execution, then we write into a slice of
           // preallocated_
-          out->value = preallocated_->Slice(batch_start_position, batch.length);
+          out->value = preallocated_->Slice(output_position_, batch.length);
         } else {
           // Otherwise write directly into preallocated_. The main difference
           // computationally (versus the Slice approach) is that the null_count
@@ -650,6 +741,8 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
          kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL &&
          output_descr_.type->id() != Type::NA);
+    // The executor may be run several times after Init()
+    data_preallocated_.clear();
     if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
       ComputeDataPreallocate(*output_descr_.type, &data_preallocated_);
     }
@@ -680,6 +773,10 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
 
   // For storing a contiguous preallocation per above. Unused otherwise
   std::shared_ptr<ArrayData> preallocated_;
+
+  // The length of the whole output, and the position of the next batch in it
+  int64_t output_length_ = 0;
+  int64_t output_position_ = 0;
 };
 
 Status PackBatchNoChunks(const std::vector<Datum>& args, ExecBatch* out) {
@@ -792,6 +889,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     validity_preallocated_ =
         (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
          kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
+    data_preallocated_.clear();
     if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
       ComputeDataPreallocate(*output_descr_.type, &data_preallocated_);
     }
@@ -928,9 +1026,69 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
+namespace {
+
+// Collect selected_indices[i] (or i if null) for the true, non-null values of
+// the mask
+Result<std::shared_ptr<SelectionVector>> SelectFromMask(const ArrayData& mask,
+                                                        const int32_t* selected_indices,
+                                                        MemoryPool* pool) {
+  if (mask.length > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Selection vectors are limited to 2^31 - 1 rows");
+  }
+  const uint8_t* values = mask.buffers[1]->data();
+  const uint8_t* validity = mask.MayHaveNulls() ? mask.buffers[0]->data() : nullptr;
+
+  TypedBufferBuilder<int32_t> builder(pool);
+  RETURN_NOT_OK(builder.Reserve(mask.length));
+  auto append = [&](int64_t position) {
+    builder.UnsafeAppend(selected_indices == nullptr
+                             ? static_cast<int32_t>(position)
+                             : selected_indices[position]);
+  };
+  BinaryBitBlockCounter counter(values, mask.offset,
+                                validity == nullptr ? values : validity, mask.offset,
+                                mask.length);
+  int64_t position = 0;
+  while (position < mask.length) {
+    const BitBlockCount block = counter.NextAndWord();
+    if (block.AllSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        append(position + i);
+      }
+    } else if (!block.NoneSet()) {
+      for (int64_t i = 0; i < block.length; ++i) {
+        const int64_t bit = mask.offset + position + i;
+        if (BitUtil::GetBit(values, bit) &&
+            (validity == nullptr || BitUtil::GetBit(validity, bit))) {
+          append(position + i);
+        }
+      }
+    }
+    position += block.length;
+  }
+
+  const int64_t length = builder.length();
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(builder.Finish(&indices));
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), length, {nullptr, std::move(indices)}, /*null_count=*/0));
+}
+
+}  // namespace
+
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  return SelectFromMask(*arr.data(), /*selected_indices=*/nullptr, pool);
+}
+
+Result<std::shared_ptr<SelectionVector>> SelectionVector::Filter(
+    const BooleanArray& mask, MemoryPool* pool) const {
+  if (mask.length() != length()) {
+    return Status::Invalid("Mask has length ", mask.length(),
+                           ", expected the length of the selection: ", length());
+  }
+  return SelectFromMask(*mask.data(), indices_, pool);
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -949,5 +1107,17 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
+                           const SelectionVector& selection,
+                           const FunctionOptions* options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return CallFunction(func_name, args, selection, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  return func->ExecuteSelected(args, selection, options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -131,7 +131,8 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Scalar functions can be evaluated on the selected rows only, see the
+/// CallFunction overload taking a SelectionVector.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,8 +142,21 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// The indices of the true values are selected; null values are not.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
+  /// \brief Keep only the selected indices for which `mask` is true
+  ///
+  /// The mask has one value per selected index, such as the result of a
+  /// predicate evaluated with this selection vector. Null values are not
+  /// selected. This lets predicates be chained without materializing the
+  /// rows that passed the previous ones.
+  Result<std::shared_ptr<SelectionVector>> Filter(
+      const BooleanArray& mask, MemoryPool* pool = default_memory_pool()) const;
+
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
@@ -230,6 +244,20 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief One-shot invoker for a function evaluated on the rows selected by
+/// a SelectionVector.
+///
+/// The result is the same as calling the function on the arguments filtered
+/// by the selection, with one value per selected index. Scalar arguments
+/// apply to every selected row. Kernels which support it (most arithmetic,
+/// comparison, boolean and string kernels) read the selected rows in place,
+/// so the filtered arguments are never materialized; for other functions the
+/// selected rows are gathered first.
+ARROW_EXPORT
+Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
+                           const SelectionVector& selection,
+                           const FunctionOptions* options, ExecContext* ctx = NULLPTR);
+
 /// @}
 
 }  // namespace compute
@@ -112,6 +112,15 @@ class ARROW_EXPORT KernelExecutor {
   /// Not thread-safe
   virtual Status Execute(const std::vector<Datum>& args, ExecListener* listener) = 0;
 
+  /// \brief Execute on the rows of args selected by `selection`. The args
+  /// must be arrays or scalars, and array indices must have been
+  /// bounds-checked. Only implemented by the scalar executor.
+  virtual Status ExecuteSelected(const std::vector<Datum>& args,
+                                 const SelectionVector& selection,
+                                 ExecListener* listener) {
+    return Status::NotImplemented("Execution with a selection vector");
+  }
+
   virtual Datum WrapResults(const std::vector<Datum>& args,
                             const std::vector<Datum>& outputs) = 0;
 
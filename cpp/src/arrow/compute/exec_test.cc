@@ -84,6 +84,46 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true, false]");
+  const auto& bools = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bools));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+
+  auto sliced = mask->Slice(1, 4);
+  ASSERT_OK_AND_ASSIGN(
+      sel_vector, SelectionVector::FromMask(checked_cast<const BooleanArray&>(*sliced)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 3]"), *MakeArray(sel_vector->data()));
+
+  // Longer masks go through the block counter
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto long_mask = rand.Boolean(1000, /*true_probability=*/0.5, /*null_probability=*/0.1);
+  std::vector<int32_t> expected_indices;
+  const auto& long_bools = checked_cast<const BooleanArray&>(*long_mask);
+  for (int32_t i = 0; i < 1000; ++i) {
+    if (long_bools.IsValid(i) && long_bools.Value(i)) {
+      expected_indices.push_back(i);
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(long_bools));
+  ASSERT_EQ(static_cast<int32_t>(expected_indices.size()), sel_vector->length());
+  for (int32_t i = 0; i < sel_vector->length(); ++i) {
+    ASSERT_EQ(expected_indices[i], sel_vector->indices()[i]);
+  }
+}
+
+TEST(SelectionVector, Filter) {
+  SelectionVector sel_vector(*ArrayFromJSON(int32(), "[0, 3, 4, 7]"));
+  auto mask = ArrayFromJSON(boolean(), "[false, true, null, true]");
+  ASSERT_OK_AND_ASSIGN(auto filtered,
+                       sel_vector.Filter(checked_cast<const BooleanArray&>(*mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 7]"), *MakeArray(filtered->data()));
+
+  auto wrong_length = ArrayFromJSON(boolean(), "[true]");
+  ASSERT_RAISES(Invalid,
+                sel_vector.Filter(checked_cast<const BooleanArray&>(*wrong_length)));
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -0,0 +1,619 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/external_sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::PlatformFilename;
+using internal::TemporaryDir;
+
+namespace compute {
+
+namespace {
+
+// The size of the buffers referenced by an array. Buffers shared between
+// arrays, e.g. slices of a larger batch, are counted several times.
+int64_t BufferedSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferedSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += BufferedSize(*data.dictionary);
+  }
+  return size;
+}
+
+int64_t BufferedSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferedSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+// ----------------------------------------------------------------------
+// Row comparison across batches, for merging sorted runs
+
+// Compares two non-null values of the same physical type. NaNs compare
+// greater than any other value, regardless of the sort order.
+template <typename Type, typename Enable = void>
+struct ValueComparator {
+  template <typename Value>
+  static int Compare(const Value& left, const Value& right, SortOrder order) {
+    const int compared = left < right ? -1 : (right < left ? 1 : 0);
+    return order == SortOrder::Descending ? -compared : compared;
+  }
+};
+
+template <typename Type>
+struct ValueComparator<Type, enable_if_floating_point<Type>> {
+  template <typename Value>
+  static int Compare(const Value& left, const Value& right, SortOrder order) {
+    const bool left_nan = std::isnan(left);
+    const bool right_nan = std::isnan(right);
+    if (left_nan || right_nan) {
+      return left_nan - right_nan;
+    }
+    const int compared = left < right ? -1 : (right < left ? 1 : 0);
+    return order == SortOrder::Descending ? -compared : compared;
+  }
+};
+
+// Compares the values at `i` in `left` and at `j` in `right`. Nulls compare
+// greater than any other value, regardless of the sort order.
+template <typename Type>
+int CompareKeyValues(const Array& left, int64_t i, const Array& right, int64_t j,
+                     SortOrder order) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  const bool left_null = left.IsNull(i);
+  const bool right_null = right.IsNull(j);
+  if (left_null || right_null) {
+    return left_null - right_null;
+  }
+  return ValueComparator<Type>::Compare(checked_cast<const ArrayType&>(left).GetView(i),
+                                        checked_cast<const ArrayType&>(right).GetView(j),
+                                        order);
+}
+
+// Compares rows of record batches of a given schema on the sort keys
+class RowComparator {
+ public:
+  using CompareFunc = int (*)(const Array&, int64_t, const Array&, int64_t, SortOrder);
+
+  static Result<RowComparator> Make(const Schema& schema, const SortOptions& options) {
+    if (options.sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    RowComparator comparator;
+    for (const auto& sort_key : options.sort_keys) {
+      const int field_index = schema.GetFieldIndex(sort_key.name);
+      if (field_index < 0) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+      }
+      ResolvedKey key;
+      key.field_index = field_index;
+      key.physical_type = GetPhysicalType(schema.field(field_index)->type());
+      key.order = sort_key.order;
+      CompareFuncVisitor visitor;
+      RETURN_NOT_OK(VisitTypeInline(*key.physical_type, &visitor));
+      key.compare = visitor.compare;
+      comparator.keys_.push_back(std::move(key));
+    }
+    return comparator;
+  }
+
+  // The sort key columns of `batch`, as arrays of the physical types
+  ArrayVector KeyColumns(const RecordBatch& batch) const {
+    ArrayVector columns;
+    for (const auto& key : keys_) {
+      auto data = batch.column_data(key.field_index)->Copy();
+      data->type = key.physical_type;
+      columns.push_back(MakeArray(std::move(data)));
+    }
+    return columns;
+  }
+
+  int Compare(const ArrayVector& left, int64_t i, const ArrayVector& right,
+              int64_t j) const {
+    for (size_t k = 0; k < keys_.size(); ++k) {
+      const int compared = keys_[k].compare(*left[k], i, *right[k], j, keys_[k].order);
+      if (compared != 0) {
+        return compared;
+      }
+    }
+    return 0;
+  }
+
+ private:
+  struct ResolvedKey {
+    int field_index;
+    std::shared_ptr<DataType> physical_type;
+    SortOrder order;
+    CompareFunc compare;
+  };
+
+  struct CompareFuncVisitor {
+#define VISIT(TYPE)                  \
+  Status Visit(const TYPE&) {        \
+    compare = CompareKeyValues<TYPE>; \
+    return Status::OK();             \
+  }
+
+    VISIT(Int8Type)
+    VISIT(Int16Type)
+    VISIT(Int32Type)
+    VISIT(Int64Type)
+    VISIT(UInt8Type)
+    VISIT(UInt16Type)
+    VISIT(UInt32Type)
+    VISIT(UInt64Type)
+    VISIT(FloatType)
+    VISIT(DoubleType)
+    VISIT(BinaryType)
+    VISIT(LargeBinaryType)
+
+#undef VISIT
+
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Unsupported type for external sorting: ",
+                               type.ToString());
+    }
+
+    CompareFunc compare = NULLPTR;
+  };
+
+  std::vector<ResolvedKey> keys_;
+};
+
+// ----------------------------------------------------------------------
+// Sources of sorted batches
+
+// Yields the rows of an in-memory batch in the order of `indices`
+class SortedBatchReader : public RecordBatchReader {
+ public:
+  SortedBatchReader(std::shared_ptr<RecordBatch> batch, std::shared_ptr<Array> indices,
+                    int64_t batch_size, ExecContext* ctx)
+      : batch_(std::move(batch)),
+        indices_(std::move(indices)),
+        batch_size_(batch_size),
+        ctx_(ctx) {}
+
+  // Sort `batches`, which are released in the process
+  static Result<std::shared_ptr<SortedBatchReader>> Make(
+      const std::shared_ptr<Schema>& schema, RecordBatchVector* batches,
+      const ExternalSortOptions& options, ExecContext* ctx) {
+    // Take is much faster from contiguous arrays, so concatenate the batches
+    // first, at the expense of holding the input twice for a moment.
+    ArrayVector columns(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      ArrayVector chunks;
+      for (const auto& batch : *batches) {
+        chunks.push_back(batch->column(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, ctx->memory_pool()));
+    }
+    int64_t num_rows = 0;
+    for (const auto& batch : *batches) {
+      num_rows += batch->num_rows();
+    }
+    batches->clear();
+
+    auto batch = RecordBatch::Make(schema, num_rows, std::move(columns));
+    ARROW_ASSIGN_OR_RAISE(auto indices,
+                          SortIndices(Datum(batch), options.sort_options, ctx));
+    return std::make_shared<SortedBatchReader>(std::move(batch), std::move(indices),
+                                               options.batch_size, ctx);
+  }
+
+  std::shared_ptr<Schema> schema() const override { return batch_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (offset_ >= indices_->length()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    const int64_t length = std::min(batch_size_, indices_->length() - offset_);
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          Take(Datum(batch_), Datum(indices_->Slice(offset_, length)),
+                               TakeOptions::NoBoundsCheck(), ctx_));
+    offset_ += length;
+    *out = taken.record_batch();
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatch> batch_;
+  std::shared_ptr<Array> indices_;
+  const int64_t batch_size_;
+  ExecContext* ctx_;
+  int64_t offset_ = 0;
+};
+
+// Yields the batches of a run spilled to an IPC file
+class SpilledRunReader : public RecordBatchReader {
+ public:
+  static Result<std::shared_ptr<SpilledRunReader>> Open(const PlatformFilename& path,
+                                                        MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(path.ToString(), pool));
+    auto read_options = ipc::IpcReadOptions::Defaults();
+    read_options.memory_pool = pool;
+    auto reader = std::make_shared<SpilledRunReader>();
+    ARROW_ASSIGN_OR_RAISE(
+        reader->reader_, ipc::RecordBatchFileReader::Open(std::move(file), read_options));
+    return reader;
+  }
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (next_batch_ >= reader_->num_record_batches()) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    return reader_->ReadRecordBatch(next_batch_++).Value(out);
+  }
+
+ private:
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int next_batch_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// K-way merging of sorted runs
+
+class MergingReader : public RecordBatchReader {
+ public:
+  MergingReader(std::shared_ptr<Schema> schema, RowComparator comparator,
+                std::vector<std::shared_ptr<RecordBatchReader>> runs, int64_t batch_size,
+                MemoryPool* pool)
+      : schema_(std::move(schema)),
+        comparator_(std::move(comparator)),
+        runs_(std::move(runs)),
+        batch_size_(batch_size),
+        pool_(pool) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (cursors_.empty()) {
+      RETURN_NOT_OK(Init());
+    }
+    RecordBatchVector slices;
+    int64_t num_rows = 0;
+    while (!heap_.empty() && num_rows < batch_size_) {
+      std::pop_heap(heap_.begin(), heap_.end(), heap_order_);
+      Cursor* cursor = &cursors_[heap_.back()];
+      heap_.pop_back();
+
+      // Emit the rows of the smallest run for as long as they precede the
+      // current row of every other run
+      const int64_t start = cursor->row;
+      const int64_t end =
+          std::min(cursor->batch->num_rows(), start + batch_size_ - num_rows);
+      do {
+        ++cursor->row;
+      } while (cursor->row < end &&
+               (heap_.empty() || Precedes(*cursor, cursors_[heap_.front()])));
+      slices.push_back(cursor->batch->Slice(start, cursor->row - start));
+      num_rows += cursor->row - start;
+
+      if (cursor->row == cursor->batch->num_rows()) {
+        RETURN_NOT_OK(Advance(cursor));
+      }
+      if (cursor->batch != nullptr) {
+        heap_.push_back(cursor->run);
+        std::push_heap(heap_.begin(), heap_.end(), heap_order_);
+      }
+    }
+    if (num_rows == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    if (slices.size() == 1) {
+      *out = std::move(slices[0]);
+      return Status::OK();
+    }
+    ArrayVector columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ArrayVector chunks;
+      for (const auto& slice : slices) {
+        chunks.push_back(slice->column(i));
+      }
+      ARROW_ASSIGN_OR_RAISE(columns[i], Concatenate(chunks, pool_));
+    }
+    *out = RecordBatch::Make(schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  // The current batch of a run, and the position in that batch
+  struct Cursor {
+    int run;
+    std::shared_ptr<RecordBatch> batch;
+    ArrayVector keys;
+    int64_t row;
+  };
+
+  // Whether the current row of `left` sorts before the current row of
+  // `right`. Ties are broken by run, which makes the merge stable.
+  bool Precedes(const Cursor& left, const Cursor& right) const {
+    const int compared =
+        comparator_.Compare(left.keys, left.row, right.keys, right.row);
+    return compared < 0 || (compared == 0 && left.run < right.run);
+  }
+
+  // Load the next non-empty batch of the cursor's run, or null at the end
+  Status Advance(Cursor* cursor) {
+    do {
+      RETURN_NOT_OK(runs_[cursor->run]->ReadNext(&cursor->batch));
+    } while (cursor->batch != nullptr && cursor->batch->num_rows() == 0);
+    cursor->row = 0;
+    if (cursor->batch != nullptr) {
+      cursor->keys = comparator_.KeyColumns(*cursor->batch);
+    } else {
+      cursor->keys.clear();
+      // Release the run (and its file) as soon as it's exhausted
+      runs_[cursor->run].reset();
+    }
+    return Status::OK();
+  }
+
+  Status Init() {
+    cursors_.resize(runs_.size());
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      cursors_[i].run = static_cast<int>(i);
+      RETURN_NOT_OK(Advance(&cursors_[i]));
+      if (cursors_[i].batch != nullptr) {
+        heap_.push_back(static_cast<int>(i));
+      }
+    }
+    // std::*_heap functions build max-heaps, hence the reversed order
+    heap_order_ = HeapOrder{this};
+    std::make_heap(heap_.begin(), heap_.end(), heap_order_);
+    return Status::OK();
+  }
+
+  struct HeapOrder {
+    const MergingReader* self;
+
+    bool operator()(int left, int right) const {
+      return self->Precedes(self->cursors_[right], self->cursors_[left]);
+    }
+  };
+
+  std::shared_ptr<Schema> schema_;
+  RowComparator comparator_;
+  std::vector<std::shared_ptr<RecordBatchReader>> runs_;
+  const int64_t batch_size_;
+  MemoryPool* pool_;
+  std::vector<Cursor> cursors_;
+  std::vector<int> heap_;
+  HeapOrder heap_order_{NULLPTR};
+};
+
+// The result of ExternalSort, when runs were spilled: keeps the spill
+// directory alive until the merge is done
+class SpillingSortReader : public RecordBatchReader {
+ public:
+  SpillingSortReader(std::unique_ptr<TemporaryDir> spill_dir,
+                     std::shared_ptr<RecordBatchReader> merged)
+      : spill_dir_(std::move(spill_dir)), merged_(std::move(merged)) {}
+
+  std::shared_ptr<Schema> schema() const override { return merged_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    return merged_->ReadNext(out);
+  }
+
+ private:
+  // Declared first, so that it is deleted after the spilled files are closed
+  std::unique_ptr<TemporaryDir> spill_dir_;
+  std::shared_ptr<RecordBatchReader> merged_;
+};
+
+// ----------------------------------------------------------------------
+// Splitting the input into sorted runs
+
+class ExternalSorter {
+ public:
+  ExternalSorter(std::shared_ptr<RecordBatchReader> input,
+                 const ExternalSortOptions& options, RowComparator comparator,
+                 ExecContext* ctx)
+      : input_(std::move(input)),
+        schema_(input_->schema()),
+        options_(options),
+        comparator_(std::move(comparator)),
+        ctx_(ctx) {}
+
+  Result<std::shared_ptr<RecordBatchReader>> Sort() {
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(input_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      buffered_size_ += BufferedSize(*batch);
+      buffered_.push_back(std::move(batch));
+      if (buffered_size_ >= options_.memory_limit) {
+        ARROW_ASSIGN_OR_RAISE(auto run, SortBuffered());
+        ARROW_ASSIGN_OR_RAISE(auto path, Spill(run.get()));
+        spilled_.push_back(std::move(path));
+      }
+    }
+    input_.reset();
+
+    // The last run is merged straight from memory
+    std::shared_ptr<RecordBatchReader> last_run;
+    if (!buffered_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(last_run, SortBuffered());
+    }
+    if (spilled_.empty()) {
+      if (last_run == nullptr) {
+        return RecordBatchReader::Make({}, schema_);
+      }
+      return last_run;
+    }
+
+    const size_t max_spilled =
+        static_cast<size_t>(options_.max_merge_width) - (last_run != nullptr ? 1 : 0);
+    while (spilled_.size() > max_spilled) {
+      RETURN_NOT_OK(MergeSpilledRuns());
+    }
+    std::vector<std::shared_ptr<RecordBatchReader>> runs;
+    for (const auto& path : spilled_) {
+      ARROW_ASSIGN_OR_RAISE(auto run, SpilledRunReader::Open(path, ctx_->memory_pool()));
+      runs.push_back(std::move(run));
+    }
+    if (last_run != nullptr) {
+      runs.push_back(std::move(last_run));
+    }
+    auto merged = std::make_shared<MergingReader>(schema_, comparator_, std::move(runs),
+                                                  options_.batch_size,
+                                                  ctx_->memory_pool());
+    return std::make_shared<SpillingSortReader>(std::move(spill_dir_), std::move(merged));
+  }
+
+ private:
+  Result<std::shared_ptr<RecordBatchReader>> SortBuffered() {
+    buffered_size_ = 0;
+    return SortedBatchReader::Make(schema_, &buffered_, options_, ctx_);
+  }
+
+  // Write the batches of `run` into a new file of the spill directory
+  Result<PlatformFilename> Spill(RecordBatchReader* run) {
+    if (spill_dir_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(spill_dir_, TemporaryDir::Make("arrow-sort-"));
+    }
+    const std::string file_name = "run-" + std::to_string(num_runs_++) + ".arrow";
+    ARROW_ASSIGN_OR_RAISE(auto path, spill_dir_->path().Join(file_name));
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::FileOutputStream::Open(path.ToString()));
+    auto write_options = ipc::IpcWriteOptions::Defaults();
+    write_options.memory_pool = ctx_->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(sink, schema_, write_options));
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(run->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    RETURN_NOT_OK(sink->Close());
+    return path;
+  }
+
+  // Merge groups of max_merge_width consecutive spilled runs. Only
+  // consecutive runs are merged, which keeps the sort stable.
+  Status MergeSpilledRuns() {
+    std::vector<PlatformFilename> merged;
+    const size_t width = static_cast<size_t>(options_.max_merge_width);
+    for (size_t begin = 0; begin < spilled_.size(); begin += width) {
+      const size_t end = std::min(spilled_.size(), begin + width);
+      if (end - begin == 1) {
+        merged.push_back(spilled_[begin]);
+        continue;
+      }
+      std::vector<std::shared_ptr<RecordBatchReader>> runs;
+      for (size_t i = begin; i < end; ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto run,
+                              SpilledRunReader::Open(spilled_[i], ctx_->memory_pool()));
+        runs.push_back(std::move(run));
+      }
+      MergingReader merging(schema_, comparator_, std::move(runs), options_.batch_size,
+                            ctx_->memory_pool());
+      ARROW_ASSIGN_OR_RAISE(auto path, Spill(&merging));
+      merged.push_back(std::move(path));
+      for (size_t i = begin; i < end; ++i) {
+        RETURN_NOT_OK(::arrow::internal::DeleteFile(spilled_[i]).status());
+      }
+    }
+    spilled_ = std::move(merged);
+    return Status::OK();
+  }
+
+  std::shared_ptr<RecordBatchReader> input_;
+  std::shared_ptr<Schema> schema_;
+  const ExternalSortOptions& options_;
+  RowComparator comparator_;
+  ExecContext* ctx_;
+
+  RecordBatchVector buffered_;
+  int64_t buffered_size_ = 0;
+  std::unique_ptr<TemporaryDir> spill_dir_;
+  std::vector<PlatformFilename> spilled_;
+  int num_runs_ = 0;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> ExternalSort(
+    std::shared_ptr<RecordBatchReader> input, const ExternalSortOptions& options,
+    ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  if (options.memory_limit <= 0) {
+    return Status::Invalid("ExternalSort memory_limit must be positive");
+  }
+  if (options.batch_size <= 0) {
+    return Status::Invalid("ExternalSort batch_size must be positive");
+  }
+  if (options.max_merge_width < 2) {
+    return Status::Invalid("ExternalSort max_merge_width must be at least 2");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto comparator,
+                        RowComparator::Make(*input->schema(), options.sort_options));
+  ExternalSorter sorter(std::move(input), options, std::move(comparator), ctx);
+  return sorter.Sort();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class ExecContext;
+
+/// \brief Options for ExternalSort
+struct ARROW_EXPORT ExternalSortOptions {
+  ExternalSortOptions() = default;
+  explicit ExternalSortOptions(SortOptions sort_options)
+      : sort_options(std::move(sort_options)) {}
+
+  static ExternalSortOptions Defaults() { return ExternalSortOptions{}; }
+
+  /// The sort keys, as for SortIndices
+  SortOptions sort_options;
+
+  /// The size, in bytes, of the input buffered in memory before it is sorted
+  /// and spilled to disk as a run
+  int64_t memory_limit = int64_t(256) << 20;
+
+  /// The maximum number of rows of the spilled and output batches
+  int64_t batch_size = int64_t(1) << 16;
+
+  /// The maximum number of runs merged at once. If more runs are spilled,
+  /// they are first merged into longer runs, which bounds the number of
+  /// files opened and of batches held in memory while merging.
+  int max_merge_width = 64;
+};
+
+/// \brief Sort a stream of record batches which may not fit in memory
+///
+/// Input batches are buffered until they reach options.memory_limit bytes;
+/// the buffered rows are then sorted and spilled as an Arrow IPC file into
+/// a temporary directory created in the platform temporary directory (see
+/// the TMPDIR environment variable). The sorted runs are finally merged
+/// into the returned reader, which removes the spilled files once destroyed.
+/// If the whole input fits within the memory limit, nothing is spilled.
+///
+/// Sorting follows the semantics of SortIndices: nulls and NaNs sort last
+/// regardless of order, and the sort is stable. Temporary allocations are
+/// made from ctx->memory_pool().
+///
+/// \param[in] input the batches to sort
+/// \param[in] options the sort keys and memory limit
+/// \param[in] ctx the execution context, optional
+/// \return a reader of the sorted batches
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> ExternalSort(
+    std::shared_ptr<RecordBatchReader> input, const ExternalSortOptions& options,
+    ExecContext* ctx = NULLPTR);
+
+}  // namespace compute
+}  // namespace arrow
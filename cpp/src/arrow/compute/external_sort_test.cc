@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/external_sort.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+class TestExternalSort : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("i", int16()), field("d", float64()), field("s", utf8())});
+    random::RandomArrayGenerator rand(0x5EED);
+    const int64_t batch_length = 1000;
+    for (int i = 0; i < 20; ++i) {
+      // Few distinct integers, so that the other keys break ties
+      batches_.push_back(RecordBatch::Make(
+          schema_, batch_length,
+          {rand.Int16(batch_length, -10, 10, /*null_probability=*/0.1),
+           rand.Float64(batch_length, -1, 1, /*null_probability=*/0.1,
+                        /*nan_probability=*/0.1),
+           rand.String(batch_length, 0, 2, /*null_probability=*/0.1)}));
+    }
+    sort_options_ = SortOptions({SortKey("i", SortOrder::Descending),
+                                 SortKey("s", SortOrder::Ascending),
+                                 SortKey("d", SortOrder::Descending)});
+  }
+
+  void AssertSorted(const ExternalSortOptions& options) {
+    ASSERT_OK_AND_ASSIGN(auto input, RecordBatchReader::Make(batches_, schema_));
+    ASSERT_OK_AND_ASSIGN(auto reader, ExternalSort(input, options));
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatchReader(reader.get()));
+    ASSERT_OK(actual->ValidateFull());
+    for (const auto& column : actual->columns()) {
+      for (const auto& chunk : column->chunks()) {
+        ASSERT_LE(chunk->length(), options.batch_size);
+      }
+    }
+
+    // Sorting is stable, so the result must be the same as an in-memory sort
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema_, batches_));
+    ASSERT_EQ(actual->num_rows(), table->num_rows());
+    if (table->num_rows() == 0) {
+      return;
+    }
+    ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(Datum(table), sort_options_));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(Datum(table), Datum(indices)));
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      ASSERT_OK_AND_ASSIGN(auto expected_column,
+                           Concatenate(expected.table()->column(i)->chunks()));
+      ASSERT_OK_AND_ASSIGN(auto actual_column, Concatenate(actual->column(i)->chunks()));
+      AssertArraysApproxEqual(*expected_column, *actual_column, /*verbose=*/false,
+                              EqualOptions::Defaults().nans_equal(true));
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  SortOptions sort_options_;
+};
+
+TEST_F(TestExternalSort, InMemory) {
+  ExternalSortOptions options(sort_options_);
+  AssertSorted(options);
+  options.batch_size = 777;
+  AssertSorted(options);
+}
+
+TEST_F(TestExternalSort, Spill) {
+  ExternalSortOptions options(sort_options_);
+  // A few input batches per run
+  options.memory_limit = 3 * 1000 * 16;
+  options.batch_size = 500;
+  AssertSorted(options);
+}
+
+TEST_F(TestExternalSort, MultiPassMerge) {
+  ExternalSortOptions options(sort_options_);
+  // One run per input batch
+  options.memory_limit = 1;
+  options.batch_size = 300;
+  options.max_merge_width = 3;
+  AssertSorted(options);
+  options.max_merge_width = 2;
+  AssertSorted(options);
+}
+
+TEST_F(TestExternalSort, EmptyInput) {
+  batches_.clear();
+  ExternalSortOptions options(sort_options_);
+  AssertSorted(options);
+  options.memory_limit = 1;
+  AssertSorted(options);
+}
+
+TEST_F(TestExternalSort, Invalid) {
+  ASSERT_OK_AND_ASSIGN(auto input, RecordBatchReader::Make(batches_, schema_));
+  ExternalSortOptions options(sort_options_);
+  options.max_merge_width = 1;
+  ASSERT_RAISES(Invalid, ExternalSort(input, options));
+
+  ASSERT_RAISES(Invalid, ExternalSort(input, ExternalSortOptions::Defaults()));
+  options = ExternalSortOptions(SortOptions({SortKey("x")}));
+  ASSERT_RAISES(Invalid, ExternalSort(input, options));
+
+  auto struct_schema = schema({field("a", struct_({field("b", int32())}))});
+  ASSERT_OK_AND_ASSIGN(input, RecordBatchReader::Make({}, struct_schema));
+  options = ExternalSortOptions(SortOptions({SortKey("a")}));
+  ASSERT_RAISES(TypeError, ExternalSort(input, options));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -21,6 +21,7 @@
 #include <memory>
 #include <sstream>
 
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/datum.h"
@@ -107,24 +108,20 @@ Result<const KernelType*> DispatchExactImpl(const Function& func,
                                 FormatArgTypes(values));
 }
 
-Result<Datum> Function::Execute(const std::vector<Datum>& args,
-                                const FunctionOptions* options, ExecContext* ctx) const {
-  if (options == nullptr) {
-    options = default_options();
-  }
-  if (ctx == nullptr) {
-    ExecContext default_ctx;
-    return Execute(args, options, &default_ctx);
+namespace {
+
+Result<Datum> ExecuteKernel(const Function& func, const std::vector<Datum>& args,
+                            const SelectionVector* selection,
+                            const FunctionOptions* options, ExecContext* ctx) {
+  if (func.kind() == Function::HASH_AGGREGATE) {
+    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
-  // type-check Datum arguments here. Really we'd like to avoid this as much as
-  // possible
-  RETURN_NOT_OK(detail::CheckAllValues(args));
   std::vector<ValueDescr> inputs(args.size());
   for (size_t i = 0; i != args.size(); ++i) {
     inputs[i] = args[i].descr();
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchExact(inputs));
+  ARROW_ASSIGN_OR_RAISE(auto kernel, func.DispatchExact(inputs));
   std::unique_ptr<KernelState> state;
 
   KernelContext kernel_ctx{ctx};
@@ -135,9 +132,9 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   }
 
   std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
+  if (func.kind() == Function::SCALAR) {
     executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
+  } else if (func.kind() == Function::VECTOR) {
     executor = detail::KernelExecutor::MakeVector();
   } else {
     executor = detail::KernelExecutor::MakeScalarAggregate();
@@ -145,10 +142,81 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   RETURN_NOT_OK(executor->Init(&kernel_ctx, {kernel, inputs, options}));
 
   auto listener = std::make_shared<detail::DatumAccumulator>();
-  RETURN_NOT_OK(executor->Execute(args, listener.get()));
+  if (selection != nullptr) {
+    RETURN_NOT_OK(executor->ExecuteSelected(args, *selection, listener.get()));
+  } else {
+    RETURN_NOT_OK(executor->Execute(args, listener.get()));
+  }
   return executor->WrapResults(args, listener->values());
 }
 
+}  // namespace
+
+Result<Datum> Function::Execute(const std::vector<Datum>& args,
+                                const FunctionOptions* options, ExecContext* ctx) const {
+  if (options == nullptr) {
+    options = default_options();
+  }
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return Execute(args, options, &default_ctx);
+  }
+  // type-check Datum arguments here. Really we'd like to avoid this as much as
+  // possible
+  RETURN_NOT_OK(detail::CheckAllValues(args));
+  return ExecuteKernel(*this, args, /*selection=*/nullptr, options, ctx);
+}
+
+Result<Datum> Function::ExecuteSelected(const std::vector<Datum>& args,
+                                        const SelectionVector& selection,
+                                        const FunctionOptions* options,
+                                        ExecContext* ctx) const {
+  if (options == nullptr) {
+    options = default_options();
+  }
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return ExecuteSelected(args, selection, options, &default_ctx);
+  }
+  RETURN_NOT_OK(detail::CheckAllValues(args));
+
+  // Kernels don't check the selected indices, so do it once here
+  int64_t length = -1;
+  bool have_chunked_array = false;
+  for (const Datum& arg : args) {
+    if (arg.is_scalar()) continue;
+    if (length >= 0 && arg.length() != length) {
+      return Status::Invalid("Array arguments must all be the same length");
+    }
+    length = arg.length();
+    have_chunked_array |= arg.kind() == Datum::CHUNKED_ARRAY;
+  }
+  if (length >= 0) {
+    const int32_t* indices = selection.indices();
+    for (int32_t i = 0; i < selection.length(); ++i) {
+      if (indices[i] < 0 || indices[i] >= length) {
+        return Status::IndexError("Selection index ", indices[i],
+                                  " out of bounds for arguments of length ", length);
+      }
+    }
+  }
+
+  if (kind() == Function::SCALAR && !have_chunked_array) {
+    return ExecuteKernel(*this, args, &selection, options, ctx);
+  }
+
+  // Other functions (and chunked arguments, which the selection indices
+  // don't address directly) are given the selected rows
+  std::vector<Datum> selected_args = args;
+  const Datum indices(selection.data());
+  for (Datum& arg : selected_args) {
+    if (!arg.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(arg, Take(arg, indices, TakeOptions::NoBoundsCheck(), ctx));
+    }
+  }
+  return Execute(selected_args, options, ctx);
+}
+
 Status Function::Validate() const {
   if (!doc_->summary.empty()) {
     // Documentation given, check its contents
@@ -233,6 +301,20 @@ Result<const Kernel*> ScalarAggregateFunction::DispatchExact(
   return DispatchExactImpl(*this, kernels_, values);
 }
 
+Status HashAggregateFunction::AddKernel(HashAggregateKernel kernel) {
+  RETURN_NOT_OK(CheckArity(static_cast<int>(kernel.signature->in_types().size())));
+  if (arity_.is_varargs && !kernel.signature->is_varargs()) {
+    return Status::Invalid("Function accepts varargs but kernel signature does not");
+  }
+  kernels_.emplace_back(std::move(kernel));
+  return Status::OK();
+}
+
+Result<const Kernel*> HashAggregateFunction::DispatchExact(
+    const std::vector<ValueDescr>& values) const {
+  return DispatchExactImpl(*this, kernels_, values);
+}
+
 Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
@@ -133,6 +133,10 @@ class ARROW_EXPORT Function {
     /// A function that computes scalar summary statistics from array input.
     SCALAR_AGGREGATE,
 
+    /// A function that computes grouped summary statistics from array input
+    /// and an array of group identifiers.
+    HASH_AGGREGATE,
+
     /// A function that dispatches to other functions and does not contain its
     /// own kernels.
     META
@@ -174,6 +178,16 @@ class ARROW_EXPORT Function {
   virtual Result<Datum> Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const;
 
+  /// \brief Execute the function on the rows of the arguments selected by
+  /// `selection`, producing one output value per selected index.
+  ///
+  /// Scalar functions whose kernels support selection vectors evaluate the
+  /// selected rows in place. Otherwise the selected rows are gathered with
+  /// "take" and passed to Execute.
+  Result<Datum> ExecuteSelected(const std::vector<Datum>& args,
+                                const SelectionVector& selection,
+                                const FunctionOptions* options, ExecContext* ctx) const;
+
   /// \brief Returns a the default options for this function.
   ///
   /// Whatever option semantics a Function has, implementations must guarantee
@@ -299,6 +313,27 @@ class ARROW_EXPORT ScalarAggregateFunction
       const std::vector<ValueDescr>& values) const override;
 };
 
+/// \brief A function that computes summary statistics for each group of its
+/// input, as identified by an array of group ids. Such functions can't be
+/// executed directly through Function::Execute; use internal::GroupBy instead.
+class ARROW_EXPORT HashAggregateFunction
+    : public detail::FunctionImpl<HashAggregateKernel> {
+ public:
+  using KernelType = HashAggregateKernel;
+
+  HashAggregateFunction(std::string name, const Arity& arity, const FunctionDoc* doc,
+                        const FunctionOptions* default_options = NULLPTR)
+      : detail::FunctionImpl<HashAggregateKernel>(
+            std::move(name), Function::HASH_AGGREGATE, arity, doc, default_options) {}
+
+  /// \brief Add a kernel (function implementation). Returns error if the
+  /// kernel's signature does not match the function's arity.
+  Status AddKernel(HashAggregateKernel kernel);
+
+  Result<const Kernel*> DispatchExact(
+      const std::vector<ValueDescr>& values) const override;
+};
+
 /// \brief A function that dispatches to other functions. Must implement
 /// MetaFunction::ExecuteImpl.
 ///
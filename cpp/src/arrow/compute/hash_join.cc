@@ -0,0 +1,442 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/hash_join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::Grouper;
+
+namespace {
+
+// Don't bother partitioning build sides smaller than this many rows per partition
+constexpr int64_t kMinRowsPerPartition = 1 << 14;
+
+// ----------------------------------------------------------------------
+// Row hashing, for partitioning
+
+// Compute a combined hash of each row's keys, and whether any of them is null.
+// The hash_64 function produces hashes independent from those used by the
+// partitions' memo tables.
+Status HashKeyColumns(const std::vector<std::shared_ptr<ArrayData>>& keys, int64_t length,
+                      ExecContext* ctx, Datum* hashes, std::vector<uint8_t>* has_null) {
+  has_null->assign(length, 0);
+  std::vector<Datum> key_values;
+  for (const auto& key : keys) {
+    if (key->MayHaveNulls()) {
+      const uint8_t* validity = key->buffers[0]->data();
+      for (int64_t i = 0; i < length; ++i) {
+        (*has_null)[i] |= !BitUtil::GetBit(validity, key->offset + i);
+      }
+    }
+    key_values.emplace_back(key);
+  }
+  return CallFunction("hash_64", key_values, ctx).Value(hashes);
+}
+
+std::shared_ptr<ArrayData> WrapIndices(const std::vector<int64_t>& indices) {
+  return ArrayData::Make(int64(), static_cast<int64_t>(indices.size()),
+                         {nullptr, Buffer::Wrap(indices)}, /*null_count=*/0);
+}
+
+Result<std::vector<Datum>> TakeKeys(const std::vector<std::shared_ptr<ArrayData>>& keys,
+                                    const std::vector<int64_t>& indices,
+                                    ExecContext* ctx) {
+  const Datum indices_datum(WrapIndices(indices));
+  std::vector<Datum> out(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(out[i], Take(keys[i], indices_datum,
+                                       TakeOptions::NoBoundsCheck(), ctx));
+  }
+  return out;
+}
+
+// ----------------------------------------------------------------------
+// HashJoin implementation
+
+// The hash table of one partition of the build side
+struct BuildPartition {
+  std::unique_ptr<Grouper> grouper;
+
+  // The right rows matching group id `g` are
+  // row_ids[row_offsets[g]] ... row_ids[row_offsets[g + 1] - 1], in ascending order
+  std::vector<int64_t> row_offsets;
+  std::vector<int64_t> row_ids;
+};
+
+class HashJoinImpl : public HashJoin {
+ public:
+  HashJoinImpl(ExecContext* ctx, JoinType join_type) : ctx_(ctx), join_type_(join_type) {}
+
+  Status Init(std::shared_ptr<Schema> left_schema, const Table& right,
+              const HashJoinOptions& options) {
+    if (options.left_keys.empty()) {
+      return Status::Invalid("Hash join requires at least one key");
+    }
+    if (options.left_keys.size() != options.right_keys.size()) {
+      return Status::Invalid("Hash join got ", options.left_keys.size(),
+                             " left keys but ", options.right_keys.size(),
+                             " right keys");
+    }
+
+    std::vector<ValueDescr> key_descrs;
+    std::vector<int> right_key_indices;
+    for (size_t i = 0; i < options.left_keys.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(int left_index,
+                            FindTopLevelField(options.left_keys[i], *left_schema));
+      ARROW_ASSIGN_OR_RAISE(int right_index,
+                            FindTopLevelField(options.right_keys[i], *right.schema()));
+      const auto& left_type = left_schema->field(left_index)->type();
+      const auto& right_type = right.schema()->field(right_index)->type();
+      if (!left_type->Equals(*right_type)) {
+        return Status::TypeError("Hash join key types must match, got ", *left_type,
+                                 " and ", *right_type);
+      }
+      left_key_indices_.push_back(left_index);
+      right_key_indices.push_back(right_index);
+      key_descrs.push_back(ValueDescr::Array(left_type));
+    }
+
+    left_schema_ = std::move(left_schema);
+    if (join_type_ == JoinType::LEFT_SEMI || join_type_ == JoinType::LEFT_ANTI) {
+      output_schema_ = left_schema_;
+    } else {
+      FieldVector fields = left_schema_->fields();
+      for (const auto& field : right.schema()->fields()) {
+        fields.push_back(join_type_ == JoinType::LEFT_OUTER ? field->WithNullable(true)
+                                                            : field);
+      }
+      output_schema_ = schema(std::move(fields));
+    }
+
+    // Flatten the build side so that its rows can be addressed by a single index
+    ARROW_ASSIGN_OR_RAISE(auto combined, right.CombineChunks(ctx_->memory_pool()));
+    for (const auto& column : combined->columns()) {
+      if (column->num_chunks() == 0) {
+        ARROW_ASSIGN_OR_RAISE(auto empty,
+                              MakeArrayOfNull(column->type(), 0, ctx_->memory_pool()));
+        right_columns_.push_back(std::move(empty));
+      } else {
+        DCHECK_EQ(column->num_chunks(), 1);
+        right_columns_.push_back(column->chunk(0));
+      }
+    }
+    return Build(right.num_rows(), right_key_indices, key_descrs);
+  }
+
+  const std::shared_ptr<Schema>& output_schema() const override { return output_schema_; }
+
+  Result<std::shared_ptr<RecordBatch>> Probe(const RecordBatch& left) override {
+    if (!left.schema()->Equals(*left_schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Hash join probe batch has schema ", *left.schema(),
+                             ", expected ", *left_schema_);
+    }
+    const int64_t length = left.num_rows();
+
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    for (int index : left_key_indices_) {
+      keys.push_back(left.column_data(index));
+    }
+
+    // The range of matching right rows for each left row (empty if none)
+    std::vector<const int64_t*> match_begin(length, nullptr);
+    std::vector<const int64_t*> match_end(length, nullptr);
+
+    auto lookup = [&](const BuildPartition& partition, std::vector<Datum> partition_keys,
+                      const int64_t* left_rows, int64_t num_rows) -> Status {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum ids, partition.grouper->Lookup(ExecBatch(std::move(partition_keys),
+                                                         num_rows)));
+      const ArrayData& ids_data = *ids.array();
+      const uint32_t* id_values = ids_data.GetValues<uint32_t>(1);
+      const uint8_t* id_validity =
+          ids_data.MayHaveNulls() ? ids_data.buffers[0]->data() : nullptr;
+      for (int64_t i = 0; i < num_rows; ++i) {
+        if (id_validity == nullptr || BitUtil::GetBit(id_validity, ids_data.offset + i)) {
+          const int64_t row = left_rows ? left_rows[i] : i;
+          match_begin[row] = partition.row_ids.data() + partition.row_offsets[id_values[i]];
+          match_end[row] =
+              partition.row_ids.data() + partition.row_offsets[id_values[i] + 1];
+        }
+      }
+      return Status::OK();
+    };
+
+    if (partitions_.size() == 1) {
+      // Null keys were not inserted in the build side, so can't be found
+      std::vector<Datum> key_values(keys.begin(), keys.end());
+      RETURN_NOT_OK(lookup(partitions_[0], std::move(key_values), nullptr, length));
+    } else {
+      Datum hashes;
+      std::vector<uint8_t> has_null;
+      RETURN_NOT_OK(HashKeyColumns(keys, length, ctx_, &hashes, &has_null));
+      const uint64_t* hash_values = hashes.array()->GetValues<uint64_t>(1);
+
+      const int num_partitions = static_cast<int>(partitions_.size());
+      std::vector<std::vector<int64_t>> partition_rows(num_partitions);
+      for (int64_t i = 0; i < length; ++i) {
+        if (!has_null[i]) {
+          partition_rows[hash_values[i] % num_partitions].push_back(i);
+        }
+      }
+
+      // Each partition writes disjoint entries of match_begin / match_end
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          ctx_->use_threads(), num_partitions, [&](int p) -> Status {
+            const auto& rows = partition_rows[p];
+            if (rows.empty()) {
+              return Status::OK();
+            }
+            ARROW_ASSIGN_OR_RAISE(auto partition_keys, TakeKeys(keys, rows, ctx_));
+            return lookup(partitions_[p], std::move(partition_keys), rows.data(),
+                          static_cast<int64_t>(rows.size()));
+          }));
+    }
+
+    return Emit(left, match_begin, match_end);
+  }
+
+ private:
+  static Result<int> FindTopLevelField(const FieldRef& ref, const Schema& schema) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath path, ref.FindOne(schema));
+    if (path.indices().size() != 1) {
+      return Status::NotImplemented("Hash join on nested field ", ref.ToString());
+    }
+    return path[0];
+  }
+
+  Status Build(int64_t num_rows, const std::vector<int>& key_indices,
+               const std::vector<ValueDescr>& key_descrs) {
+    std::vector<std::shared_ptr<ArrayData>> keys;
+    for (int index : key_indices) {
+      keys.push_back(right_columns_[index]->data());
+    }
+
+    int num_partitions = 1;
+    if (ctx_->use_threads()) {
+      num_partitions = static_cast<int>(
+          std::min<int64_t>(GetCpuThreadPoolCapacity(), num_rows / kMinRowsPerPartition));
+      num_partitions = std::max(num_partitions, 1);
+    }
+
+    // Assign each right row to a partition. Rows with null keys can't match
+    // anything, so they are left out.
+    Datum hashes;
+    std::vector<uint8_t> has_null;
+    RETURN_NOT_OK(HashKeyColumns(keys, num_rows, ctx_, &hashes, &has_null));
+    const uint64_t* hash_values = hashes.array()->GetValues<uint64_t>(1);
+    std::vector<std::vector<int64_t>> partition_rows(num_partitions);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (!has_null[i]) {
+        partition_rows[hash_values[i] % num_partitions].push_back(i);
+      }
+    }
+
+    partitions_.resize(num_partitions);
+    for (auto& partition : partitions_) {
+      ARROW_ASSIGN_OR_RAISE(partition.grouper, Grouper::Make(key_descrs, ctx_));
+    }
+
+    return ::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads(), num_partitions, [&](int p) -> Status {
+          BuildPartition* partition = &partitions_[p];
+          const auto& rows = partition_rows[p];
+          const auto num_partition_rows = static_cast<int64_t>(rows.size());
+
+          std::vector<Datum> partition_keys;
+          if (num_partition_rows == num_rows) {
+            // Single partition without null keys: no need to select rows
+            partition_keys.assign(keys.begin(), keys.end());
+          } else {
+            ARROW_ASSIGN_OR_RAISE(partition_keys, TakeKeys(keys, rows, ctx_));
+          }
+          ARROW_ASSIGN_OR_RAISE(Datum ids, partition->grouper->Consume(ExecBatch(
+                                               std::move(partition_keys),
+                                               num_partition_rows)));
+          const uint32_t* id_values = ids.array()->GetValues<uint32_t>(1);
+
+          // Counting sort of the partition's rows by group id; rows are visited
+          // in ascending order so each group's rows stay in right table order
+          const uint32_t num_groups = partition->grouper->num_groups();
+          partition->row_offsets.assign(num_groups + 1, 0);
+          for (int64_t i = 0; i < num_partition_rows; ++i) {
+            ++partition->row_offsets[id_values[i] + 1];
+          }
+          for (uint32_t g = 0; g < num_groups; ++g) {
+            partition->row_offsets[g + 1] += partition->row_offsets[g];
+          }
+          std::vector<int64_t> cursors(partition->row_offsets.begin(),
+                                       partition->row_offsets.end() - 1);
+          partition->row_ids.resize(num_partition_rows);
+          for (int64_t i = 0; i < num_partition_rows; ++i) {
+            partition->row_ids[cursors[id_values[i]]++] = rows[i];
+          }
+          return Status::OK();
+        });
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Emit(
+      const RecordBatch& left, const std::vector<const int64_t*>& match_begin,
+      const std::vector<const int64_t*>& match_end) {
+    const int64_t length = left.num_rows();
+    TypedBufferBuilder<int64_t> left_indices(ctx_->memory_pool());
+    TypedBufferBuilder<int64_t> right_indices(ctx_->memory_pool());
+    TypedBufferBuilder<bool> right_valid(ctx_->memory_pool());
+    int64_t right_null_count = 0;
+
+    for (int64_t i = 0; i < length; ++i) {
+      const bool matched = match_begin[i] != match_end[i];
+      switch (join_type_) {
+        case JoinType::INNER:
+        case JoinType::LEFT_OUTER:
+          if (matched) {
+            const int64_t num_matches = match_end[i] - match_begin[i];
+            RETURN_NOT_OK(left_indices.Append(num_matches, i));
+            RETURN_NOT_OK(right_indices.Append(match_begin[i], num_matches));
+            if (join_type_ == JoinType::LEFT_OUTER) {
+              RETURN_NOT_OK(right_valid.Append(num_matches, true));
+            }
+          } else if (join_type_ == JoinType::LEFT_OUTER) {
+            RETURN_NOT_OK(left_indices.Append(i));
+            RETURN_NOT_OK(right_indices.Append(0));
+            RETURN_NOT_OK(right_valid.Append(false));
+            ++right_null_count;
+          }
+          break;
+        case JoinType::LEFT_SEMI:
+          if (matched) {
+            RETURN_NOT_OK(left_indices.Append(i));
+          }
+          break;
+        case JoinType::LEFT_ANTI:
+          if (!matched) {
+            RETURN_NOT_OK(left_indices.Append(i));
+          }
+          break;
+      }
+    }
+
+    const int64_t out_length = left_indices.length();
+    std::shared_ptr<Buffer> left_indices_buf;
+    RETURN_NOT_OK(left_indices.Finish(&left_indices_buf));
+    auto left_take = MakeArray(
+        ArrayData::Make(int64(), out_length, {nullptr, std::move(left_indices_buf)}, 0));
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const auto& column : left.columns()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto taken, Take(*column, *left_take, TakeOptions::NoBoundsCheck(), ctx_));
+      columns.push_back(std::move(taken));
+    }
+
+    if (join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER) {
+      std::shared_ptr<Buffer> right_indices_buf, right_valid_buf;
+      RETURN_NOT_OK(right_indices.Finish(&right_indices_buf));
+      if (right_null_count > 0) {
+        RETURN_NOT_OK(right_valid.Finish(&right_valid_buf));
+      }
+      auto right_take = MakeArray(ArrayData::Make(
+          int64(), out_length, {std::move(right_valid_buf), std::move(right_indices_buf)},
+          right_null_count));
+      for (const auto& column : right_columns_) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto taken, Take(*column, *right_take, TakeOptions::NoBoundsCheck(), ctx_));
+        columns.push_back(std::move(taken));
+      }
+    }
+
+    return RecordBatch::Make(output_schema_, out_length, std::move(columns));
+  }
+
+  ExecContext* ctx_;
+  const JoinType join_type_;
+  std::shared_ptr<Schema> left_schema_;
+  std::shared_ptr<Schema> output_schema_;
+  std::vector<int> left_key_indices_;
+  ArrayVector right_columns_;
+  std::vector<BuildPartition> partitions_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<HashJoin>> HashJoin::Make(std::shared_ptr<Schema> left_schema,
+                                                 const Table& right,
+                                                 const HashJoinOptions& options,
+                                                 ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  auto impl = std::make_shared<HashJoinImpl>(ctx, options.join_type);
+  RETURN_NOT_OK(impl->Init(std::move(left_schema), right, options));
+  return impl;
+}
+
+RecordBatchIterator HashJoin::MakeProbeIterator(std::shared_ptr<HashJoin> join,
+                                                RecordBatchIterator left) {
+  return MakeMaybeMapIterator(
+      [join](std::shared_ptr<RecordBatch> batch) { return join->Probe(*batch); },
+      std::move(left));
+}
+
+Result<std::shared_ptr<Table>> HashJoinTables(const Table& left, const Table& right,
+                                              const HashJoinOptions& options,
+                                              ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(auto join, HashJoin::Make(left.schema(), right, options, ctx));
+
+  TableBatchReader reader(left);
+  if (ctx != nullptr) {
+    reader.set_chunksize(ctx->exec_chunksize());
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto joined, join->Probe(*batch));
+    batches.push_back(std::move(joined));
+  }
+  return Table::FromRecordBatches(join->output_schema(), std::move(batches));
+}
+
+}  // namespace compute
+}  // namespace arrow
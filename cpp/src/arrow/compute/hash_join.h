@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class ExecContext;
+
+/// \brief The kind of join computed by HashJoin
+enum class JoinType {
+  /// Emit one row per matching (left, right) pair
+  INNER,
+  /// Like INNER, but also emit left rows without a match, padded with nulls
+  LEFT_OUTER,
+  /// Emit each left row which has at least one match, left columns only
+  LEFT_SEMI,
+  /// Emit each left row which has no match, left columns only
+  LEFT_ANTI,
+};
+
+/// \brief Options for HashJoin
+struct ARROW_EXPORT HashJoinOptions {
+  HashJoinOptions() = default;
+  HashJoinOptions(JoinType join_type, std::vector<FieldRef> left_keys,
+                  std::vector<FieldRef> right_keys)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)) {}
+
+  /// The kind of join to compute
+  JoinType join_type = JoinType::INNER;
+
+  /// The key columns of the left (probe) side
+  std::vector<FieldRef> left_keys;
+
+  /// The key columns of the right (build) side; each must have the same type
+  /// as the corresponding left key
+  std::vector<FieldRef> right_keys;
+};
+
+/// \brief An equi-join of a stream of left batches against an in-memory
+/// right table
+///
+/// The right (build) side is hashed on construction into partitions which
+/// are built independently, on the CPU thread pool if ExecContext::use_threads()
+/// is true. Left (probe) batches can then be joined one at a time, so that
+/// the left side never needs to be fully materialized.
+///
+/// Rows with a null in any key column never match. The output schema is the
+/// left schema followed by the right schema (only the left schema for
+/// LEFT_SEMI and LEFT_ANTI joins). Output rows follow the order of the left
+/// batch; matches of a given left row follow the order of the right table.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT HashJoin {
+ public:
+  virtual ~HashJoin() = default;
+
+  /// \brief Build the hash table of the right side of the join
+  ///
+  /// \param[in] left_schema the schema of the batches that will be probed
+  /// \param[in] right the build side of the join
+  /// \param[in] options the join options
+  /// \param[in] ctx the execution context, optional
+  static Result<std::shared_ptr<HashJoin>> Make(std::shared_ptr<Schema> left_schema,
+                                                const Table& right,
+                                                const HashJoinOptions& options,
+                                                ExecContext* ctx = NULLPTR);
+
+  /// \brief The schema of the batches produced by Probe
+  virtual const std::shared_ptr<Schema>& output_schema() const = 0;
+
+  /// \brief Join a batch of the left side against the right side
+  ///
+  /// The batch must have the left schema given to Make. This method is not
+  /// thread-safe; probe batches should be fed from a single thread (the
+  /// batch itself is probed in parallel if the build side is partitioned).
+  virtual Result<std::shared_ptr<RecordBatch>> Probe(const RecordBatch& left) = 0;
+
+  /// \brief Lazily join each batch of `left` against the right side
+  static RecordBatchIterator MakeProbeIterator(std::shared_ptr<HashJoin> join,
+                                               RecordBatchIterator left);
+};
+
+/// \brief Join two tables, streaming over the batches of the left table
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Table>> HashJoinTables(const Table& left, const Table& right,
+                                              const HashJoinOptions& options,
+                                              ExecContext* ctx = NULLPTR);
+
+}  // namespace compute
+}  // namespace arrow
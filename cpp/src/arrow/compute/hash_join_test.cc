@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/exec.h"
+#include "arrow/compute/hash_join.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ::testing::Test {
+ public:
+  void SetUp() override {
+    left_schema_ = schema({field("id", int32()), field("name", utf8())});
+    right_schema_ = schema({field("key", int32()), field("score", float64())});
+    // Two left chunks, to exercise streaming over the probe side
+    left_ = TableFromJSON(left_schema_, {R"([
+      [1, "a"],
+      [2, "b"],
+      [null, "c"]
+    ])",
+                                         R"([
+      [3, "d"],
+      [1, "e"]
+    ])"});
+    right_ = TableFromJSON(right_schema_, {R"([
+      [1, 1.5],
+      [3, 3.5],
+      [1, 0.5],
+      [null, 9.5]
+    ])"});
+  }
+
+  void AssertJoin(JoinType join_type, const std::shared_ptr<Schema>& expected_schema,
+                  const std::string& expected_json) {
+    for (bool use_threads : {false, true}) {
+      ExecContext ctx;
+      ctx.set_use_threads(use_threads);
+      HashJoinOptions options(join_type, {"id"}, {"key"});
+      ASSERT_OK_AND_ASSIGN(auto actual, HashJoinTables(*left_, *right_, options, &ctx));
+      ASSERT_OK(actual->ValidateFull());
+      auto expected = TableFromJSON(expected_schema, {expected_json});
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> left_schema_, right_schema_;
+  std::shared_ptr<Table> left_, right_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  AssertJoin(JoinType::INNER,
+             schema({field("id", int32()), field("name", utf8()), field("key", int32()),
+                     field("score", float64())}),
+             R"([
+    [1, "a", 1, 1.5],
+    [1, "a", 1, 0.5],
+    [3, "d", 3, 3.5],
+    [1, "e", 1, 1.5],
+    [1, "e", 1, 0.5]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  AssertJoin(JoinType::LEFT_OUTER,
+             schema({field("id", int32()), field("name", utf8()), field("key", int32()),
+                     field("score", float64())}),
+             R"([
+    [1,    "a", 1,    1.5],
+    [1,    "a", 1,    0.5],
+    [2,    "b", null, null],
+    [null, "c", null, null],
+    [3,    "d", 3,    3.5],
+    [1,    "e", 1,    1.5],
+    [1,    "e", 1,    0.5]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoin(JoinType::LEFT_SEMI, left_schema_, R"([
+    [1, "a"],
+    [3, "d"],
+    [1, "e"]
+  ])");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  AssertJoin(JoinType::LEFT_ANTI, left_schema_, R"([
+    [2,    "b"],
+    [null, "c"]
+  ])");
+}
+
+TEST_F(TestHashJoin, EmptyBuildSide) {
+  auto empty_right = TableFromJSON(right_schema_, {"[]"});
+  HashJoinOptions options(JoinType::LEFT_ANTI, {"id"}, {"key"});
+  ASSERT_OK_AND_ASSIGN(auto actual, HashJoinTables(*left_, *empty_right, options));
+  AssertTablesEqual(*left_, *actual, /*same_chunk_layout=*/false);
+
+  options.join_type = JoinType::INNER;
+  ASSERT_OK_AND_ASSIGN(actual, HashJoinTables(*left_, *empty_right, options));
+  ASSERT_EQ(actual->num_rows(), 0);
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  auto left = TableFromJSON(schema({field("a", utf8()), field("b", int64())}), {R"([
+    ["x", 1],
+    ["x", 2],
+    ["y", 1],
+    [null, 1]
+  ])"});
+  auto right = TableFromJSON(schema({field("b", int64()), field("a", utf8())}), {R"([
+    [2, "x"],
+    [1, "y"],
+    [1, null]
+  ])"});
+  HashJoinOptions options(JoinType::LEFT_SEMI, {"a", "b"}, {"a", "b"});
+  ASSERT_OK_AND_ASSIGN(auto actual, HashJoinTables(*left, *right, options));
+  auto expected = TableFromJSON(left->schema(), {R"([
+    ["x", 2],
+    ["y", 1]
+  ])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestHashJoin, ProbeIterator) {
+  HashJoinOptions options(JoinType::LEFT_SEMI, {"id"}, {"key"});
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(left_schema_, *right_, options));
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  TableBatchReader reader(*left_);
+  ASSERT_OK(reader.ReadAll(&batches));
+  ASSERT_EQ(batches.size(), 2);
+
+  auto it = HashJoin::MakeProbeIterator(join, MakeVectorIterator(batches));
+  ASSERT_OK_AND_ASSIGN(auto first, it.Next());
+  AssertBatchesEqual(*RecordBatchFromJSON(left_schema_, R"([[1, "a"]])"), *first);
+  ASSERT_OK_AND_ASSIGN(auto second, it.Next());
+  AssertBatchesEqual(*RecordBatchFromJSON(left_schema_, R"([[3, "d"], [1, "e"]])"),
+                     *second);
+  ASSERT_OK_AND_ASSIGN(auto end, it.Next());
+  ASSERT_EQ(end, nullptr);
+}
+
+TEST_F(TestHashJoin, Errors) {
+  HashJoinOptions options(JoinType::INNER, {"id"}, {"score"});
+  ASSERT_RAISES(TypeError, HashJoin::Make(left_schema_, *right_, options));
+
+  options = HashJoinOptions(JoinType::INNER, {"id"}, {"nonexistent"});
+  ASSERT_RAISES(Invalid, HashJoin::Make(left_schema_, *right_, options));
+
+  options = HashJoinOptions(JoinType::INNER, {"id", "name"}, {"key"});
+  ASSERT_RAISES(Invalid, HashJoin::Make(left_schema_, *right_, options));
+
+  options = HashJoinOptions(JoinType::INNER, {"id"}, {"key"});
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(left_schema_, *right_, options));
+  ASSERT_RAISES(Invalid, join->Probe(*RecordBatchFromJSON(right_schema_, "[]")));
+}
+
+TEST_F(TestHashJoin, PartitionedBuildMatchesSerial) {
+  // Large enough for the build side to be partitioned when using threads
+  constexpr int64_t kBuildRows = 1 << 17;
+  constexpr int64_t kProbeRows = 1 << 12;
+  random::RandomArrayGenerator rng(42);
+
+  auto right_schema = schema({field("key", int64()), field("value", int64())});
+  auto right = Table::Make(
+      right_schema, {rng.Int64(kBuildRows, 0, kBuildRows / 4, /*null_probability=*/0.01),
+                     rng.Int64(kBuildRows, 0, 1000)});
+  auto left_schema = schema({field("key", int64())});
+  auto left =
+      Table::Make(left_schema, {rng.Int64(kProbeRows, 0, kBuildRows / 2, 0.01)});
+
+  for (auto join_type : {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::LEFT_SEMI,
+                         JoinType::LEFT_ANTI}) {
+    HashJoinOptions options(join_type, {"key"}, {"key"});
+    ExecContext serial_ctx, parallel_ctx;
+    serial_ctx.set_use_threads(false);
+    parallel_ctx.set_use_threads(true);
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         HashJoinTables(*left, *right, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         HashJoinTables(*left, *right, options, &parallel_ctx));
+    ASSERT_OK(actual->ValidateFull());
+    // Output order is deterministic regardless of partitioning
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
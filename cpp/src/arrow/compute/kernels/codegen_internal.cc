@@ -40,6 +40,14 @@ ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec) {
   };
 }
 
+Status AddSelectionAwareKernel(ScalarFunction* func, std::vector<InputType> in_types,
+                               OutputType out_type, ArrayKernelExec exec,
+                               KernelInit init) {
+  ScalarKernel kernel(std::move(in_types), std::move(out_type), std::move(exec), init);
+  kernel.can_execute_selection = true;
+  return func->AddKernel(std::move(kernel));
+}
+
 std::vector<std::shared_ptr<DataType>> g_signed_int_types;
 std::vector<std::shared_ptr<DataType>> g_unsigned_int_types;
 std::vector<std::shared_ptr<DataType>> g_int_types;
@@ -28,6 +28,7 @@
 #include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -265,6 +266,73 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+// Iterator over the values of an input array at the indices of a selection
+// vector, yielding a GetViewType<Type>::PhysicalType
+
+template <typename Type, typename Enable = void>
+struct SelectionIterator;
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_has_c_type_not_boolean<Type>> {
+  using T = typename Type::c_type;
+  const T* values;
+  const int32_t* indices;
+
+  SelectionIterator(const ArrayData& data, const SelectionVector& selection)
+      : values(data.GetValues<T>(1)), indices(selection.indices()) {}
+  T operator()() { return values[*indices++]; }
+};
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_boolean<Type>> {
+  const uint8_t* bitmap;
+  int64_t offset;
+  const int32_t* indices;
+
+  SelectionIterator(const ArrayData& data, const SelectionVector& selection)
+      : bitmap(data.buffers[1]->data()),
+        offset(data.offset),
+        indices(selection.indices()) {}
+  bool operator()() { return BitUtil::GetBit(bitmap, offset + *indices++); }
+};
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_base_binary<Type>> {
+  using offset_type = typename Type::offset_type;
+  const offset_type* offsets;
+  const char* data;
+  const int32_t* indices;
+
+  SelectionIterator(const ArrayData& arr, const SelectionVector& selection)
+      : offsets(arr.GetValues<offset_type>(1)),
+        data(reinterpret_cast<const char*>(arr.buffers[2]->data())),
+        indices(selection.indices()) {}
+
+  util::string_view operator()() {
+    const int32_t index = *indices++;
+    return util::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
+};
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_fixed_size_binary<Type>> {
+  int32_t byte_width;
+  const char* data;
+  const int32_t* indices;
+
+  SelectionIterator(const ArrayData& arr, const SelectionVector& selection)
+      : byte_width(checked_cast<const FixedSizeBinaryType&>(*arr.type).byte_width()),
+        data(reinterpret_cast<const char*>(arr.buffers[1]->data()) +
+             arr.offset * byte_width),
+        indices(selection.indices()) {}
+
+  util::string_view operator()() {
+    const int32_t index = *indices++;
+    return util::string_view(data + static_cast<int64_t>(index) * byte_width,
+                             byte_width);
+  }
+};
+
 // Iterator over various output array types, taking a GetOutputType<Type>
 
 template <typename Type, typename Enable = void>
@@ -374,6 +442,64 @@ static void VisitTwoArrayValuesInline(const ArrayData& arr0, const ArrayData& ar
                         arr0.length, std::move(visit_valid), std::move(visit_null));
 }
 
+// Variants of the above which, given a selection vector, only visit the
+// values at the selected indices
+
+template <typename T, typename VisitFunc, typename NullFunc>
+static void VisitArrayValuesInline(const ArrayData& arr, const SelectionVector* selection,
+                                   VisitFunc&& valid_func, NullFunc&& null_func) {
+  if (selection == NULLPTR) {
+    return VisitArrayValuesInline<T>(arr, std::forward<VisitFunc>(valid_func),
+                                     std::forward<NullFunc>(null_func));
+  }
+  SelectionIterator<T> arr_it(arr, *selection);
+  const int32_t* indices = selection->indices();
+  const int64_t length = selection->length();
+  if (!arr.MayHaveNulls()) {
+    for (int64_t i = 0; i < length; ++i) {
+      valid_func(GetViewType<T>::LogicalValue(arr_it()));
+    }
+    return;
+  }
+  const uint8_t* bitmap = arr.buffers[0]->data();
+  for (int64_t i = 0; i < length; ++i) {
+    auto value = arr_it();
+    if (BitUtil::GetBit(bitmap, arr.offset + indices[i])) {
+      valid_func(GetViewType<T>::LogicalValue(value));
+    } else {
+      null_func();
+    }
+  }
+}
+
+template <typename Arg0Type, typename Arg1Type, typename VisitFunc, typename NullFunc>
+static void VisitTwoArrayValuesInline(const ArrayData& arr0, const ArrayData& arr1,
+                                      const SelectionVector* selection,
+                                      VisitFunc&& valid_func, NullFunc&& null_func) {
+  if (selection == NULLPTR) {
+    return VisitTwoArrayValuesInline<Arg0Type, Arg1Type>(
+        arr0, arr1, std::forward<VisitFunc>(valid_func),
+        std::forward<NullFunc>(null_func));
+  }
+  SelectionIterator<Arg0Type> arr0_it(arr0, *selection);
+  SelectionIterator<Arg1Type> arr1_it(arr1, *selection);
+  const int32_t* indices = selection->indices();
+  const int64_t length = selection->length();
+  const uint8_t* bitmap0 = arr0.MayHaveNulls() ? arr0.buffers[0]->data() : NULLPTR;
+  const uint8_t* bitmap1 = arr1.MayHaveNulls() ? arr1.buffers[0]->data() : NULLPTR;
+  for (int64_t i = 0; i < length; ++i) {
+    auto value0 = arr0_it();
+    auto value1 = arr1_it();
+    if ((bitmap0 == NULLPTR || BitUtil::GetBit(bitmap0, arr0.offset + indices[i])) &&
+        (bitmap1 == NULLPTR || BitUtil::GetBit(bitmap1, arr1.offset + indices[i]))) {
+      valid_func(GetViewType<Arg0Type>::LogicalValue(value0),
+                 GetViewType<Arg1Type>::LogicalValue(value1));
+    } else {
+      null_func();
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // Reusable type resolvers
 
@@ -386,6 +512,12 @@ void ExecFail(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
 ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec);
 
+// Add a kernel whose exec evaluates batches with a selection vector itself
+// (see ScalarKernel::can_execute_selection), as the applicators below do
+Status AddSelectionAwareKernel(ScalarFunction* func, std::vector<InputType> in_types,
+                               OutputType out_type, ArrayKernelExec exec,
+                               KernelInit init = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Helpers for iterating over common DataType instances for adding kernels to
 // functions
@@ -549,6 +681,14 @@ struct ScalarUnary {
     });
   }
 
+  static void ExecArraySelected(KernelContext* ctx, const ArrayData& arg0,
+                                const SelectionVector& selection, Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+      return Op::template Call<OutValue, Arg0Value>(ctx, arg0_it());
+    });
+  }
+
   static void ExecScalar(KernelContext* ctx, const Scalar& arg0, Datum* out) {
     Scalar* out_scalar = out->scalar().get();
     if (arg0.is_valid) {
@@ -563,6 +703,9 @@ struct ScalarUnary {
 
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (batch[0].kind() == Datum::ARRAY) {
+      if (batch.selection_vector) {
+        return ExecArraySelected(ctx, *batch[0].array(), *batch.selection_vector, out);
+      }
       return ExecArray(ctx, *batch[0].array(), out);
     } else {
       return ExecScalar(ctx, *batch[0].scalar(), out);
@@ -585,8 +728,8 @@ struct ScalarUnaryNotNullStateful {
 
   template <typename Type, typename Enable = void>
   struct ArrayExec {
-    static void Exec(const ThisType& functor, KernelContext* ctx, const ExecBatch& batch,
-                     Datum* out) {
+    static void Exec(const ThisType& functor, KernelContext* ctx, const ArrayData& arg0,
+                     const SelectionVector* selection, Datum* out) {
       ARROW_LOG(FATAL) << "Missing ArrayExec specialization for output type "
                        << out->type();
     }
@@ -596,11 +739,11 @@ struct ScalarUnaryNotNullStateful {
   struct ArrayExec<
       Type, enable_if_t<has_c_type<Type>::value && !is_boolean_type<Type>::value>> {
     static void Exec(const ThisType& functor, KernelContext* ctx, const ArrayData& arg0,
-                     Datum* out) {
+                     const SelectionVector* selection, Datum* out) {
       ArrayData* out_arr = out->mutable_array();
       auto out_data = out_arr->GetMutableValues<OutValue>(1);
       VisitArrayValuesInline<Arg0Type>(
-          arg0,
+          arg0, selection,
           [&](Arg0Value v) {
             *out_data++ = functor.op.template Call<OutValue, Arg0Value>(ctx, v);
           },
@@ -614,14 +757,14 @@ struct ScalarUnaryNotNullStateful {
   template <typename Type>
   struct ArrayExec<Type, enable_if_base_binary<Type>> {
     static void Exec(const ThisType& functor, KernelContext* ctx, const ArrayData& arg0,
-                     Datum* out) {
+                     const SelectionVector* selection, Datum* out) {
       // NOTE: This code is not currently used by any kernels and has
       // suboptimal performance because it's recomputing the validity bitmap
       // that is already computed by the kernel execution layer. Consider
       // writing a lower-level "output adapter" for base binary types.
       typename TypeTraits<Type>::BuilderType builder;
       VisitArrayValuesInline<Arg0Type>(
-          arg0,
+          arg0, selection,
           [&](Arg0Value v) {
             KERNEL_RETURN_IF_ERROR(ctx, builder.Append(functor.op.Call(ctx, v)));
           },
@@ -637,12 +780,12 @@ struct ScalarUnaryNotNullStateful {
   template <typename Type>
   struct ArrayExec<Type, enable_if_t<is_boolean_type<Type>::value>> {
     static void Exec(const ThisType& functor, KernelContext* ctx, const ArrayData& arg0,
-                     Datum* out) {
+                     const SelectionVector* selection, Datum* out) {
       ArrayData* out_arr = out->mutable_array();
       FirstTimeBitmapWriter out_writer(out_arr->buffers[1]->mutable_data(),
                                        out_arr->offset, out_arr->length);
       VisitArrayValuesInline<Arg0Type>(
-          arg0,
+          arg0, selection,
           [&](Arg0Value v) {
             if (functor.op.template Call<OutValue, Arg0Value>(ctx, v)) {
               out_writer.Set();
@@ -661,11 +804,11 @@ struct ScalarUnaryNotNullStateful {
   template <typename Type>
   struct ArrayExec<Type, enable_if_t<std::is_same<Type, Decimal128Type>::value>> {
     static void Exec(const ThisType& functor, KernelContext* ctx, const ArrayData& arg0,
-                     Datum* out) {
+                     const SelectionVector* selection, Datum* out) {
       ArrayData* out_arr = out->mutable_array();
       auto out_data = out_arr->GetMutableValues<uint8_t>(1);
       VisitArrayValuesInline<Arg0Type>(
-          arg0,
+          arg0, selection,
           [&](Arg0Value v) {
             functor.op.template Call<OutValue, Arg0Value>(ctx, v).ToBytes(out_data);
             out_data += 16;
@@ -684,7 +827,8 @@ struct ScalarUnaryNotNullStateful {
 
   void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (batch[0].kind() == Datum::ARRAY) {
-      ArrayExec<OutType>::Exec(*this, ctx, *batch[0].array(), out);
+      ArrayExec<OutType>::Exec(*this, ctx, *batch[0].array(),
+                               batch.selection_vector.get(), out);
     } else {
       return Scalar(ctx, *batch[0].scalar(), out);
     }
@@ -765,7 +909,56 @@ struct ScalarBinary {
     }
   }
 
+  static void ArrayArraySelected(KernelContext* ctx, const ArrayData& arg0,
+                                 const ArrayData& arg1, const SelectionVector& selection,
+                                 Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    SelectionIterator<Arg1Type> arg1_it(arg1, selection);
+    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+      return Op::template Call(ctx, arg0_it(), arg1_it());
+    });
+  }
+
+  static void ArrayScalarSelected(KernelContext* ctx, const ArrayData& arg0,
+                                  const Scalar& arg1, const SelectionVector& selection,
+                                  Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
+    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+      return Op::template Call(ctx, arg0_it(), arg1_val);
+    });
+  }
+
+  static void ScalarArraySelected(KernelContext* ctx, const Scalar& arg0,
+                                  const ArrayData& arg1, const SelectionVector& selection,
+                                  Datum* out) {
+    auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
+    SelectionIterator<Arg1Type> arg1_it(arg1, selection);
+    OutputAdapter<OutType>::Write(ctx, out, [&]() -> OutValue {
+      return Op::template Call(ctx, arg0_val, arg1_it());
+    });
+  }
+
+  static void ExecSelected(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const SelectionVector& selection = *batch.selection_vector;
+    if (batch[0].kind() == Datum::ARRAY) {
+      if (batch[1].kind() == Datum::ARRAY) {
+        return ArrayArraySelected(ctx, *batch[0].array(), *batch[1].array(), selection,
+                                  out);
+      } else {
+        return ArrayScalarSelected(ctx, *batch[0].array(), *batch[1].scalar(), selection,
+                                   out);
+      }
+    } else {
+      return ScalarArraySelected(ctx, *batch[0].scalar(), *batch[1].array(), selection,
+                                 out);
+    }
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch.selection_vector) {
+      return ExecSelected(ctx, batch, out);
+    }
     if (batch[0].kind() == Datum::ARRAY) {
       if (batch[1].kind() == Datum::ARRAY) {
         return ArrayArray(ctx, *batch[0].array(), *batch[1].array(), out);
@@ -797,10 +990,10 @@ struct ScalarBinaryNotNullStateful {
   // NOTE: In ArrayExec<Type>, Type is really OutputType
 
   void ArrayArray(KernelContext* ctx, const ArrayData& arg0, const ArrayData& arg1,
-                  Datum* out) {
+                  const SelectionVector* selection, Datum* out) {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     VisitTwoArrayValuesInline<Arg0Type, Arg1Type>(
-        arg0, arg1,
+        arg0, arg1, selection,
         [&](Arg0Value u, Arg1Value v) {
           writer.Write(op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, v));
         },
@@ -808,12 +1001,12 @@ struct ScalarBinaryNotNullStateful {
   }
 
   void ArrayScalar(KernelContext* ctx, const ArrayData& arg0, const Scalar& arg1,
-                   Datum* out) {
+                   const SelectionVector* selection, Datum* out) {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg1.is_valid) {
       const auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
       VisitArrayValuesInline<Arg0Type>(
-          arg0,
+          arg0, selection,
           [&](Arg0Value u) {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, u, arg1_val));
@@ -823,12 +1016,12 @@ struct ScalarBinaryNotNullStateful {
   }
 
   void ScalarArray(KernelContext* ctx, const Scalar& arg0, const ArrayData& arg1,
-                   Datum* out) {
+                   const SelectionVector* selection, Datum* out) {
     OutputArrayWriter<OutType> writer(out->mutable_array());
     if (arg0.is_valid) {
       const auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
       VisitArrayValuesInline<Arg1Type>(
-          arg1,
+          arg1, selection,
           [&](Arg1Value v) {
             writer.Write(
                 op.template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val, v));
@@ -849,15 +1042,16 @@ struct ScalarBinaryNotNullStateful {
   }
 
   void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const SelectionVector* selection = batch.selection_vector.get();
     if (batch[0].kind() == Datum::ARRAY) {
       if (batch[1].kind() == Datum::ARRAY) {
-        return ArrayArray(ctx, *batch[0].array(), *batch[1].array(), out);
+        return ArrayArray(ctx, *batch[0].array(), *batch[1].array(), selection, out);
       } else {
-        return ArrayScalar(ctx, *batch[0].array(), *batch[1].scalar(), out);
+        return ArrayScalar(ctx, *batch[0].array(), *batch[1].scalar(), selection, out);
       }
     } else {
       if (batch[1].kind() == Datum::ARRAY) {
-        return ScalarArray(ctx, *batch[0].scalar(), *batch[1].array(), out);
+        return ScalarArray(ctx, *batch[0].scalar(), *batch[1].array(), selection, out);
       } else {
         return ScalarScalar(ctx, *batch[0].scalar(), *batch[1].scalar(), out);
       }
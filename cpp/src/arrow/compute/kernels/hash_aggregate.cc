@@ -0,0 +1,1400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BinaryMemoTable;
+using internal::kKeyNotFound;
+using internal::VisitBitBlocksVoid;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+//
+// The key columns of each row are encoded into a single contiguous byte
+// string, which is then looked up in a BinaryMemoTable. Since the memo table
+// assigns indices densely in insertion order, the memo index of an encoded
+// row is directly usable as its group id.
+
+struct KeyEncoder {
+  // The first byte of an encoded key is used to indicate nullity
+  static constexpr uint8_t kValidByte = 0;
+  static constexpr uint8_t kNullByte = 1;
+
+  virtual ~KeyEncoder() = default;
+
+  // Add the encoded length of each row of `data` to `lengths`
+  virtual void AddLength(const ArrayData& data, int32_t* lengths) = 0;
+
+  // Write the encoding of each row of `data` at `encoded_bytes[i]`, and
+  // advance each pointer past the written bytes
+  virtual void Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  // Decode `length` rows from `encoded_bytes`, advancing each pointer past
+  // the consumed bytes
+  virtual Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                                    int32_t length,
+                                                    MemoryPool* pool) = 0;
+
+  static bool IsNull(const uint8_t* encoded_bytes) {
+    return encoded_bytes[0] == kNullByte;
+  }
+};
+
+// Decoding helper: allocate a validity bitmap for `length` rows, or return
+// null if all rows are valid.
+Result<std::shared_ptr<Buffer>> DecodeNulls(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool,
+                                            int64_t* null_count) {
+  *null_count = 0;
+  for (int32_t i = 0; i < length; ++i) {
+    *null_count += KeyEncoder::IsNull(encoded_bytes[i]);
+  }
+  if (*null_count == 0) {
+    return nullptr;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(length, pool));
+  uint8_t* bitmap = null_bitmap->mutable_data();
+  for (int32_t i = 0; i < length; ++i) {
+    BitUtil::SetBitTo(bitmap, i, !KeyEncoder::IsNull(encoded_bytes[i]));
+  }
+  return std::move(null_bitmap);
+}
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1;
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += kByteWidth + 1;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    VisitArrayDataInline<BooleanType>(
+        data,
+        [&](bool value) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          *encoded_ptr++ = value;
+        },
+        [&] {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          *encoded_ptr++ = 0;
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_buf,
+                          DecodeNulls(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      BitUtil::SetBitTo(raw_output, i, encoded_ptr[1] != 0);
+      encoded_ptr += kByteWidth + 1;
+    }
+
+    return ArrayData::Make(boolean(), length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += byte_width_ + 1;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* key_data = data.buffers[1]->data() + data.offset * byte_width_;
+    int64_t i = 0;
+    VisitBitBlocksVoid(
+        data.buffers[0], data.offset, data.length,
+        [&](int64_t) {
+          auto& encoded_ptr = encoded_bytes[i];
+          *encoded_ptr++ = kValidByte;
+          std::memcpy(encoded_ptr, key_data + i * byte_width_, byte_width_);
+          encoded_ptr += byte_width_;
+          ++i;
+        },
+        [&] {
+          // Null slots are zero-filled so that all nulls compare equal
+          auto& encoded_ptr = encoded_bytes[i];
+          *encoded_ptr++ = kNullByte;
+          std::memset(encoded_ptr, 0, byte_width_);
+          encoded_ptr += byte_width_;
+          ++i;
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_buf,
+                          DecodeNulls(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      std::memcpy(raw_output + i * byte_width_, encoded_ptr + 1, byte_width_);
+      encoded_ptr += byte_width_ + 1;
+    }
+
+    return ArrayData::Make(type_, length, {std::move(null_buf), std::move(key_buf)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  void AddLength(const ArrayData& data, int32_t* lengths) override {
+    int64_t i = 0;
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          lengths[i++] +=
+              static_cast<int32_t>(kExtraByteForNull + sizeof(Offset) + bytes.size());
+        },
+        [&] { lengths[i++] += kExtraByteForNull + sizeof(Offset); });
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    VisitArrayDataInline<T>(
+        data,
+        [&](util::string_view bytes) {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kValidByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(bytes.size()));
+          encoded_ptr += sizeof(Offset);
+          std::memcpy(encoded_ptr, bytes.data(), bytes.size());
+          encoded_ptr += bytes.size();
+        },
+        [&] {
+          auto& encoded_ptr = *encoded_bytes++;
+          *encoded_ptr++ = kNullByte;
+          util::SafeStore(encoded_ptr, static_cast<Offset>(0));
+          encoded_ptr += sizeof(Offset);
+        });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length,
+                                            MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_buf,
+                          DecodeNulls(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
+                          AllocateBuffer(sizeof(Offset) * (1 + length), pool));
+    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+    raw_offsets[0] = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const uint8_t* encoded_ptr = encoded_bytes[i] + kExtraByteForNull;
+      raw_offsets[i + 1] = raw_offsets[i] + util::SafeLoadAs<Offset>(encoded_ptr);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(raw_offsets[length], pool));
+    uint8_t* raw_keys = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      auto& encoded_ptr = encoded_bytes[i];
+      const Offset key_length = raw_offsets[i + 1] - raw_offsets[i];
+      encoded_ptr += kExtraByteForNull + sizeof(Offset);
+      std::memcpy(raw_keys + raw_offsets[i], encoded_ptr, key_length);
+      encoded_ptr += key_length;
+    }
+
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(offset_buf), std::move(key_buf)},
+        null_count);
+  }
+
+  static constexpr int kExtraByteForNull = 1;
+
+  std::shared_ptr<DataType> type_;
+};
+
+Result<std::unique_ptr<KeyEncoder>> MakeKeyEncoder(const std::shared_ptr<DataType>& type) {
+  if (type->id() == Type::BOOL) {
+    return ::arrow::internal::make_unique<BooleanKeyEncoder>();
+  }
+  if (type->id() == Type::DICTIONARY) {
+    return Status::NotImplemented("Keys of type ", *type);
+  }
+  if (is_fixed_width(type->id())) {
+    const int bit_width = checked_cast<const FixedWidthType&>(*type).bit_width();
+    if (bit_width > 0 && bit_width % 8 == 0) {
+      return ::arrow::internal::make_unique<FixedWidthKeyEncoder>(type);
+    }
+  }
+  if (type->id() == Type::BINARY || type->id() == Type::STRING) {
+    return ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(type);
+  }
+  if (type->id() == Type::LARGE_BINARY || type->id() == Type::LARGE_STRING) {
+    return ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(type);
+  }
+  return Status::NotImplemented("Keys of type ", *type);
+}
+
+// ----------------------------------------------------------------------
+// Grouper implementation
+
+class GrouperImpl : public Grouper {
+ public:
+  static Result<std::unique_ptr<GrouperImpl>> Make(const std::vector<ValueDescr>& keys,
+                                                   ExecContext* ctx) {
+    auto impl = ::arrow::internal::make_unique<GrouperImpl>(ctx);
+    impl->encoders_.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(impl->encoders_[i], MakeKeyEncoder(keys[i].type));
+    }
+    return std::move(impl);
+  }
+
+  explicit GrouperImpl(ExecContext* ctx) : ctx_(ctx), memo_table_(ctx->memory_pool()) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeBatch(batch));
+    const auto length = static_cast<int32_t>(batch.length);
+
+    // Look up each encoded row in the memo table
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(length));
+    for (int32_t i = 0; i < length; ++i) {
+      const uint8_t* key_data = key_bytes_batch_.data() + offsets_batch_[i];
+      const int32_t key_length = offsets_batch_[i + 1] - offsets_batch_[i];
+      int32_t group_id;
+      RETURN_NOT_OK(memo_table_.GetOrInsert(key_data, key_length, &group_id));
+      group_ids_batch.UnsafeAppend(static_cast<uint32_t>(group_id));
+    }
+
+    std::shared_ptr<Buffer> group_ids;
+    RETURN_NOT_OK(group_ids_batch.Finish(&group_ids));
+    return Datum(ArrayData::Make(uint32(), length, {nullptr, std::move(group_ids)}));
+  }
+
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeBatch(batch));
+    const auto length = static_cast<int32_t>(batch.length);
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
+    TypedBufferBuilder<bool> is_valid(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Resize(length));
+    RETURN_NOT_OK(is_valid.Resize(length));
+    int64_t null_count = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const uint8_t* key_data = key_bytes_batch_.data() + offsets_batch_[i];
+      const int32_t key_length = offsets_batch_[i + 1] - offsets_batch_[i];
+      const int32_t group_id = memo_table_.Get(key_data, key_length);
+      if (group_id == kKeyNotFound) {
+        group_ids_batch.UnsafeAppend(0);
+        is_valid.UnsafeAppend(false);
+        ++null_count;
+      } else {
+        group_ids_batch.UnsafeAppend(static_cast<uint32_t>(group_id));
+        is_valid.UnsafeAppend(true);
+      }
+    }
+
+    std::shared_ptr<Buffer> group_ids, null_bitmap;
+    RETURN_NOT_OK(group_ids_batch.Finish(&group_ids));
+    if (null_count > 0) {
+      RETURN_NOT_OK(is_valid.Finish(&null_bitmap));
+    }
+    return Datum(ArrayData::Make(uint32(), length,
+                                 {std::move(null_bitmap), std::move(group_ids)},
+                                 null_count));
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const auto length = static_cast<int32_t>(num_groups());
+    std::vector<const uint8_t*> key_buf_ptrs;
+    key_buf_ptrs.reserve(length);
+    memo_table_.VisitValues(0, [&](const util::string_view& key) {
+      key_buf_ptrs.push_back(reinterpret_cast<const uint8_t*>(key.data()));
+    });
+
+    ExecBatch out({}, length);
+    out.values.resize(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          out.values[i],
+          encoders_[i]->Decode(key_buf_ptrs.data(), length, ctx_->memory_pool()));
+    }
+    return out;
+  }
+
+ private:
+  // Encode each row of `batch` into key_bytes_batch_, delimited by offsets_batch_
+  Status EncodeBatch(const ExecBatch& batch) {
+    if (batch.num_values() != static_cast<int>(encoders_.size())) {
+      return Status::Invalid("Grouper expected ", encoders_.size(),
+                             " key columns but got ", batch.num_values());
+    }
+    if (batch.length > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Grouper can consume at most ",
+                                   std::numeric_limits<int32_t>::max(),
+                                   " rows per batch");
+    }
+    const auto length = static_cast<int32_t>(batch.length);
+
+    std::vector<std::shared_ptr<ArrayData>> keys(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      const Datum& value = batch[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto array, MakeArrayFromScalar(*value.scalar(), length, ctx_->memory_pool()));
+        keys[i] = array->data();
+      } else if (value.is_array()) {
+        keys[i] = value.array();
+      } else {
+        return Status::Invalid("Grouper expected arrays or scalars, got ",
+                               value.ToString());
+      }
+    }
+
+    // Compute the offset of each row's encoding in the batch's key buffer
+    offsets_batch_.clear();
+    offsets_batch_.resize(length + 1, 0);
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->AddLength(*keys[i], offsets_batch_.data());
+    }
+    int32_t total_length = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const int32_t row_length = offsets_batch_[i];
+      offsets_batch_[i] = total_length;
+      total_length += row_length;
+    }
+    offsets_batch_[length] = total_length;
+
+    // Encode the key columns, one column at a time
+    key_bytes_batch_.resize(total_length);
+    key_buf_ptrs_.resize(length);
+    for (int32_t i = 0; i < length; ++i) {
+      key_buf_ptrs_[i] = key_bytes_batch_.data() + offsets_batch_[i];
+    }
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      encoders_[i]->Encode(*keys[i], key_buf_ptrs_.data());
+    }
+    return Status::OK();
+  }
+
+  ExecContext* ctx_;
+  BinaryMemoTable<BinaryBuilder> memo_table_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+
+  // Scratch space reused across batches
+  std::vector<int32_t> offsets_batch_;
+  std::vector<uint8_t> key_bytes_batch_;
+  std::vector<uint8_t*> key_buf_ptrs_;
+};
+
+// ----------------------------------------------------------------------
+// Aggregator base
+
+struct GroupedAggregator : public KernelState {
+  virtual Status Resize(KernelContext* ctx, int64_t new_num_groups) = 0;
+
+  virtual Status Consume(KernelContext* ctx, const ExecBatch& batch) = 0;
+
+  virtual Status Merge(KernelContext* ctx, KernelState&& other,
+                       const ArrayData& group_id_mapping) = 0;
+
+  virtual Result<Datum> Finalize(KernelContext* ctx) = 0;
+
+  // Grow the per-group state to `new_num_groups`, returning the number of
+  // groups added
+  int64_t Grow(int64_t new_num_groups) {
+    DCHECK_GE(new_num_groups, num_groups_);
+    const int64_t added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return added_groups;
+  }
+
+  int64_t num_groups_ = 0;
+};
+
+void HashAggregateResize(KernelContext* ctx, int64_t num_groups) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Resize(ctx, num_groups));
+}
+
+void HashAggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Consume(ctx, batch));
+}
+
+void HashAggregateMerge(KernelContext* ctx, KernelState&& other,
+                        const ArrayData& group_id_mapping) {
+  KERNEL_RETURN_IF_ERROR(ctx, checked_cast<GroupedAggregator*>(ctx->state())
+                                  ->Merge(ctx, std::move(other), group_id_mapping));
+}
+
+void HashAggregateFinalize(KernelContext* ctx, Datum* out) {
+  KERNEL_ASSIGN_OR_RAISE(*out, ctx,
+                         checked_cast<GroupedAggregator*>(ctx->state())->Finalize(ctx));
+}
+
+template <typename Impl>
+std::unique_ptr<KernelState> HashAggregateInit(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  auto impl = ::arrow::internal::make_unique<Impl>();
+  ctx->SetStatus(impl->Init(ctx->exec_context(), args));
+  return std::move(impl);
+}
+
+HashAggregateKernel MakeKernel(InputType argument_type, OutputType out_type,
+                               KernelInit init) {
+  HashAggregateKernel kernel(
+      KernelSignature::Make({std::move(argument_type), InputType::Array(Type::UINT32)},
+                            std::move(out_type)),
+      std::move(init), HashAggregateResize, HashAggregateConsume, HashAggregateMerge,
+      HashAggregateFinalize);
+  return kernel;
+}
+
+// Build a validity bitmap for `num_groups` groups, where a group is valid
+// if its count is strictly greater than `min_count`.
+Result<std::shared_ptr<Buffer>> CountsToNullBitmap(const int64_t* counts,
+                                                   int64_t num_groups, int64_t min_count,
+                                                   MemoryPool* pool, int64_t* null_count) {
+  ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(num_groups, pool));
+  uint8_t* bitmap = null_bitmap->mutable_data();
+  *null_count = 0;
+  for (int64_t i = 0; i < num_groups; ++i) {
+    const bool valid = counts[i] > min_count;
+    BitUtil::SetBitTo(bitmap, i, valid);
+    *null_count += !valid;
+  }
+  if (*null_count == 0) {
+    return nullptr;
+  }
+  return std::move(null_bitmap);
+}
+
+// ----------------------------------------------------------------------
+// Count implementation
+
+struct GroupedCountImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) {
+    options_ = checked_cast<const CountOptions&>(*args.options);
+    counts_ = TypedBufferBuilder<int64_t>(ctx->memory_pool());
+    return Status::OK();
+  }
+
+  Status Resize(KernelContext*, int64_t new_num_groups) override {
+    return counts_.Append(Grow(new_num_groups), 0);
+  }
+
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const auto g = batch[1].array()->GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+
+    if (options_.count_mode == CountOptions::COUNT_NON_NULL) {
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length,
+          [&](int64_t i) { counts[g[i]] += 1; }, [] {});
+    } else if (input.GetNullCount() > 0) {
+      int64_t i = 0;
+      VisitBitBlocksVoid(
+          input.buffers[0], input.offset, input.length, [&](int64_t) { ++i; },
+          [&] { counts[g[i++]] += 1; });
+    }
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext*, KernelState&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+    const int64_t* other_counts = other->counts_.data();
+    int64_t* counts = counts_.mutable_data();
+    const auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize(KernelContext*) override {
+    std::shared_ptr<Buffer> counts;
+    RETURN_NOT_OK(counts_.Finish(&counts));
+    return Datum(ArrayData::Make(int64(), num_groups_, {nullptr, std::move(counts)}));
+  }
+
+  CountOptions options_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// ----------------------------------------------------------------------
+// Sum and Mean implementation
+
+// Like FindAccumulatorType, but booleans are summed as signed integers to
+// match the output type of the "sum" function.
+template <typename I, typename Enable = void>
+struct GroupedAccumulatorType {
+  using Type = typename FindAccumulatorType<I>::Type;
+};
+
+template <typename I>
+struct GroupedAccumulatorType<I, enable_if_boolean<I>> {
+  using Type = Int64Type;
+};
+
+template <typename Type>
+struct GroupedSumLikeImpl : public GroupedAggregator {
+  using AccType = typename GroupedAccumulatorType<Type>::Type;
+  using AccCType = typename TypeTraits<AccType>::CType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs&) {
+    pool_ = ctx->memory_pool();
+    sums_ = TypedBufferBuilder<AccCType>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(KernelContext*, int64_t new_num_groups) override {
+    const int64_t added_groups = Grow(new_num_groups);
+    RETURN_NOT_OK(sums_.Append(added_groups, 0));
+    return counts_.Append(added_groups, 0);
+  }
+
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    auto g = batch[1].array()->GetValues<uint32_t>(1);
+
+    VisitArrayValuesInline<Type>(
+        *batch[0].array(),
+        [&](typename GetViewType<Type>::T value) {
+          sums[*g] += static_cast<AccCType>(value);
+          counts[*g] += 1;
+          ++g;
+        },
+        [&] { ++g; });
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext*, KernelState&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumLikeImpl*>(&raw_other);
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    const AccCType* other_sums = other->sums_.data();
+    const int64_t* other_counts = other->counts_.data();
+
+    const auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sums[g[other_g]] += other_sums[other_g];
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  TypedBufferBuilder<AccCType> sums_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+template <typename Type>
+struct GroupedSumImpl : public GroupedSumLikeImpl<Type> {
+  using Base = GroupedSumLikeImpl<Type>;
+
+  Result<Datum> Finalize(KernelContext*) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToNullBitmap(this->counts_.data(), this->num_groups_,
+                                             /*min_count=*/0, this->pool_, &null_count));
+    std::shared_ptr<Buffer> sums;
+    RETURN_NOT_OK(this->sums_.Finish(&sums));
+    return Datum(ArrayData::Make(TypeTraits<typename Base::AccType>::type_singleton(),
+                                 this->num_groups_,
+                                 {std::move(null_bitmap), std::move(sums)}, null_count));
+  }
+};
+
+template <typename Type>
+struct GroupedMeanImpl : public GroupedSumLikeImpl<Type> {
+  Result<Datum> Finalize(KernelContext*) override {
+    const int64_t* counts = this->counts_.data();
+    const auto* sums = this->sums_.data();
+
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          CountsToNullBitmap(counts, this->num_groups_,
+                                             /*min_count=*/0, this->pool_, &null_count));
+    ARROW_ASSIGN_OR_RAISE(auto means,
+                          AllocateBuffer(this->num_groups_ * sizeof(double), this->pool_));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    for (int64_t i = 0; i < this->num_groups_; ++i) {
+      raw_means[i] = counts[i] > 0 ? static_cast<double>(sums[i]) / counts[i] : 0;
+    }
+    return Datum(ArrayData::Make(float64(), this->num_groups_,
+                                 {std::move(null_bitmap), std::move(means)}, null_count));
+  }
+};
+
+// ----------------------------------------------------------------------
+// MinMax implementation
+
+template <typename CType, typename Enable = void>
+struct MinMaxOp {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType anti_max() { return std::numeric_limits<CType>::min(); }
+  static CType min(CType a, CType b) { return std::min(a, b); }
+  static CType max(CType a, CType b) { return std::max(a, b); }
+};
+
+template <typename CType>
+struct MinMaxOp<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType anti_max() { return -std::numeric_limits<CType>::infinity(); }
+  // NaNs are ignored, as in the "min_max" function
+  static CType min(CType a, CType b) { return std::fmin(a, b); }
+  static CType max(CType a, CType b) { return std::fmax(a, b); }
+};
+
+template <typename Type>
+struct GroupedMinMaxImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+  using Op = MinMaxOp<CType>;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) {
+    options_ = checked_cast<const MinMaxOptions&>(*args.options);
+    type_ = args.inputs[0].type;
+    pool_ = ctx->memory_pool();
+    mins_ = TypedBufferBuilder<CType>(pool_);
+    maxes_ = TypedBufferBuilder<CType>(pool_);
+    has_values_ = TypedBufferBuilder<bool>(pool_);
+    has_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(KernelContext*, int64_t new_num_groups) override {
+    const int64_t added_groups = Grow(new_num_groups);
+    RETURN_NOT_OK(mins_.Append(added_groups, Op::anti_min()));
+    RETURN_NOT_OK(maxes_.Append(added_groups, Op::anti_max()));
+    RETURN_NOT_OK(has_values_.Append(added_groups, false));
+    return has_nulls_.Append(added_groups, false);
+  }
+
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    auto g = batch[1].array()->GetValues<uint32_t>(1);
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+
+    VisitArrayValuesInline<Type>(
+        *batch[0].array(),
+        [&](CType value) {
+          mins[*g] = Op::min(mins[*g], value);
+          maxes[*g] = Op::max(maxes[*g], value);
+          BitUtil::SetBit(has_values, *g++);
+        },
+        [&] { BitUtil::SetBit(has_nulls, *g++); });
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext*, KernelState&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+    const CType* other_mins = other->mins_.data();
+    const CType* other_maxes = other->maxes_.data();
+    const uint8_t* other_has_values = other->has_values_.data();
+    const uint8_t* other_has_nulls = other->has_nulls_.data();
+
+    const auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      mins[g[other_g]] = Op::min(mins[g[other_g]], other_mins[other_g]);
+      maxes[g[other_g]] = Op::max(maxes[g[other_g]], other_maxes[other_g]);
+      if (BitUtil::GetBit(other_has_values, other_g)) {
+        BitUtil::SetBit(has_values, g[other_g]);
+      }
+      if (BitUtil::GetBit(other_has_nulls, other_g)) {
+        BitUtil::SetBit(has_nulls, g[other_g]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize(KernelContext*) override {
+    // An emitted group is one with values, and, if nulls are to be emitted,
+    // without nulls
+    std::shared_ptr<Buffer> null_bitmap;
+    if (options_.null_handling == MinMaxOptions::EMIT_NULL) {
+      ARROW_ASSIGN_OR_RAISE(
+          null_bitmap, ::arrow::internal::BitmapAndNot(pool_, has_values_.data(), 0,
+                                                       has_nulls_.data(), 0,
+                                                       num_groups_, 0));
+    } else {
+      RETURN_NOT_OK(has_values_.Finish(&null_bitmap));
+    }
+    const int64_t null_count =
+        num_groups_ - ::arrow::internal::CountSetBits(null_bitmap->data(), 0, num_groups_);
+
+    std::shared_ptr<Buffer> mins, maxes;
+    RETURN_NOT_OK(mins_.Finish(&mins));
+    RETURN_NOT_OK(maxes_.Finish(&maxes));
+    auto mins_data = ArrayData::Make(type_, num_groups_, {null_bitmap, std::move(mins)},
+                                     null_count);
+    auto maxes_data = ArrayData::Make(
+        type_, num_groups_, {std::move(null_bitmap), std::move(maxes)}, null_count);
+
+    return ArrayData::Make(out_type(), num_groups_, {nullptr},
+                           {std::move(mins_data), std::move(maxes_data)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const {
+    return struct_({field("min", type_), field("max", type_)});
+  }
+
+  MinMaxOptions options_;
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  TypedBufferBuilder<CType> mins_, maxes_;
+  TypedBufferBuilder<bool> has_values_, has_nulls_;
+};
+
+// ----------------------------------------------------------------------
+// Variance and Stddev implementation
+
+enum class VarOrStd : bool { Var, Std };
+
+template <typename Type, VarOrStd kReturnType>
+struct GroupedVarStdImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) {
+    options_ = checked_cast<const VarianceOptions&>(*args.options);
+    pool_ = ctx->memory_pool();
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    means_ = TypedBufferBuilder<double>(pool_);
+    m2s_ = TypedBufferBuilder<double>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(KernelContext*, int64_t new_num_groups) override {
+    const int64_t added_groups = Grow(new_num_groups);
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    RETURN_NOT_OK(means_.Append(added_groups, 0));
+    return m2s_.Append(added_groups, 0);
+  }
+
+  // Welford's online algorithm, one value at a time
+  // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Welford's_online_algorithm
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    auto g = batch[1].array()->GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+    double* means = means_.mutable_data();
+    double* m2s = m2s_.mutable_data();
+
+    VisitArrayValuesInline<Type>(
+        *batch[0].array(),
+        [&](CType raw_value) {
+          const double value = static_cast<double>(raw_value);
+          const double delta = value - means[*g];
+          counts[*g] += 1;
+          means[*g] += delta / counts[*g];
+          m2s[*g] += delta * (value - means[*g]);
+          ++g;
+        },
+        [&] { ++g; });
+    return Status::OK();
+  }
+
+  // Combine `m2` from two groups (m2 = n*s2)
+  // https://www.emathzone.com/tutorials/basic-statistics/combined-variance.html
+  Status Merge(KernelContext*, KernelState&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedVarStdImpl*>(&raw_other);
+    int64_t* counts = counts_.mutable_data();
+    double* means = means_.mutable_data();
+    double* m2s = m2s_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const double* other_means = other->means_.data();
+    const double* other_m2s = other->m2s_.data();
+
+    const auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      const int64_t other_count = other_counts[other_g];
+      if (other_count == 0) continue;
+      const uint32_t this_g = g[other_g];
+      const int64_t count = counts[this_g];
+      if (count == 0) {
+        counts[this_g] = other_count;
+        means[this_g] = other_means[other_g];
+        m2s[this_g] = other_m2s[other_g];
+        continue;
+      }
+      const double mean =
+          (means[this_g] * count + other_means[other_g] * other_count) /
+          (count + other_count);
+      m2s[this_g] += other_m2s[other_g] +
+                     count * (means[this_g] - mean) * (means[this_g] - mean) +
+                     other_count * (other_means[other_g] - mean) *
+                         (other_means[other_g] - mean);
+      counts[this_g] += other_count;
+      means[this_g] = mean;
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize(KernelContext*) override {
+    const int64_t* counts = counts_.data();
+    const double* m2s = m2s_.data();
+
+    // Not enough non-null values in a group to satisfy `ddof` results in null
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(
+        auto null_bitmap,
+        CountsToNullBitmap(counts, num_groups_, options_.ddof, pool_, &null_count));
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateBuffer(num_groups_ * sizeof(double), pool_));
+    auto raw_values = reinterpret_cast<double*>(values->mutable_data());
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (counts[i] <= options_.ddof) {
+        raw_values[i] = 0;
+        continue;
+      }
+      const double var = m2s[i] / (counts[i] - options_.ddof);
+      raw_values[i] = kReturnType == VarOrStd::Var ? var : std::sqrt(var);
+    }
+    return Datum(ArrayData::Make(float64(), num_groups_,
+                                 {std::move(null_bitmap), std::move(values)}, null_count));
+  }
+
+  VarianceOptions options_;
+  MemoryPool* pool_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<double> means_, m2s_;
+};
+
+// ----------------------------------------------------------------------
+// Any and All implementation
+
+template <bool kIsAny>
+struct GroupedBooleanImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs&) {
+    pool_ = ctx->memory_pool();
+    results_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  // "any" starts at false and "all" at true, so that empty groups (or groups
+  // with only nulls) give the identity of the reduction
+  Status Resize(KernelContext*, int64_t new_num_groups) override {
+    return results_.Append(Grow(new_num_groups), !kIsAny);
+  }
+
+  Status Consume(KernelContext*, const ExecBatch& batch) override {
+    auto g = batch[1].array()->GetValues<uint32_t>(1);
+    uint8_t* results = results_.mutable_data();
+
+    VisitArrayValuesInline<BooleanType>(
+        *batch[0].array(),
+        [&](bool value) {
+          if (value == kIsAny) {
+            BitUtil::SetBitTo(results, *g, kIsAny);
+          }
+          ++g;
+        },
+        [&] { ++g; });
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext*, KernelState&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedBooleanImpl*>(&raw_other);
+    uint8_t* results = results_.mutable_data();
+    const uint8_t* other_results = other->results_.data();
+
+    const auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      if (BitUtil::GetBit(other_results, other_g) == kIsAny) {
+        BitUtil::SetBitTo(results, g[other_g], kIsAny);
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize(KernelContext*) override {
+    std::shared_ptr<Buffer> results;
+    RETURN_NOT_OK(results_.Finish(&results));
+    return Datum(ArrayData::Make(boolean(), num_groups_, {nullptr, std::move(results)},
+                                 /*null_count=*/0));
+  }
+
+  MemoryPool* pool_;
+  TypedBufferBuilder<bool> results_;
+};
+
+using GroupedAnyImpl = GroupedBooleanImpl<true>;
+using GroupedAllImpl = GroupedBooleanImpl<false>;
+
+// ----------------------------------------------------------------------
+// Kernel registration helpers
+
+// Only sum and mean accept boolean input
+template <template <typename> class Impl>
+struct AcceptsBoolean : std::false_type {};
+
+template <>
+struct AcceptsBoolean<GroupedSumImpl> : std::true_type {};
+
+template <>
+struct AcceptsBoolean<GroupedMeanImpl> : std::true_type {};
+
+// Generate a HashAggregateKernel for each numeric input type, instantiating
+// Impl<ArgType> as the kernel state
+template <template <typename> class Impl>
+struct GroupedNumericKernelsFactory {
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing ", name, " of data of type ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing ", name, " of data of type ", type);
+  }
+
+  template <typename T>
+  enable_if_t<is_number_type<T>::value ||
+                  (is_boolean_type<T>::value && AcceptsBoolean<Impl>::value),
+              Status>
+  Visit(const T&) {
+    kernel = MakeKernel(InputType::Array(argument_type), out_type,
+                        HashAggregateInit<Impl<T>>);
+    return Status::OK();
+  }
+
+  Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    argument_type = type;
+    RETURN_NOT_OK(VisitTypeInline(*type, this));
+    return std::move(kernel);
+  }
+
+  std::string name;
+  OutputType out_type;
+  std::shared_ptr<DataType> argument_type;
+  HashAggregateKernel kernel;
+};
+
+template <template <typename> class Impl>
+void AddGroupedNumericKernels(const std::vector<std::shared_ptr<DataType>>& types,
+                              OutputType out_type, HashAggregateFunction* func) {
+  GroupedNumericKernelsFactory<Impl> factory{func->name(), std::move(out_type)};
+  for (const auto& ty : types) {
+    DCHECK_OK(func->AddKernel(factory.Make(ty).ValueOrDie()));
+  }
+}
+
+template <typename T>
+using GroupedVarianceImpl = GroupedVarStdImpl<T, VarOrStd::Var>;
+
+template <typename T>
+using GroupedStddevImpl = GroupedVarStdImpl<T, VarOrStd::Std>;
+
+Result<ValueDescr> MinMaxType(KernelContext*, const std::vector<ValueDescr>& descrs) {
+  auto ty = descrs[0].type;
+  return ValueDescr::Array(struct_({field("min", ty), field("max", ty)}));
+}
+
+const FunctionDoc hash_count_doc{"Count the number of null / non-null values",
+                                 ("By default, non-null values are counted.\n"
+                                  "This can be changed through CountOptions."),
+                                 {"array", "group_id_array"},
+                                 "CountOptions"};
+
+const FunctionDoc hash_sum_doc{"Sum values of a numeric array",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array"}};
+
+const FunctionDoc hash_mean_doc{"Compute the mean of a numeric array",
+                                ("Null values are ignored. The result is always computed\n"
+                                 "as a double, regardless of the input types"),
+                                {"array", "group_id_array"}};
+
+const FunctionDoc hash_min_max_doc{
+    "Compute the minimum and maximum values of a numeric array",
+    ("Null values are ignored by default.\n"
+     "This can be changed through MinMaxOptions."),
+    {"array", "group_id_array"},
+    "MinMaxOptions"};
+
+const FunctionDoc hash_variance_doc{
+    "Calculate the variance of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population variance is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned."),
+    {"array", "group_id_array"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_stddev_doc{
+    "Calculate the standard deviation of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population standard deviation is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned."),
+    {"array", "group_id_array"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_any_doc{"Test whether any element evaluates to true",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array"}};
+
+const FunctionDoc hash_all_doc{"Test whether all elements evaluate to true",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array"}};
+
+// ----------------------------------------------------------------------
+// GroupBy
+
+// The state accumulated by one task of a GroupBy: a Grouper for the keys,
+// and one kernel state per aggregate
+struct GroupByState {
+  std::unique_ptr<Grouper> grouper;
+  std::vector<std::unique_ptr<KernelState>> states;
+  std::vector<std::unique_ptr<KernelContext>> contexts;
+};
+
+Result<std::vector<const HashAggregateKernel*>> GetKernels(
+    ExecContext* ctx, const std::vector<Aggregate>& aggregates,
+    const std::vector<ValueDescr>& in_descrs,
+    std::vector<const FunctionOptions*>* options) {
+  if (aggregates.size() != in_descrs.size()) {
+    return Status::Invalid(aggregates.size(), " aggregate functions were specified but ",
+                           in_descrs.size(), " arguments were provided.");
+  }
+
+  std::vector<const HashAggregateKernel*> kernels(in_descrs.size());
+  options->resize(in_descrs.size());
+
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not an aggregate function suitable for GroupBy");
+    }
+    const ValueDescr argument_descr = ValueDescr::Array(in_descrs[i].type);
+    ARROW_ASSIGN_OR_RAISE(
+        const Kernel* kernel,
+        function->DispatchExact({argument_descr, ValueDescr::Array(uint32())}));
+    kernels[i] = static_cast<const HashAggregateKernel*>(kernel);
+    (*options)[i] = aggregates[i].options ? aggregates[i].options
+                                          : function->default_options();
+  }
+  return kernels;
+}
+
+Status InitGroupByState(ExecContext* ctx,
+                        const std::vector<const HashAggregateKernel*>& kernels,
+                        const std::vector<const FunctionOptions*>& options,
+                        const std::vector<ValueDescr>& in_descrs,
+                        const std::vector<ValueDescr>& key_descrs, GroupByState* out) {
+  ARROW_ASSIGN_OR_RAISE(out->grouper, Grouper::Make(key_descrs, ctx));
+
+  out->states.resize(kernels.size());
+  out->contexts.resize(kernels.size());
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    const std::vector<ValueDescr> inputs = {ValueDescr::Array(in_descrs[i].type),
+                                            ValueDescr::Array(uint32())};
+    out->contexts[i] = ::arrow::internal::make_unique<KernelContext>(ctx);
+    KernelContext* kernel_ctx = out->contexts[i].get();
+    out->states[i] = kernels[i]->init(kernel_ctx, {kernels[i], inputs, options[i]});
+    RETURN_NOT_OK(kernel_ctx->status());
+    kernel_ctx->SetState(out->states[i].get());
+  }
+  return Status::OK();
+}
+
+Status ConsumeGroupByBatch(ExecContext* ctx,
+                           const std::vector<const HashAggregateKernel*>& kernels,
+                           const ExecBatch& batch, GroupByState* state) {
+  const size_t num_arguments = kernels.size();
+
+  ExecBatch key_batch({}, batch.length);
+  key_batch.values.assign(batch.values.begin() + num_arguments, batch.values.end());
+  ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
+
+  for (size_t i = 0; i < num_arguments; ++i) {
+    Datum argument = batch[i];
+    if (argument.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*argument.scalar(),
+                                                            batch.length,
+                                                            ctx->memory_pool()));
+      argument = std::move(array);
+    }
+    KernelContext* kernel_ctx = state->contexts[i].get();
+    kernels[i]->resize(kernel_ctx, state->grouper->num_groups());
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    kernels[i]->consume(kernel_ctx, ExecBatch({std::move(argument), id_batch},
+                                              batch.length));
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+  }
+  return Status::OK();
+}
+
+// Merge the partial aggregates of `other` into `state`
+Status MergeGroupByState(const std::vector<const HashAggregateKernel*>& kernels,
+                         GroupByState&& other, GroupByState* state) {
+  // Feed the other task's unique keys through this task's grouper, which
+  // yields the mapping from the other task's group ids to ours
+  ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, other.grouper->GetUniques());
+  ARROW_ASSIGN_OR_RAISE(Datum transposition, state->grouper->Consume(other_keys));
+
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = state->contexts[i].get();
+    kernels[i]->resize(kernel_ctx, state->grouper->num_groups());
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    kernels[i]->merge(kernel_ctx, std::move(*other.states[i]), *transposition.array());
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+  }
+  return Status::OK();
+}
+
+Result<Datum> GroupByImpl(const std::vector<Datum>& arguments,
+                          const std::vector<Datum>& keys,
+                          const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key");
+  }
+
+  std::vector<Datum> args = arguments;
+  args.insert(args.end(), keys.begin(), keys.end());
+  RETURN_NOT_OK(::arrow::compute::detail::CheckAllValues(args));
+
+  std::vector<ValueDescr> in_descrs, key_descrs;
+  for (const Datum& argument : arguments) {
+    in_descrs.push_back(argument.descr());
+  }
+  for (const Datum& key : keys) {
+    key_descrs.push_back(ValueDescr::Array(key.type()));
+  }
+
+  std::vector<const FunctionOptions*> options;
+  ARROW_ASSIGN_OR_RAISE(auto kernels, GetKernels(ctx, aggregates, in_descrs, &options));
+
+  // Split the input into batches; these are distributed round-robin over the
+  // tasks, each of which accumulates its own partial state
+  ARROW_ASSIGN_OR_RAISE(auto batch_iterator,
+                        ::arrow::compute::detail::ExecBatchIterator::Make(
+                            args, ctx->exec_chunksize()));
+  std::vector<ExecBatch> batches;
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length > 0) {
+      batches.push_back(std::move(batch));
+    }
+  }
+
+  int num_tasks = 1;
+  if (ctx->use_threads()) {
+    num_tasks = std::min(static_cast<int>(batches.size()),
+                         GetCpuThreadPoolCapacity());
+    num_tasks = std::max(num_tasks, 1);
+  }
+
+  std::vector<GroupByState> states(num_tasks);
+  for (auto& state : states) {
+    RETURN_NOT_OK(InitGroupByState(ctx, kernels, options, in_descrs, key_descrs, &state));
+  }
+
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      num_tasks > 1, num_tasks, [&](int task) {
+        for (size_t i = task; i < batches.size(); i += num_tasks) {
+          RETURN_NOT_OK(ConsumeGroupByBatch(ctx, kernels, batches[i], &states[task]));
+        }
+        return Status::OK();
+      }));
+
+  GroupByState& state = states[0];
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(MergeGroupByState(kernels, std::move(states[task]), &state));
+  }
+
+  // Finalize the aggregates, then append the unique keys
+  ArrayDataVector out_data(arguments.size());
+  FieldVector out_fields(arguments.size());
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    KernelContext* kernel_ctx = state.contexts[i].get();
+    // Groups may have been introduced by another aggregate's batches
+    kernels[i]->resize(kernel_ctx, state.grouper->num_groups());
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    Datum out;
+    kernels[i]->finalize(kernel_ctx, &out);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    out_data[i] = out.array();
+    out_fields[i] = field(aggregates[i].function, out.type());
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, state.grouper->GetUniques());
+  for (size_t i = 0; i < out_keys.values.size(); ++i) {
+    out_data.push_back(out_keys.values[i].array());
+    out_fields.push_back(field("key_" + std::to_string(i), out_keys.values[i].type()));
+  }
+
+  const auto num_groups = static_cast<int64_t>(state.grouper->num_groups());
+  return ArrayData::Make(struct_(std::move(out_fields)), num_groups, {nullptr},
+                         std::move(out_data), /*null_count=*/0);
+}
+
+}  // namespace
+
+Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx) {
+  if (ctx == nullptr) {
+    static ExecContext default_ctx;
+    ctx = &default_ctx;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, GrouperImpl::Make(descrs, ctx));
+  return std::unique_ptr<Grouper>(std::move(impl));
+}
+
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return GroupByImpl(arguments, keys, aggregates, &default_ctx);
+  }
+  return GroupByImpl(arguments, keys, aggregates, ctx);
+}
+
+void RegisterHashAggregateBasic(FunctionRegistry* registry) {
+  {
+    static auto default_count_options = CountOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_count", Arity::Binary(), &hash_count_doc, &default_count_options);
+    DCHECK_OK(func->AddKernel(MakeKernel(InputType(ValueDescr::ARRAY), int64(),
+                                         HashAggregateInit<GroupedCountImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_sum", Arity::Binary(),
+                                                        &hash_sum_doc);
+    AddGroupedNumericKernels<GroupedSumImpl>({boolean()}, int64(), func.get());
+    AddGroupedNumericKernels<GroupedSumImpl>(SignedIntTypes(), int64(), func.get());
+    AddGroupedNumericKernels<GroupedSumImpl>(UnsignedIntTypes(), uint64(), func.get());
+    AddGroupedNumericKernels<GroupedSumImpl>(FloatingPointTypes(), float64(),
+                                             func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Binary(),
+                                                        &hash_mean_doc);
+    AddGroupedNumericKernels<GroupedMeanImpl>({boolean()}, float64(), func.get());
+    AddGroupedNumericKernels<GroupedMeanImpl>(NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_minmax_options = MinMaxOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_min_max", Arity::Binary(), &hash_min_max_doc, &default_minmax_options);
+    AddGroupedNumericKernels<GroupedMinMaxImpl>(NumericTypes(), OutputType(MinMaxType),
+                                                func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_variance_options = VarianceOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_variance", Arity::Binary(), &hash_variance_doc, &default_variance_options);
+    AddGroupedNumericKernels<GroupedVarianceImpl>(NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+
+    func = std::make_shared<HashAggregateFunction>(
+        "hash_stddev", Arity::Binary(), &hash_stddev_doc, &default_variance_options);
+    AddGroupedNumericKernels<GroupedStddevImpl>(NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_any", Arity::Binary(),
+                                                        &hash_any_doc);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(boolean(), boolean(), HashAggregateInit<GroupedAnyImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+
+    func = std::make_shared<HashAggregateFunction>("hash_all", Arity::Binary(),
+                                                   &hash_all_doc);
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(boolean(), boolean(), HashAggregateInit<GroupedAllImpl>)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
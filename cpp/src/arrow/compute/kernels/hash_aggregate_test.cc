@@ -0,0 +1,391 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+using internal::Aggregate;
+using internal::GroupBy;
+using internal::Grouper;
+
+namespace {
+
+void ValidateGroupBy(const std::vector<Aggregate>& aggregates,
+                     const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                     const std::shared_ptr<DataType>& out_type,
+                     const std::string& expected_json, ExecContext* ctx = nullptr) {
+  ASSERT_OK_AND_ASSIGN(Datum actual, GroupBy(arguments, keys, aggregates, ctx));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertDatumsEqual(ArrayFromJSON(out_type, expected_json), actual,
+                    /*verbose=*/true);
+}
+
+}  // namespace
+
+TEST(Grouper, SupportedKeys) {
+  ASSERT_OK(Grouper::Make({boolean()}));
+
+  ASSERT_OK(Grouper::Make({int8()}));
+  ASSERT_OK(Grouper::Make({uint16()}));
+  ASSERT_OK(Grouper::Make({int32()}));
+  ASSERT_OK(Grouper::Make({uint64()}));
+  ASSERT_OK(Grouper::Make({float64()}));
+
+  ASSERT_OK(Grouper::Make({timestamp(TimeUnit::MILLI)}));
+  ASSERT_OK(Grouper::Make({decimal(32, 10)}));
+  ASSERT_OK(Grouper::Make({fixed_size_binary(7)}));
+
+  ASSERT_OK(Grouper::Make({utf8()}));
+  ASSERT_OK(Grouper::Make({large_binary()}));
+
+  ASSERT_OK(Grouper::Make({int32(), utf8(), boolean()}));
+
+  ASSERT_RAISES(NotImplemented, Grouper::Make({dictionary(int32(), utf8())}));
+  ASSERT_RAISES(NotImplemented, Grouper::Make({list(int32())}));
+}
+
+TEST(Grouper, NumericKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({int64()}));
+
+  ExecBatch batch({ArrayFromJSON(int64(), "[3, 7, 3, null, 7, 11, null]")}, 7);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 0, 2, 1, 3, 2]"), ids);
+  ASSERT_EQ(grouper->num_groups(), 4);
+
+  // Previously seen keys keep their group ids across batches
+  batch = ExecBatch({ArrayFromJSON(int64(), "[11, 5, 3]")}, 3);
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(batch));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[3, 4, 0]"), ids);
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(uniques.num_values(), 1);
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[3, 7, null, 11, 5]"), uniques[0]);
+}
+
+TEST(Grouper, BooleanKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({boolean()}));
+
+  ExecBatch batch({ArrayFromJSON(boolean(), "[true, false, null, false, true]")}, 5);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 2, 1, 0]"), ids);
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[true, false, null]"), uniques[0]);
+}
+
+TEST(Grouper, StringKey) {
+  for (auto ty : {utf8(), large_utf8()}) {
+    ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ty}));
+
+    ExecBatch batch({ArrayFromJSON(ty, R"(["eh", "", null, "bee", "eh", ""])")}, 6);
+    ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+    AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 2, 3, 0, 1]"), ids);
+
+    ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+    AssertDatumsEqual(ArrayFromJSON(ty, R"(["eh", "", null, "bee"])"), uniques[0]);
+  }
+}
+
+TEST(Grouper, MultipleKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({int32(), utf8()}));
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[0, 0, 1, null, 0, null]"),
+                   ArrayFromJSON(utf8(), R"(["ex", "why", "ex", "ex", "ex", "ex"])")},
+                  6);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 2, 3, 0, 3]"), ids);
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(uniques.num_values(), 2);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[0, 0, 1, null]"), uniques[0]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["ex", "why", "ex", "ex"])"), uniques[1]);
+}
+
+TEST(Grouper, SlicedKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({int16(), utf8()}));
+
+  auto ints = ArrayFromJSON(int16(), "[9, 1, null, 1, 2, 9]")->Slice(1, 4);
+  auto strs = ArrayFromJSON(utf8(), R"(["z", "a", "b", "a", "a", "z"])")->Slice(1, 4);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecBatch({ints, strs}, 4)));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 0, 2]"), ids);
+}
+
+TEST(Grouper, ScalarKey) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({int32(), utf8()}));
+
+  ExecBatch batch({ArrayFromJSON(int32(), "[0, 1, 0]"), MakeScalar("ex")}, 3);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, 0]"), ids);
+}
+
+TEST(GroupBy, Errors) {
+  auto argument = ArrayFromJSON(float64(), "[1.0, 2.0]");
+  auto key = ArrayFromJSON(int64(), "[1, 2]");
+
+  // Not a hash aggregate function
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {key}, {{"sum", nullptr}}));
+  // Argument / aggregate count mismatch
+  ASSERT_RAISES(Invalid, GroupBy({argument, argument}, {key}, {{"hash_sum", nullptr}}));
+  // No keys
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {}, {{"hash_sum", nullptr}}));
+  // No kernel for the argument type
+  ASSERT_RAISES(NotImplemented,
+                GroupBy({ArrayFromJSON(utf8(), R"(["a", "b"])")}, {key},
+                        {{"hash_sum", nullptr}}));
+  // Hash aggregates can't be executed directly
+  ASSERT_RAISES(NotImplemented, CallFunction("hash_sum", {argument, key}));
+}
+
+TEST(GroupBy, SumOnly) {
+  auto argument = ArrayFromJSON(float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25, 0.75]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 3, null, 1, 2, 2, null]");
+
+  ValidateGroupBy({{"hash_sum", nullptr}}, {argument}, {key},
+                  struct_({field("hash_sum", float64()), field("key_0", int64())}),
+                  R"([
+    {"hash_sum": 4.25,   "key_0": 1},
+    {"hash_sum": -0.125, "key_0": 2},
+    {"hash_sum": null,   "key_0": 3},
+    {"hash_sum": 4.75,   "key_0": null}
+  ])");
+}
+
+TEST(GroupBy, CountSumMeanMinMax) {
+  auto argument = ArrayFromJSON(int32(), "[1, 0, null, 4, 3, null, -2, 7, null, 6]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 3, null, 1, 2, 2, null, 3, 1]");
+
+  CountOptions count_null(CountOptions::COUNT_NULL);
+  MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+
+  auto min_max_type = struct_({field("min", int32()), field("max", int32())});
+  ValidateGroupBy(
+      {
+          {"hash_count", nullptr},
+          {"hash_count", &count_null},
+          {"hash_sum", nullptr},
+          {"hash_mean", nullptr},
+          {"hash_min_max", nullptr},
+          {"hash_min_max", &emit_null},
+      },
+      {argument, argument, argument, argument, argument, argument}, {key},
+      struct_({
+          field("hash_count", int64()),
+          field("hash_count", int64()),
+          field("hash_sum", int64()),
+          field("hash_mean", float64()),
+          field("hash_min_max", min_max_type),
+          field("hash_min_max", min_max_type),
+          field("key_0", int64()),
+      }),
+      R"([
+    [3, 0, 10,   3.3333333333333335, {"min": 1,    "max": 6},    {"min": 1,    "max": 6},    1],
+    [2, 1, -2,   -1.0,               {"min": -2,   "max": 0},    {"min": null, "max": null}, 2],
+    [0, 2, null, null,               {"min": null, "max": null}, {"min": null, "max": null}, 3],
+    [2, 0, 11,   5.5,                {"min": 4,    "max": 7},    {"min": 4,    "max": 7},    null]
+  ])");
+}
+
+TEST(GroupBy, BooleanSumMean) {
+  auto argument = ArrayFromJSON(boolean(), "[true, false, null, true, true, false]");
+  auto key = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", "b", "c"])");
+
+  ValidateGroupBy({{"hash_sum", nullptr}, {"hash_mean", nullptr}}, {argument, argument},
+                  {key},
+                  struct_({field("hash_sum", int64()), field("hash_mean", float64()),
+                           field("key_0", utf8())}),
+                  R"([
+    [2, 1.0, "a"],
+    [1, 0.5, "b"],
+    [0, 0.0, "c"]
+  ])");
+}
+
+TEST(GroupBy, MinMaxFloatingPoint) {
+  for (auto ty : {float32(), float64()}) {
+    auto argument = ArrayFromJSON(ty, "[1.5, NaN, -2.5, null, Inf, 0.5]");
+    auto key = ArrayFromJSON(int8(), "[1, 1, 1, 2, 3, 3]");
+
+    auto min_max_type = struct_({field("min", ty), field("max", ty)});
+    ValidateGroupBy({{"hash_min_max", nullptr}}, {argument}, {key},
+                    struct_({field("hash_min_max", min_max_type), field("key_0", int8())}),
+                    R"([
+    [{"min": -2.5, "max": 1.5}, 1],
+    [{"min": null, "max": null}, 2],
+    [{"min": 0.5, "max": Inf}, 3]
+  ])");
+  }
+}
+
+TEST(GroupBy, VarianceAndStddev) {
+  auto argument = ArrayFromJSON(int32(), "[1, null, 3, 4, 2, 4, 6, null, 9]");
+  auto key = ArrayFromJSON(int64(), "[1, 1, 1, 2, 2, 2, 3, 3, 4]");
+
+  VarianceOptions ddof1(/*ddof=*/1);
+
+  ValidateGroupBy({{"hash_variance", nullptr},
+                   {"hash_stddev", nullptr},
+                   {"hash_variance", &ddof1}},
+                  {argument, argument, argument}, {key},
+                  struct_({field("hash_variance", float64()),
+                           field("hash_stddev", float64()),
+                           field("hash_variance", float64()), field("key_0", int64())}),
+                  R"([
+    [1.0,                1.0,                2.0,  1],
+    [0.8888888888888888, 0.9428090415820634, 1.3333333333333333, 2],
+    [0.0,                0.0,                null, 3],
+    [0.0,                0.0,                null, 4]
+  ])");
+}
+
+TEST(GroupBy, AnyAndAll) {
+  auto argument = ArrayFromJSON(
+      boolean(), "[true, null, false, null, false, true, null, true, false, null]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 1, 3, 2, 1, 2, 4, 4, 5]");
+
+  ValidateGroupBy({{"hash_any", nullptr}, {"hash_all", nullptr}}, {argument, argument},
+                  {key},
+                  struct_({field("hash_any", boolean()), field("hash_all", boolean()),
+                           field("key_0", int64())}),
+                  R"([
+    [true,  false, 1],
+    [false, false, 2],
+    [false, true,  3],
+    [true,  false, 4],
+    [false, true,  5]
+  ])");
+}
+
+TEST(GroupBy, MultipleKeys) {
+  auto argument = ArrayFromJSON(int64(), "[1, 2, 3, 4, 5, 6]");
+  auto key0 = ArrayFromJSON(int32(), "[0, 0, 1, 0, null, null]");
+  auto key1 = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", null, null])");
+
+  ValidateGroupBy({{"hash_sum", nullptr}}, {argument}, {key0, key1},
+                  struct_({field("hash_sum", int64()), field("key_0", int32()),
+                           field("key_1", utf8())}),
+                  R"([
+    [5,  0,    "a"],
+    [2,  0,    "b"],
+    [3,  1,    "a"],
+    [11, null, null]
+  ])");
+}
+
+TEST(GroupBy, ChunkedInput) {
+  auto argument = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[3, 4, 5]", "[6]"});
+  auto key = ChunkedArrayFromJSON(int64(), {"[1]", "[2, 1, 2]", "[3, 3]"});
+
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ctx.set_exec_chunksize(2);
+    ValidateGroupBy({{"hash_sum", nullptr}, {"hash_count", nullptr}},
+                    {argument, argument}, {key},
+                    struct_({field("hash_sum", int64()), field("hash_count", int64()),
+                             field("key_0", int64())}),
+                    R"([
+    [4,  2, 1],
+    [6,  2, 2],
+    [11, 2, 3]
+  ])",
+                    &ctx);
+  }
+}
+
+TEST(GroupBy, RandomParallelMatchesSerial) {
+  constexpr int64_t kLength = 10000;
+  random::RandomArrayGenerator rng(42);
+  auto argument = rng.Float64(kLength, -100, 100, /*null_probability=*/0.1);
+  auto key = rng.Int64(kLength, 0, 50, /*null_probability=*/0.05);
+
+  const std::vector<Aggregate> aggregates = {{"hash_count", nullptr},
+                                             {"hash_sum", nullptr},
+                                             {"hash_min_max", nullptr},
+                                             {"hash_variance", nullptr}};
+  const std::vector<Datum> arguments = {argument, argument, argument, argument};
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(Datum serial, GroupBy(arguments, {key}, aggregates, &serial_ctx));
+
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+  parallel_ctx.set_exec_chunksize(kLength / 16);
+  ASSERT_OK_AND_ASSIGN(Datum parallel,
+                       GroupBy(arguments, {key}, aggregates, &parallel_ctx));
+  ASSERT_OK(parallel.make_array()->ValidateFull());
+
+  // Group order may differ between the two, so match groups by key
+  auto serial_struct = checked_pointer_cast<StructArray>(serial.make_array());
+  auto parallel_struct = checked_pointer_cast<StructArray>(parallel.make_array());
+  ASSERT_EQ(serial_struct->length(), parallel_struct->length());
+
+  auto serial_keys = serial_struct->GetFieldByName("key_0");
+  std::map<std::string, int64_t> serial_rows;
+  for (int64_t i = 0; i < serial_keys->length(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto key_scalar, serial_keys->GetScalar(i));
+    serial_rows[key_scalar->ToString()] = i;
+  }
+
+  auto parallel_keys = parallel_struct->GetFieldByName("key_0");
+  for (int64_t i = 0; i < parallel_keys->length(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto key_scalar, parallel_keys->GetScalar(i));
+    const int64_t serial_row = serial_rows.at(key_scalar->ToString());
+    // Floating point sums depend on the order in which chunks are merged
+    for (int field = 0; field < 3; ++field) {
+      ASSERT_OK_AND_ASSIGN(auto expected,
+                           serial_struct->field(field)->GetScalar(serial_row));
+      ASSERT_OK_AND_ASSIGN(auto actual, parallel_struct->field(field)->GetScalar(i));
+      AssertScalarsApproxEqual(*expected, *actual, /*verbose=*/true);
+    }
+    // Variance merges are subject to floating point rounding
+    ASSERT_OK_AND_ASSIGN(auto expected, serial_struct->field(3)->GetScalar(serial_row));
+    ASSERT_OK_AND_ASSIGN(auto actual, parallel_struct->field(3)->GetScalar(i));
+    ASSERT_EQ(expected->is_valid, actual->is_valid);
+    if (expected->is_valid) {
+      ASSERT_NEAR(checked_cast<const DoubleScalar&>(*expected).value,
+                  checked_cast<const DoubleScalar&>(*actual).value, 1e-6);
+    }
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -270,7 +270,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary(), doc);
   for (const auto& ty : NumericTypes()) {
     auto exec = NumericEqualTypesBinary<ScalarBinaryEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {ty, ty}, ty, exec));
   }
   return func;
 }
@@ -283,7 +283,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name,
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary(), doc);
   for (const auto& ty : NumericTypes()) {
     auto exec = NumericEqualTypesBinary<ScalarBinaryNotNullEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {ty, ty}, ty, exec));
   }
   return func;
 }
@@ -359,7 +359,8 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
     InputType in_type(match::TimestampTypeUnit(unit));
     auto exec =
         NumericEqualTypesBinary<ScalarBinaryEqualTypes, Subtract>(Type::TIMESTAMP);
-    DCHECK_OK(subtract->AddKernel({in_type, in_type}, duration(unit), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(subtract.get(), {in_type, in_type}, duration(unit),
+                                      std::move(exec)));
   }
 
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
@@ -15,16 +15,19 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <array>
 
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/bitmap_writer.h"
 
 namespace arrow {
 
 using internal::Bitmap;
+using internal::FirstTimeBitmapWriter;
 
 namespace compute {
 
@@ -103,6 +106,7 @@ struct Invert {
   static void Call(KernelContext* ctx, const ArrayData& in, ArrayData* out) {
     GetBitmap(*out, 1).CopyFromInverted(GetBitmap(in, 1));
   }
+  static uint64_t ComputeWord(uint64_t value) { return ~value; }
 };
 
 template <typename Op>
@@ -140,6 +144,8 @@ struct And : Commutative<And> {
                                  right.buffers[1]->data(), right.offset, right.length,
                                  out->offset, out->buffers[1]->mutable_data());
   }
+
+  static uint64_t ComputeWord(uint64_t left, uint64_t right) { return left & right; }
 };
 
 struct KleeneAnd : Commutative<KleeneAnd> {
@@ -186,13 +192,13 @@ struct KleeneAnd : Commutative<KleeneAnd> {
       GetBitmap(*out, 0).SetBitsTo(true);
       return And::Call(ctx, left, right, out);
     }
-    auto compute_word = [](uint64_t left_true, uint64_t left_false, uint64_t right_true,
-                           uint64_t right_false, uint64_t* out_valid,
-                           uint64_t* out_data) {
-      *out_data = left_true & right_true;
-      *out_valid = left_false | right_false | (left_true & right_true);
-    };
-    ComputeKleene(compute_word, ctx, left, right, out);
+    ComputeKleene(ComputeWord, ctx, left, right, out);
+  }
+
+  static void ComputeWord(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                          uint64_t right_false, uint64_t* out_valid, uint64_t* out_data) {
+    *out_data = left_true & right_true;
+    *out_valid = left_false | right_false | (left_true & right_true);
   }
 };
 
@@ -223,6 +229,8 @@ struct Or : Commutative<Or> {
                                 right.buffers[1]->data(), right.offset, right.length,
                                 out->offset, out->buffers[1]->mutable_data());
   }
+
+  static uint64_t ComputeWord(uint64_t left, uint64_t right) { return left | right; }
 };
 
 struct KleeneOr : Commutative<KleeneOr> {
@@ -270,14 +278,13 @@ struct KleeneOr : Commutative<KleeneOr> {
       return Or::Call(ctx, left, right, out);
     }
 
-    static auto compute_word = [](uint64_t left_true, uint64_t left_false,
-                                  uint64_t right_true, uint64_t right_false,
-                                  uint64_t* out_valid, uint64_t* out_data) {
-      *out_data = left_true | right_true;
-      *out_valid = left_true | right_true | (left_false & right_false);
-    };
+    return ComputeKleene(ComputeWord, ctx, left, right, out);
+  }
 
-    return ComputeKleene(compute_word, ctx, left, right, out);
+  static void ComputeWord(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                          uint64_t right_false, uint64_t* out_valid, uint64_t* out_data) {
+    *out_data = left_true | right_true;
+    *out_valid = left_true | right_true | (left_false & right_false);
   }
 };
 
@@ -308,6 +315,8 @@ struct Xor : Commutative<Xor> {
                                  right.buffers[1]->data(), right.offset, right.length,
                                  out->offset, out->buffers[1]->mutable_data());
   }
+
+  static uint64_t ComputeWord(uint64_t left, uint64_t right) { return left ^ right; }
 };
 
 struct AndNot {
@@ -336,6 +345,8 @@ struct AndNot {
                                     right.buffers[1]->data(), right.offset, right.length,
                                     out->offset, out->buffers[1]->mutable_data());
   }
+
+  static uint64_t ComputeWord(uint64_t left, uint64_t right) { return left & ~right; }
 };
 
 struct KleeneAndNot {
@@ -379,17 +390,135 @@ struct KleeneAndNot {
       return AndNot::Call(ctx, left, right, out);
     }
 
-    static auto compute_word = [](uint64_t left_true, uint64_t left_false,
-                                  uint64_t right_true, uint64_t right_false,
-                                  uint64_t* out_valid, uint64_t* out_data) {
-      *out_data = left_true & right_false;
-      *out_valid = left_false | right_true | (left_true & right_false);
-    };
+    return ComputeKleene(ComputeWord, ctx, left, right, out);
+  }
+
+  static void ComputeWord(uint64_t left_true, uint64_t left_false, uint64_t right_true,
+                          uint64_t right_false, uint64_t* out_valid, uint64_t* out_data) {
+    *out_data = left_true & right_false;
+    *out_valid = left_false | right_true | (left_true & right_false);
+  }
+};
+
+// With a selection vector, the bits of the selected rows are gathered 64 at a
+// time into words, which are combined with the ComputeWord() of each operator.
+class SelectedBits {
+ public:
+  SelectedBits(const Datum& arg, const int32_t* indices) : indices_(indices) {
+    if (arg.is_scalar()) {
+      const auto& scalar = checked_cast<const BooleanScalar&>(*arg.scalar());
+      scalar_valid_ = scalar.is_valid ? ~uint64_t(0) : 0;
+      scalar_value_ = scalar.value ? ~uint64_t(0) : 0;
+    } else {
+      const ArrayData& arr = *arg.array();
+      values_ = arr.buffers[1]->data();
+      validity_ = arr.MayHaveNulls() ? arr.buffers[0]->data() : nullptr;
+      offset_ = arr.offset;
+    }
+  }
+
+  // Gather the bits of the next `length` selected rows, at most 64
+  void Next(int64_t length, uint64_t* valid, uint64_t* value) {
+    if (values_ == nullptr) {
+      *valid = scalar_valid_;
+      *value = scalar_value_;
+    } else {
+      *valid = validity_ == nullptr ? ~uint64_t(0) : Gather(validity_, length);
+      *value = Gather(values_, length);
+    }
+    indices_ += length;
+  }
 
-    return ComputeKleene(compute_word, ctx, left, right, out);
+ private:
+  uint64_t Gather(const uint8_t* bitmap, int64_t length) const {
+    uint64_t word = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      word |= static_cast<uint64_t>(BitUtil::GetBit(bitmap, offset_ + indices_[i])) << i;
+    }
+    return word;
   }
+
+  const int32_t* indices_;
+  const uint8_t* values_ = nullptr;
+  const uint8_t* validity_ = nullptr;
+  int64_t offset_ = 0;
+  uint64_t scalar_valid_ = 0;
+  uint64_t scalar_value_ = 0;
 };
 
+inline uint64_t WordMask(int64_t length) {
+  return length == 64 ? ~uint64_t(0) : BitUtil::LeastSignificantBitMask(length);
+}
+
+template <typename Op>
+void ExecUnary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (!batch.selection_vector || batch[0].is_scalar()) {
+    return internal::applicator::SimpleUnary<Op>(ctx, batch, out);
+  }
+  ArrayData* out_arr = out->mutable_array();
+  SelectedBits in(batch[0], batch.selection_vector->indices());
+  FirstTimeBitmapWriter out_data(out_arr->buffers[1]->mutable_data(), out_arr->offset,
+                                 out_arr->length);
+  for (int64_t position = 0; position < out_arr->length; position += 64) {
+    const int64_t length = std::min<int64_t>(64, out_arr->length - position);
+    uint64_t valid, value;
+    in.Next(length, &valid, &value);
+    out_data.AppendWord(Op::ComputeWord(value) & WordMask(length), length);
+  }
+  out_data.Finish();
+}
+
+template <typename Op>
+void ExecBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (!batch.selection_vector || !out->is_array()) {
+    return internal::applicator::SimpleBinary<Op>(ctx, batch, out);
+  }
+  ArrayData* out_arr = out->mutable_array();
+  SelectedBits left(batch[0], batch.selection_vector->indices());
+  SelectedBits right(batch[1], batch.selection_vector->indices());
+  FirstTimeBitmapWriter out_data(out_arr->buffers[1]->mutable_data(), out_arr->offset,
+                                 out_arr->length);
+  for (int64_t position = 0; position < out_arr->length; position += 64) {
+    const int64_t length = std::min<int64_t>(64, out_arr->length - position);
+    uint64_t left_valid, left_value, right_valid, right_value;
+    left.Next(length, &left_valid, &left_value);
+    right.Next(length, &right_valid, &right_value);
+    out_data.AppendWord(Op::ComputeWord(left_value, right_value) & WordMask(length),
+                        length);
+  }
+  out_data.Finish();
+}
+
+// The Kleene kernels also compute the output validity
+template <typename Op>
+void ExecKleeneBinary(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (!batch.selection_vector || !out->is_array()) {
+    return internal::applicator::SimpleBinary<Op>(ctx, batch, out);
+  }
+  ArrayData* out_arr = out->mutable_array();
+  SelectedBits left(batch[0], batch.selection_vector->indices());
+  SelectedBits right(batch[1], batch.selection_vector->indices());
+  FirstTimeBitmapWriter out_validity(out_arr->buffers[0]->mutable_data(),
+                                     out_arr->offset, out_arr->length);
+  FirstTimeBitmapWriter out_data(out_arr->buffers[1]->mutable_data(), out_arr->offset,
+                                 out_arr->length);
+  for (int64_t position = 0; position < out_arr->length; position += 64) {
+    const int64_t length = std::min<int64_t>(64, out_arr->length - position);
+    uint64_t left_valid, left_value, right_valid, right_value;
+    left.Next(length, &left_valid, &left_value);
+    right.Next(length, &right_valid, &right_value);
+    uint64_t valid, value;
+    Op::ComputeWord(left_valid & left_value, left_valid & ~left_value,
+                    right_valid & right_value, right_valid & ~right_value, &valid,
+                    &value);
+    out_validity.AppendWord(valid & WordMask(length), length);
+    out_data.AppendWord(value & WordMask(length), length);
+  }
+  out_validity.Finish();
+  out_data.Finish();
+  out_arr->null_count = kUnknownNullCount;
+}
+
 void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
                   const FunctionDoc* doc, FunctionRegistry* registry,
                   bool can_write_into_slices = true,
@@ -401,6 +530,7 @@ void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
   ScalarKernel kernel(std::move(in_types), boolean(), exec);
   kernel.null_handling = null_handling;
   kernel.can_write_into_slices = can_write_into_slices;
+  kernel.can_execute_selection = true;
 
   DCHECK_OK(func->AddKernel(kernel));
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -480,21 +610,19 @@ namespace internal {
 
 void RegisterScalarBoolean(FunctionRegistry* registry) {
   // These functions can write into sliced output bitmaps
-  MakeFunction("invert", 1, applicator::SimpleUnary<Invert>, &invert_doc, registry);
-  MakeFunction("and", 2, applicator::SimpleBinary<And>, &and_doc, registry);
-  MakeFunction("and_not", 2, applicator::SimpleBinary<AndNot>, &and_not_doc, registry);
-  MakeFunction("or", 2, applicator::SimpleBinary<Or>, &or_doc, registry);
-  MakeFunction("xor", 2, applicator::SimpleBinary<Xor>, &xor_doc, registry);
+  MakeFunction("invert", 1, ExecUnary<Invert>, &invert_doc, registry);
+  MakeFunction("and", 2, ExecBinary<And>, &and_doc, registry);
+  MakeFunction("and_not", 2, ExecBinary<AndNot>, &and_not_doc, registry);
+  MakeFunction("or", 2, ExecBinary<Or>, &or_doc, registry);
+  MakeFunction("xor", 2, ExecBinary<Xor>, &xor_doc, registry);
 
   // The Kleene logic kernels cannot write into sliced output bitmaps
-  MakeFunction("and_kleene", 2, applicator::SimpleBinary<KleeneAnd>, &and_kleene_doc,
-               registry,
+  MakeFunction("and_kleene", 2, ExecKleeneBinary<KleeneAnd>, &and_kleene_doc, registry,
                /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
-  MakeFunction("and_not_kleene", 2, applicator::SimpleBinary<KleeneAndNot>,
+  MakeFunction("and_not_kleene", 2, ExecKleeneBinary<KleeneAndNot>,
                &and_not_kleene_doc, registry,
                /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
-  MakeFunction("or_kleene", 2, applicator::SimpleBinary<KleeneOr>, &or_kleene_doc,
-               registry,
+  MakeFunction("or_kleene", 2, ExecKleeneBinary<KleeneOr>, &or_kleene_doc, registry,
                /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
 }
 
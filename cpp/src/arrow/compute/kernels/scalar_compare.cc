@@ -62,14 +62,14 @@ template <typename Op>
 void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   auto exec =
       GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-  DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+  DCHECK_OK(AddSelectionAwareKernel(func, {ty, ty}, boolean(), std::move(exec)));
 }
 
 template <typename InType, typename Op>
 void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  DCHECK_OK(
-      func->AddKernel({ty, ty}, boolean(),
-                      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
+  DCHECK_OK(AddSelectionAwareKernel(
+      func, {ty, ty}, boolean(),
+      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
 }
 
 template <typename Op>
@@ -77,8 +77,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
                                                     const FunctionDoc* doc) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary(), doc);
 
-  DCHECK_OK(func->AddKernel(
-      {boolean(), boolean()}, boolean(),
+  DCHECK_OK(AddSelectionAwareKernel(
+      func.get(), {boolean(), boolean()}, boolean(),
       applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
 
   for (const std::shared_ptr<DataType>& ty : IntTypes()) {
@@ -96,7 +96,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {in_type, in_type}, boolean(),
+                                      std::move(exec)));
   }
 
   // Duration
@@ -105,7 +106,8 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {in_type, in_type}, boolean(),
+                                      std::move(exec)));
   }
 
   // Time32 and Time64
@@ -114,20 +116,22 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name,
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int32());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {in_type, in_type}, boolean(),
+                                      std::move(exec)));
   }
   for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
     InputType in_type(match::Time64TypeUnit(unit));
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {in_type, in_type}, boolean(),
+                                      std::move(exec)));
   }
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
     auto exec =
         GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {ty, ty}, boolean(), std::move(exec)));
   }
 
   return func;
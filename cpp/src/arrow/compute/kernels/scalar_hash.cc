@@ -0,0 +1,335 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::BitmapUInt64Reader;
+using internal::ComputeStringHash;
+using internal::ScalarHelper;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// The loops of the given SIMD level, built in the matching translation unit
+template <SimdLevel::type SimdLevel>
+struct HashBlock : public HashBlockLoops<SimdLevel> {};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+template <>
+struct HashBlock<SimdLevel::AVX2> {
+  template <typename UInt>
+  static void HashIntegers(const UInt* values, int64_t length, uint64_t* hashes) {
+    HashIntegersAvx2(values, length, hashes);
+  }
+
+  static void MaskNulls(uint64_t validity, int64_t length, uint64_t* hashes) {
+    MaskNullsAvx2(validity, length, hashes);
+  }
+
+  static void CombineHashes(const uint64_t* hashes, int64_t length, uint64_t* out) {
+    CombineHashesAvx2(hashes, length, out);
+  }
+};
+#endif
+
+// One word of the validity bitmap
+constexpr int64_t kHashBlockSize = 64;
+
+template <SimdLevel::type SimdLevel>
+struct ColumnHasher {
+  // Hash the values of `data` into `out`, or combine their hashes with the
+  // contents of `out` if `combine` is true
+  static Status Hash(const ArrayData& data, bool combine, uint64_t* out) {
+    const DataType& type = *data.type;
+    switch (type.id()) {
+      case Type::NA:
+        HashNulls(data.length, combine, out);
+        return Status::OK();
+      case Type::BOOL:
+        HashBooleans(data, combine, out);
+        return Status::OK();
+      case Type::DICTIONARY:
+        return HashDictionary(data, combine, out);
+      case Type::BINARY:
+      case Type::STRING:
+        HashBinary<int32_t>(data, combine, out);
+        return Status::OK();
+      case Type::LARGE_BINARY:
+      case Type::LARGE_STRING:
+        HashBinary<int64_t>(data, combine, out);
+        return Status::OK();
+      default:
+        break;
+    }
+    if (is_fixed_width(type.id())) {
+      // Hash the bit representation of the values
+      switch (checked_cast<const FixedWidthType&>(type).bit_width()) {
+        case 8:
+          HashIntegers<uint8_t>(data, combine, out);
+          return Status::OK();
+        case 16:
+          HashIntegers<uint16_t>(data, combine, out);
+          return Status::OK();
+        case 32:
+          HashIntegers<uint32_t>(data, combine, out);
+          return Status::OK();
+        case 64:
+          HashIntegers<uint64_t>(data, combine, out);
+          return Status::OK();
+        default:
+          HashFixedSizeBinary(data, combine, out);
+          return Status::OK();
+      }
+    }
+    return Status::NotImplemented("Hashing values of type ", type);
+  }
+
+ protected:
+  // Call hash_values(position, length, hashes) on each block of the array
+  // having some valid values, and substitute the hash of null for the null ones
+  template <typename HashValues>
+  static void HashBlocks(const ArrayData& data, bool combine, uint64_t* out,
+                         HashValues&& hash_values) {
+    const bool may_have_nulls = data.MayHaveNulls();
+    BitmapUInt64Reader validity_reader(
+        may_have_nulls ? data.buffers[0]->data() : nullptr, data.offset,
+        may_have_nulls ? data.length : 0);
+    uint64_t block_hashes[kHashBlockSize];
+
+    for (int64_t position = 0; position < data.length; position += kHashBlockSize) {
+      const int64_t length = std::min(kHashBlockSize, data.length - position);
+      uint64_t* hashes = combine ? block_hashes : out + position;
+      const uint64_t validity = may_have_nulls ? validity_reader.NextWord() : ~0ULL;
+      if (validity == 0) {
+        std::fill(hashes, hashes + length, kHashBatchNull);
+      } else {
+        hash_values(position, length, hashes);
+        if (validity != ~0ULL) {
+          HashBlock<SimdLevel>::MaskNulls(validity, length, hashes);
+        }
+      }
+      if (combine) {
+        HashBlock<SimdLevel>::CombineHashes(block_hashes, length, out + position);
+      }
+    }
+  }
+
+  static void HashNulls(int64_t length, bool combine, uint64_t* out) {
+    if (!combine) {
+      std::fill(out, out + length, kHashBatchNull);
+      return;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = out[i] * kHashBatchCombineMultiplier + kHashBatchNull;
+    }
+  }
+
+  template <typename UInt>
+  static void HashIntegers(const ArrayData& data, bool combine, uint64_t* out) {
+    const UInt* values = data.GetValues<UInt>(1);
+    auto hash_values = [&](int64_t position, int64_t length, uint64_t* hashes) {
+      HashBlock<SimdLevel>::HashIntegers(values + position, length, hashes);
+    };
+    HashBlocks(data, combine, out, hash_values);
+  }
+
+  static void HashBooleans(const ArrayData& data, bool combine, uint64_t* out) {
+    using Helper = ScalarHelper<uint8_t, kHashBatchAlgorithm>;
+    const uint64_t hash_false = Helper::ComputeHash(0);
+    const uint64_t hash_true = Helper::ComputeHash(1);
+    const uint8_t* values = data.buffers[1]->data();
+    auto hash_values = [&](int64_t position, int64_t length, uint64_t* hashes) {
+      for (int64_t i = 0; i < length; ++i) {
+        hashes[i] =
+            BitUtil::GetBit(values, data.offset + position + i) ? hash_true : hash_false;
+      }
+    };
+    HashBlocks(data, combine, out, hash_values);
+  }
+
+  static void HashFixedSizeBinary(const ArrayData& data, bool combine, uint64_t* out) {
+    const int64_t byte_width =
+        checked_cast<const FixedWidthType&>(*data.type).bit_width() / 8;
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width;
+    auto hash_values = [&](int64_t position, int64_t length, uint64_t* hashes) {
+      const uint8_t* value = values + position * byte_width;
+      for (int64_t i = 0; i < length; ++i, value += byte_width) {
+        hashes[i] = ComputeStringHash<kHashBatchAlgorithm>(value, byte_width);
+      }
+    };
+    HashBlocks(data, combine, out, hash_values);
+  }
+
+  template <typename OffsetType>
+  static void HashBinary(const ArrayData& data, bool combine, uint64_t* out) {
+    const OffsetType* offsets = data.GetValues<OffsetType>(1);
+    const uint8_t* values = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+    auto hash_values = [&](int64_t position, int64_t length, uint64_t* hashes) {
+      const OffsetType* value_offsets = offsets + position;
+      for (int64_t i = 0; i < length; ++i) {
+        hashes[i] = ComputeStringHash<kHashBatchAlgorithm>(
+            values + value_offsets[i], value_offsets[i + 1] - value_offsets[i]);
+      }
+    };
+    HashBlocks(data, combine, out, hash_values);
+  }
+
+  // Hash the dictionary values once, then look up the hash of each index, so that
+  // dictionary arrays hash like their decoded values
+  static Status HashDictionary(const ArrayData& data, bool combine, uint64_t* out) {
+    const ArrayData& dictionary = *data.dictionary;
+    std::vector<uint64_t> dictionary_hashes(dictionary.length);
+    RETURN_NOT_OK(Hash(dictionary, /*combine=*/false, dictionary_hashes.data()));
+
+    const auto& index_type = checked_cast<const DictionaryType&>(*data.type).index_type();
+    switch (index_type->id()) {
+      case Type::INT8:
+      case Type::UINT8:
+        HashIndices<uint8_t>(data, dictionary_hashes, combine, out);
+        break;
+      case Type::INT16:
+      case Type::UINT16:
+        HashIndices<uint16_t>(data, dictionary_hashes, combine, out);
+        break;
+      case Type::INT32:
+      case Type::UINT32:
+        HashIndices<uint32_t>(data, dictionary_hashes, combine, out);
+        break;
+      case Type::INT64:
+      case Type::UINT64:
+        HashIndices<uint64_t>(data, dictionary_hashes, combine, out);
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type ", *index_type);
+    }
+    return Status::OK();
+  }
+
+  template <typename IndexType>
+  static void HashIndices(const ArrayData& data,
+                          const std::vector<uint64_t>& dictionary_hashes, bool combine,
+                          uint64_t* out) {
+    const IndexType* indices = data.GetValues<IndexType>(1);
+    auto hash_values = [&](int64_t position, int64_t length, uint64_t* hashes) {
+      for (int64_t i = 0; i < length; ++i) {
+        // Indices of null slots may be out of bounds
+        const IndexType index = indices[position + i];
+        hashes[i] = index < dictionary_hashes.size() ? dictionary_hashes[index]
+                                                     : kHashBatchNull;
+      }
+    };
+    HashBlocks(data, combine, out, hash_values);
+  }
+};
+
+template <SimdLevel::type SimdLevel>
+struct Hash64 {
+  static Status HashScalar(KernelContext* ctx, const Scalar& value, uint64_t* out) {
+    ARROW_ASSIGN_OR_RAISE(auto array,
+                          MakeArrayFromScalar(value, /*length=*/1, ctx->memory_pool()));
+    return ColumnHasher<SimdLevel>::Hash(*array->data(), /*combine=*/false, out);
+  }
+
+  static Status DoExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (out->is_scalar()) {
+      uint64_t hash = 0;
+      for (const Datum& value : batch.values) {
+        uint64_t value_hash;
+        RETURN_NOT_OK(HashScalar(ctx, *value.scalar(), &value_hash));
+        hash = hash * kHashBatchCombineMultiplier + value_hash;
+      }
+      out->value = std::make_shared<UInt64Scalar>(hash);
+      return Status::OK();
+    }
+
+    ArrayData* out_arr = out->mutable_array();
+    uint64_t* hashes = out_arr->GetMutableValues<uint64_t>(1);
+    const int64_t length = out_arr->length;
+    // The hashes of the first column are stored, the following ones are combined
+    bool combine = false;
+    for (const Datum& value : batch.values) {
+      if (value.is_scalar()) {
+        uint64_t value_hash;
+        RETURN_NOT_OK(HashScalar(ctx, *value.scalar(), &value_hash));
+        if (combine) {
+          for (int64_t i = 0; i < length; ++i) {
+            hashes[i] = hashes[i] * kHashBatchCombineMultiplier + value_hash;
+          }
+        } else {
+          std::fill(hashes, hashes + length, value_hash);
+        }
+      } else {
+        RETURN_NOT_OK(ColumnHasher<SimdLevel>::Hash(*value.array(), combine, hashes));
+      }
+      combine = true;
+    }
+    return Status::OK();
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    KERNEL_RETURN_IF_ERROR(ctx, DoExec(ctx, batch, out));
+  }
+};
+
+template <SimdLevel::type SimdLevel>
+void AddHash64Kernel(ScalarFunction* func) {
+  ScalarKernel kernel(
+      KernelSignature::Make({InputType()}, uint64(), /*is_varargs=*/true),
+      Hash64<SimdLevel>::Exec);
+  kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+  kernel.simd_level = SimdLevel;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+const FunctionDoc hash_64_doc{
+    "Compute a 64-bit hash of each row",
+    ("The hashes of the values of each argument are combined, in argument order,\n"
+     "into one hash per row.  Null values are hashed to a fixed seed, so the\n"
+     "output is never null.  Dictionary arrays hash like their decoded values.\n"
+     "The hashes are not stable across Arrow versions."),
+    {"*values"}};
+
+}  // namespace
+
+void RegisterScalarHash(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("hash_64", Arity::VarArgs(/*min_args=*/1),
+                                               &hash_64_doc);
+  AddHash64Kernel<SimdLevel::NONE>(func.get());
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (::arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          ::arrow::internal::CpuInfo::AVX2)) {
+    AddHash64Kernel<SimdLevel::AVX2>(func.get());
+  }
+#endif
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+using Loops = HashBlockLoops<SimdLevel::AVX2>;
+
+void HashIntegersAvx2(const uint8_t* values, int64_t length, uint64_t* hashes) {
+  Loops::HashIntegers(values, length, hashes);
+}
+
+void HashIntegersAvx2(const uint16_t* values, int64_t length, uint64_t* hashes) {
+  Loops::HashIntegers(values, length, hashes);
+}
+
+void HashIntegersAvx2(const uint32_t* values, int64_t length, uint64_t* hashes) {
+  Loops::HashIntegers(values, length, hashes);
+}
+
+void HashIntegersAvx2(const uint64_t* values, int64_t length, uint64_t* hashes) {
+  Loops::HashIntegers(values, length, hashes);
+}
+
+void MaskNullsAvx2(uint64_t validity, int64_t length, uint64_t* hashes) {
+  Loops::MaskNulls(validity, length, hashes);
+}
+
+void CombineHashesAvx2(const uint64_t* hashes, int64_t length, uint64_t* out) {
+  Loops::CombineHashes(hashes, length, out);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+template <typename Type>
+static void Hash64Array(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array =
+      rand.ArrayOf(TypeTraits<Type>::type_singleton(), args.size, args.null_proportion);
+  for (auto _ : state) {
+    ABORT_NOT_OK(Hash64({array}).status());
+  }
+}
+
+static void Hash64Int32(benchmark::State& state) { Hash64Array<Int32Type>(state); }
+
+static void Hash64Int64(benchmark::State& state) { Hash64Array<Int64Type>(state); }
+
+static void Hash64Double(benchmark::State& state) { Hash64Array<DoubleType>(state); }
+
+static void Hash64String(benchmark::State& state) { Hash64Array<StringType>(state); }
+
+// A composite key of three columns
+static void Hash64Columns(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<Datum> columns = {rand.ArrayOf(int64(), args.size, args.null_proportion),
+                                rand.ArrayOf(utf8(), args.size, args.null_proportion),
+                                rand.ArrayOf(int32(), args.size, args.null_proportion)};
+  for (auto _ : state) {
+    ABORT_NOT_OK(Hash64(columns).status());
+  }
+}
+
+// For comparison, hashing one value at a time as callers of util/hashing.h do
+static void HashValueAtATimeInt64(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.ArrayOf(int64(), args.size, args.null_proportion);
+  const auto& values = checked_cast<const Int64Array&>(*array);
+  using Helper = ::arrow::internal::ScalarHelper<int64_t, internal::kHashBatchAlgorithm>;
+  std::vector<uint64_t> hashes(values.length());
+  for (auto _ : state) {
+    for (int64_t i = 0; i < values.length(); ++i) {
+      hashes[i] = values.IsNull(i) ? internal::kHashBatchNull
+                                   : Helper::ComputeHash(values.Value(i));
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+}
+
+BENCHMARK(Hash64Int32)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64Int64)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64Double)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64String)->Apply(RegressionSetArgs);
+BENCHMARK(Hash64Columns)->Apply(RegressionSetArgs);
+BENCHMARK(HashValueAtATimeInt64)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
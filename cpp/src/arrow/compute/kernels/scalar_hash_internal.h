@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// ----------------------------------------------------------------------
+// Batch hashing, as exposed by the "hash_64" function
+
+// The hashes must be independent from those used by the memo tables of
+// util/hashing.h, so that they can partition data which is then grouped
+// or deduplicated in memo tables
+constexpr uint64_t kHashBatchAlgorithm = 1;
+
+// The multiplier of ScalarHelper<Integer, kHashBatchAlgorithm>::ComputeHash
+constexpr uint64_t kHashBatchMultiplier = 14029467366897019727ULL;
+
+// The hash of a null value
+constexpr uint64_t kHashBatchNull = 0x5851F42D4C957F2DULL;
+
+// The multiplier applied to the hash of the preceding columns before adding
+// the hash of the next one
+constexpr uint64_t kHashBatchCombineMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// Branch-free loops over a block of values, so that the compiler vectorizes them.
+// They are instantiated once per SIMD level, each in a translation unit built
+// with the corresponding instruction set.
+template <SimdLevel::type SimdLevel>
+struct HashBlockLoops {
+  // Same result as ScalarHelper<UInt, kHashBatchAlgorithm>::ComputeHash
+  template <typename UInt>
+  static void HashIntegers(const UInt* values, int64_t length, uint64_t* hashes) {
+    for (int64_t i = 0; i < length; ++i) {
+      hashes[i] =
+          ARROW_BYTE_SWAP64(kHashBatchMultiplier * static_cast<uint64_t>(values[i]));
+    }
+  }
+
+  // Substitute the hash of null for the values whose bit of `validity` is unset
+  static void MaskNulls(uint64_t validity, int64_t length, uint64_t* hashes) {
+    for (int64_t i = 0; i < length; ++i) {
+      const uint64_t valid_mask = 0 - ((validity >> i) & 1);
+      hashes[i] = (hashes[i] & valid_mask) | (kHashBatchNull & ~valid_mask);
+    }
+  }
+
+  static void CombineHashes(const uint64_t* hashes, int64_t length, uint64_t* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = out[i] * kHashBatchCombineMultiplier + hashes[i];
+    }
+  }
+};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// HashBlockLoops<SimdLevel::AVX2>, built in scalar_hash_avx2.cc
+void HashIntegersAvx2(const uint8_t* values, int64_t length, uint64_t* hashes);
+void HashIntegersAvx2(const uint16_t* values, int64_t length, uint64_t* hashes);
+void HashIntegersAvx2(const uint32_t* values, int64_t length, uint64_t* hashes);
+void HashIntegersAvx2(const uint64_t* values, int64_t length, uint64_t* hashes);
+void MaskNullsAvx2(uint64_t validity, int64_t length, uint64_t* hashes);
+void CombineHashesAvx2(const uint64_t* hashes, int64_t length, uint64_t* out);
+#endif
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
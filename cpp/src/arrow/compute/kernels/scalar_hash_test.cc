@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/kernels/scalar_hash_internal.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using ::arrow::internal::ComputeStringHash;
+using ::arrow::internal::ScalarHelper;
+
+namespace compute {
+
+using internal::kHashBatchAlgorithm;
+using internal::kHashBatchCombineMultiplier;
+using internal::kHashBatchNull;
+
+template <typename UInt>
+uint64_t HashInteger(const uint8_t* value) {
+  return ScalarHelper<UInt, kHashBatchAlgorithm>::ComputeHash(
+      util::SafeLoadAs<UInt>(value));
+}
+
+// Reference implementation, hashing one value at a time
+uint64_t HashValue(const Array& array, int64_t i) {
+  if (array.type_id() == Type::NA || array.IsNull(i)) {
+    return kHashBatchNull;
+  }
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return ScalarHelper<uint8_t, kHashBatchAlgorithm>::ComputeHash(
+          checked_cast<const BooleanArray&>(array).Value(i));
+    case Type::BINARY:
+    case Type::STRING: {
+      auto view = checked_cast<const BinaryArray&>(array).GetView(i);
+      return ComputeStringHash<kHashBatchAlgorithm>(view.data(), view.size());
+    }
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING: {
+      auto view = checked_cast<const LargeBinaryArray&>(array).GetView(i);
+      return ComputeStringHash<kHashBatchAlgorithm>(view.data(), view.size());
+    }
+    case Type::DICTIONARY: {
+      const auto& dict_array = checked_cast<const DictionaryArray&>(array);
+      return HashValue(*dict_array.dictionary(), dict_array.GetValueIndex(i));
+    }
+    default:
+      break;
+  }
+  const int byte_width =
+      checked_cast<const FixedWidthType&>(*array.type()).bit_width() / 8;
+  const uint8_t* value =
+      array.data()->buffers[1]->data() + (array.offset() + i) * byte_width;
+  switch (byte_width) {
+    case 1:
+      return HashInteger<uint8_t>(value);
+    case 2:
+      return HashInteger<uint16_t>(value);
+    case 4:
+      return HashInteger<uint32_t>(value);
+    case 8:
+      return HashInteger<uint64_t>(value);
+    default:
+      return ComputeStringHash<kHashBatchAlgorithm>(value, byte_width);
+  }
+}
+
+std::shared_ptr<Array> ExpectedHashes(const std::vector<std::shared_ptr<Array>>& arrays) {
+  UInt64Builder builder;
+  const int64_t length = arrays[0]->length();
+  for (int64_t i = 0; i < length; ++i) {
+    uint64_t hash = 0;
+    for (const auto& array : arrays) {
+      hash = hash * kHashBatchCombineMultiplier + HashValue(*array, i);
+    }
+    ABORT_NOT_OK(builder.Append(hash));
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+void CheckHash64(const std::vector<std::shared_ptr<Array>>& arrays) {
+  std::vector<Datum> args(arrays.begin(), arrays.end());
+  ASSERT_OK_AND_ASSIGN(Datum actual, Hash64(args));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertArraysEqual(*ExpectedHashes(arrays), *actual.make_array(), /*verbose=*/true);
+  ASSERT_EQ(actual.null_count(), 0);
+}
+
+class TestHash64 : public ::testing::Test {
+ protected:
+  random::RandomArrayGenerator rng_{0x5487654};
+};
+
+TEST_F(TestHash64, Basics) {
+  auto values = ArrayFromJSON(int64(), "[1, 2, null, 1, 3, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum hashes, Hash64({values}));
+  auto out_array = hashes.make_array();
+  const auto& out = checked_cast<const UInt64Array&>(*out_array);
+  ASSERT_EQ(out.length(), 6);
+  ASSERT_EQ(out.null_count(), 0);
+  using Helper = ScalarHelper<uint64_t, kHashBatchAlgorithm>;
+  ASSERT_EQ(out.Value(0), Helper::ComputeHash(1));
+  ASSERT_EQ(out.Value(0), out.Value(3));
+  ASSERT_EQ(out.Value(1), out.Value(5));
+  ASSERT_NE(out.Value(0), out.Value(1));
+  ASSERT_NE(out.Value(0), out.Value(4));
+  ASSERT_EQ(out.Value(2), kHashBatchNull);
+
+  CheckHash64({ArrayFromJSON(utf8(), R"(["", "a", null, "bcd", "a"])")});
+  CheckHash64({ArrayFromJSON(boolean(), "[true, false, null, true]")});
+  CheckHash64({std::make_shared<NullArray>(3)});
+}
+
+TEST_F(TestHash64, MultipleColumns) {
+  auto ints = ArrayFromJSON(int32(), "[1, 2, 1, 2, null]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "a", "b", "a", "a"])");
+  CheckHash64({ints, strings});
+  CheckHash64({strings, ints, strings});
+
+  ASSERT_OK_AND_ASSIGN(Datum hashes, Hash64({ints, strings}));
+  auto out_array = hashes.make_array();
+  const auto& out = checked_cast<const UInt64Array&>(*out_array);
+  ASSERT_EQ(out.Value(1), out.Value(3));
+  ASSERT_NE(out.Value(0), out.Value(1));
+  ASSERT_NE(out.Value(0), out.Value(2));
+
+  // The order of the columns matters
+  ASSERT_OK_AND_ASSIGN(Datum swapped, Hash64({strings, ints}));
+  ASSERT_NE(out.Value(0), swapped.array()->GetValues<uint64_t>(1)[0]);
+}
+
+TEST_F(TestHash64, Dictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict_array =
+      DictArrayFromJSON(dict_type, "[0, 1, null, 2, 0]", R"(["a", "b", null])");
+  auto decoded = ArrayFromJSON(utf8(), R"(["a", "b", null, null, "a"])");
+  ASSERT_OK_AND_ASSIGN(Datum expected, Hash64({decoded}));
+  ASSERT_OK_AND_ASSIGN(Datum actual, Hash64({dict_array}));
+  AssertDatumsEqual(expected, actual);
+}
+
+TEST_F(TestHash64, Scalars) {
+  auto ints = ArrayFromJSON(int32(), "[1, null, 3]");
+  for (const auto& scalar : {MakeScalar(int32_t(42)), MakeNullScalar(int32()),
+                             MakeScalar("foo")}) {
+    ASSERT_OK_AND_ASSIGN(auto broadcast, MakeArrayFromScalar(*scalar, 3));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Hash64({ints, broadcast}));
+    ASSERT_OK_AND_ASSIGN(Datum actual, Hash64({ints, scalar}));
+    AssertDatumsEqual(expected, actual);
+    ASSERT_OK_AND_ASSIGN(expected, Hash64({broadcast, ints}));
+    ASSERT_OK_AND_ASSIGN(actual, Hash64({scalar, ints}));
+    AssertDatumsEqual(expected, actual);
+
+    // All-scalar arguments hash to a scalar
+    ASSERT_OK_AND_ASSIGN(expected, Hash64({broadcast, broadcast}));
+    ASSERT_OK_AND_ASSIGN(actual, Hash64({scalar, scalar}));
+    ASSERT_TRUE(actual.is_scalar());
+    ASSERT_OK_AND_ASSIGN(auto expected_scalar, expected.make_array()->GetScalar(0));
+    AssertScalarsEqual(*expected_scalar, *actual.scalar(), /*verbose=*/true);
+  }
+}
+
+TEST_F(TestHash64, RandomColumns) {
+  const int64_t length = 1000;
+  for (const auto& type :
+       {int8(), uint16(), int32(), int64(), float32(), float64(), boolean(), date32(),
+        timestamp(TimeUnit::MICRO), decimal(20, 4), fixed_size_binary(3), binary(),
+        utf8(), large_utf8()}) {
+    SCOPED_TRACE(type->ToString());
+    for (const double null_probability : {0.0, 0.2, 1.0}) {
+      auto array = rng_.ArrayOf(type, length, null_probability);
+      CheckHash64({array});
+      // Unaligned offsets
+      CheckHash64({array->Slice(7, 500)});
+      CheckHash64({array->Slice(3), rng_.ArrayOf(int64(), length - 3, 0.1)});
+    }
+  }
+}
+
+TEST_F(TestHash64, RandomDictionary) {
+  const int64_t length = 1000;
+  auto dict_values = rng_.ArrayOf(utf8(), 20, /*null_probability=*/0.1);
+  auto indices = rng_.Int16(length, 0, 19, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(auto dict_array,
+                       DictionaryArray::FromArrays(dictionary(int16(), utf8()), indices,
+                                                   dict_values));
+  CheckHash64({dict_array});
+  CheckHash64({dict_array->Slice(5), rng_.ArrayOf(int8(), length - 5, 0.1)});
+}
+
+TEST_F(TestHash64, Errors) {
+  ASSERT_RAISES(Invalid, CallFunction("hash_64", {}));
+  ASSERT_RAISES(NotImplemented,
+                Hash64({ArrayFromJSON(list(int32()), "[[1, 2], null, []]")}));
+}
+
+}  // namespace compute
+}  // namespace arrow
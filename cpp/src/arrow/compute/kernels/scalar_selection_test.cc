@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestCallSelectedFunction : public ::testing::Test {
+ public:
+  void SetUp() override {
+    random::RandomArrayGenerator rand(/*seed=*/0x5EED);
+    const int64_t length = 1000;
+    mask_ = rand.Boolean(length, /*true_probability=*/0.3, /*null_probability=*/0.1);
+    ASSERT_OK_AND_ASSIGN(selection_, SelectionVector::FromMask(
+                                         checked_cast<const BooleanArray&>(*mask_)));
+    ints_ = {rand.Int32(length, -100, 100, /*null_probability=*/0.1),
+             rand.Int32(length + 5, -100, 100, /*null_probability=*/0.1)->Slice(5)};
+    doubles_ = rand.Float64(length, -1, 1, /*null_probability=*/0.1);
+    bools_ = {rand.Boolean(length, 0.5, /*null_probability=*/0.1),
+              rand.Boolean(length + 3, 0.5, /*null_probability=*/0.1)->Slice(3)};
+    strings_ = rand.String(length + 7, 0, 5, /*null_probability=*/0.1)->Slice(7);
+  }
+
+  // Executing with the selection vector must give the same result as
+  // executing on the taken rows
+  void CheckSelected(const std::string& func_name, const std::vector<Datum>& args,
+                     const FunctionOptions* options = nullptr) {
+    SCOPED_TRACE(func_name);
+    std::vector<Datum> taken_args;
+    for (const auto& arg : args) {
+      if (arg.is_scalar()) {
+        taken_args.push_back(arg);
+      } else {
+        ASSERT_OK_AND_ASSIGN(Datum taken, Take(arg, selection_->data()));
+        taken_args.push_back(taken);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, taken_args, options));
+
+    for (int64_t chunksize : {std::numeric_limits<int64_t>::max(), int64_t(37)}) {
+      ExecContext ctx;
+      ctx.set_exec_chunksize(chunksize);
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           CallFunction(func_name, args, *selection_, options, &ctx));
+      ASSERT_OK_AND_ASSIGN(auto actual_array, ToArray(actual));
+      ASSERT_OK(actual_array->ValidateFull());
+      ASSERT_OK_AND_ASSIGN(auto expected_array, ToArray(expected));
+      AssertArraysEqual(*expected_array, *actual_array, /*verbose=*/true);
+    }
+  }
+
+ protected:
+  // Kernels which cannot write into slices return one chunk per exec chunk
+  static Result<std::shared_ptr<Array>> ToArray(const Datum& datum) {
+    if (datum.kind() == Datum::CHUNKED_ARRAY) {
+      return Concatenate(datum.chunked_array()->chunks());
+    }
+    return datum.make_array();
+  }
+
+  std::shared_ptr<SelectionVector> selection_;
+  std::vector<std::shared_ptr<Array>> ints_, bools_;
+  std::shared_ptr<Array> mask_, doubles_, strings_;
+};
+
+TEST_F(TestCallSelectedFunction, Arithmetic) {
+  CheckSelected("add", {ints_[0], ints_[1]});
+  CheckSelected("subtract_checked", {ints_[0], ints_[1]});
+  CheckSelected("multiply", {ints_[0], Datum(int32_t(3))});
+  CheckSelected("add", {Datum(1.5), doubles_});
+}
+
+TEST_F(TestCallSelectedFunction, Compare) {
+  CheckSelected("equal", {ints_[0], ints_[1]});
+  CheckSelected("less", {ints_[0], Datum(int32_t(10))});
+  CheckSelected("greater_equal", {Datum(0.5), doubles_});
+  CheckSelected("not_equal", {strings_, Datum("a")});
+}
+
+TEST_F(TestCallSelectedFunction, Boolean) {
+  CheckSelected("invert", {bools_[1]});
+  CheckSelected("and", {bools_[0], bools_[1]});
+  CheckSelected("xor", {bools_[0], Datum(true)});
+  CheckSelected("and_kleene", {bools_[0], bools_[1]});
+  CheckSelected("or_kleene", {bools_[1], Datum(false)});
+}
+
+TEST_F(TestCallSelectedFunction, String) {
+  CheckSelected("ascii_upper", {strings_});
+  CheckSelected("ascii_is_alpha", {strings_});
+  CheckSelected("binary_length", {strings_});
+  TrimOptions trim_options("a");
+  CheckSelected("ascii_trim", {strings_}, &trim_options);
+  // Not selection-aware, the selected rows are gathered first
+  MatchSubstringOptions match_options("a");
+  CheckSelected("match_substring", {strings_}, &match_options);
+}
+
+TEST_F(TestCallSelectedFunction, ChunkedArguments) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ints_[0]->Slice(0, 300), ints_[0]->Slice(300)});
+  CheckSelected("add", {chunked, ints_[1]});
+}
+
+TEST_F(TestCallSelectedFunction, ChainedPredicates) {
+  ASSERT_OK_AND_ASSIGN(Datum positive, CallFunction("greater", {ints_[0], Datum(0)},
+                                                    *selection_, nullptr));
+  auto positive_mask = positive.make_array();
+  const auto& positive_bools = checked_cast<const BooleanArray&>(*positive_mask);
+  ASSERT_OK_AND_ASSIGN(auto narrowed, selection_->Filter(positive_bools));
+  ASSERT_OK_AND_ASSIGN(
+      Datum actual, CallFunction("multiply", {ints_[0], Datum(-1)}, *narrowed, nullptr));
+
+  ASSERT_OK_AND_ASSIGN(Datum mask, CallFunction("greater", {ints_[0], Datum(0)}));
+  ASSERT_OK_AND_ASSIGN(Datum both, CallFunction("and_kleene", {mask, mask_}));
+  ASSERT_OK_AND_ASSIGN(Datum filtered, Filter(ints_[0], both));
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("multiply", {filtered, Datum(-1)}));
+  AssertDatumsEqual(expected, actual);
+}
+
+TEST_F(TestCallSelectedFunction, InvalidSelection) {
+  SelectionVector out_of_bounds(*ArrayFromJSON(int32(), "[0, 1000]"));
+  ASSERT_RAISES(IndexError,
+                CallFunction("add", {ints_[0], ints_[1]}, out_of_bounds, nullptr));
+  ASSERT_RAISES(Invalid, CallFunction("add", {ints_[0], ints_[1]->Slice(1)}, *selection_,
+                                      nullptr));
+}
+
+}  // namespace compute
+}  // namespace arrow
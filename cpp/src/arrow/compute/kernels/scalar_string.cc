@@ -104,10 +104,27 @@ struct StringTransform {
       ArrayType input_boxed(batch[0].array());
       ArrayData* output = out->mutable_array();
 
-      offset_type input_ncodeunits = input_boxed.total_values_length();
-      offset_type input_nstrings = static_cast<offset_type>(input.length);
+      // With a selection vector, only the selected strings are transformed
+      const int32_t* selected =
+          batch.selection_vector ? batch.selection_vector->indices() : nullptr;
+      int64_t input_ncodeunits = 0;
+      int64_t input_nstrings = input.length;
+      if (selected != nullptr) {
+        input_nstrings = output->length;
+        for (int64_t i = 0; i < input_nstrings; i++) {
+          input_ncodeunits += input_boxed.value_length(selected[i]);
+        }
+      } else {
+        input_ncodeunits = input_boxed.total_values_length();
+      }
 
-      int64_t output_ncodeunits_max = Derived::MaxCodeunits(input_ncodeunits);
+      if (input_ncodeunits > std::numeric_limits<offset_type>::max()) {
+        ctx->SetStatus(Status::CapacityError(
+            "Result might not fit in a 32bit utf8 array, convert to large_utf8"));
+        return;
+      }
+      int64_t output_ncodeunits_max =
+          Derived::MaxCodeunits(static_cast<offset_type>(input_ncodeunits));
       if (output_ncodeunits_max > std::numeric_limits<offset_type>::max()) {
         ctx->SetStatus(Status::CapacityError(
             "Result might not fit in a 32bit utf8 array, convert to large_utf8"));
@@ -126,7 +143,8 @@ struct StringTransform {
       output_string_offsets[0] = 0;
       for (int64_t i = 0; i < input_nstrings; i++) {
         offset_type input_string_ncodeunits;
-        const uint8_t* input_string = input_boxed.GetValue(i, &input_string_ncodeunits);
+        const uint8_t* input_string = input_boxed.GetValue(
+            selected != nullptr ? selected[i] : i, &input_string_ncodeunits);
         offset_type encoded_nbytes = 0;
         if (ARROW_PREDICT_FALSE(!static_cast<Derived&>(*this).Transform(
                 input_string, input_string_ncodeunits, output_str + output_ncodeunits,
@@ -260,6 +278,34 @@ void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
 
     ArrayData* out_arr = out->mutable_array();
 
+    if (batch.selection_vector) {
+      // Only the selected strings are transformed, so new offsets are needed
+      const int32_t* selected = batch.selection_vector->indices();
+      KERNEL_RETURN_IF_ERROR(
+          ctx, ctx->Allocate((out_arr->length + 1) * sizeof(offset_type))
+                   .Value(&out_arr->buffers[1]));
+      offset_type* out_offsets = out_arr->GetMutableValues<offset_type>(1);
+      int64_t data_nbytes = 0;
+      out_offsets[0] = 0;
+      for (int64_t i = 0; i < out_arr->length; ++i) {
+        data_nbytes += input_boxed.value_length(selected[i]);
+        if (ARROW_PREDICT_FALSE(data_nbytes > std::numeric_limits<offset_type>::max())) {
+          ctx->SetStatus(Status::CapacityError("Result does not fit in offset type"));
+          return;
+        }
+        out_offsets[i + 1] = static_cast<offset_type>(data_nbytes);
+      }
+      KERNEL_RETURN_IF_ERROR(ctx,
+                             ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
+      uint8_t* out_data = out_arr->buffers[2]->mutable_data();
+      for (int64_t i = 0; i < out_arr->length; ++i) {
+        offset_type nbytes;
+        const uint8_t* value = input_boxed.GetValue(selected[i], &nbytes);
+        transform(value, nbytes, out_data + out_offsets[i]);
+      }
+      return;
+    }
+
     if (input.offset == 0) {
       // We can reuse offsets from input
       out_arr->buffers[1] = input.buffers[1];
@@ -1574,10 +1620,11 @@ const FunctionDoc binary_length_doc(
 
 void AddStrptime(FunctionRegistry* registry) {
   auto func = std::make_shared<ScalarFunction>("strptime", Arity::Unary(), &strptime_doc);
-  DCHECK_OK(func->AddKernel({utf8()}, OutputType(StrptimeResolve),
-                            StrptimeExec<StringType>, StrptimeState::Init));
-  DCHECK_OK(func->AddKernel({large_utf8()}, OutputType(StrptimeResolve),
-                            StrptimeExec<LargeStringType>, StrptimeState::Init));
+  DCHECK_OK(AddSelectionAwareKernel(func.get(), {utf8()}, OutputType(StrptimeResolve),
+                                    StrptimeExec<StringType>, StrptimeState::Init));
+  DCHECK_OK(AddSelectionAwareKernel(func.get(), {large_utf8()},
+                                    OutputType(StrptimeResolve),
+                                    StrptimeExec<LargeStringType>, StrptimeState::Init));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -1589,10 +1636,10 @@ void AddBinaryLength(FunctionRegistry* registry) {
   ArrayKernelExec exec_offset_64 =
       applicator::ScalarUnaryNotNull<Int64Type, LargeStringType, BinaryLength>::Exec;
   for (const auto& input_type : {binary(), utf8()}) {
-    DCHECK_OK(func->AddKernel({input_type}, int32(), exec_offset_32));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {input_type}, int32(), exec_offset_32));
   }
   for (const auto& input_type : {large_binary(), large_utf8()}) {
-    DCHECK_OK(func->AddKernel({input_type}, int64(), exec_offset_64));
+    DCHECK_OK(AddSelectionAwareKernel(func.get(), {input_type}, int64(), exec_offset_64));
   }
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
@@ -1606,12 +1653,14 @@ void MakeUnaryStringBatchKernel(
     auto exec_32 = ExecFunctor<StringType>::Exec;
     ScalarKernel kernel{{utf8()}, utf8(), exec_32};
     kernel.mem_allocation = mem_allocation;
+    kernel.can_execute_selection = true;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   {
     auto exec_64 = ExecFunctor<LargeStringType>::Exec;
     ScalarKernel kernel{{large_utf8()}, large_utf8(), exec_64};
     kernel.mem_allocation = mem_allocation;
+    kernel.can_execute_selection = true;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -1626,12 +1675,14 @@ void MakeUnaryStringBatchKernelWithState(
     using t32 = ExecFunctor<StringType>;
     ScalarKernel kernel{{utf8()}, utf8(), t32::Exec, t32::State::Init};
     kernel.mem_allocation = mem_allocation;
+    kernel.can_execute_selection = true;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   {
     using t64 = ExecFunctor<LargeStringType>;
     ScalarKernel kernel{{large_utf8()}, large_utf8(), t64::Exec, t64::State::Init};
     kernel.mem_allocation = mem_allocation;
+    kernel.can_execute_selection = true;
     DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -1645,8 +1696,8 @@ void MakeUnaryStringUTF8TransformKernel(std::string name, FunctionRegistry* regi
   auto func = std::make_shared<ScalarFunction>(name, Arity::Unary(), doc);
   ArrayKernelExec exec_32 = Transformer<StringType>::Exec;
   ArrayKernelExec exec_64 = Transformer<LargeStringType>::Exec;
-  DCHECK_OK(func->AddKernel({utf8()}, utf8(), exec_32));
-  DCHECK_OK(func->AddKernel({large_utf8()}, large_utf8(), exec_64));
+  DCHECK_OK(AddSelectionAwareKernel(func.get(), {utf8()}, utf8(), exec_32));
+  DCHECK_OK(AddSelectionAwareKernel(func.get(), {large_utf8()}, large_utf8(), exec_64));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -1660,8 +1711,19 @@ void ApplyPredicate(KernelContext* ctx, const ExecBatch& batch, StringPredicate
   EnsureLookupTablesFilled();
   if (batch[0].kind() == Datum::ARRAY) {
     const ArrayData& input = *batch[0].array();
-    ArrayIterator<Type> input_it(input);
     ArrayData* out_arr = out->mutable_array();
+    if (batch.selection_vector) {
+      SelectionIterator<Type> input_it(input, *batch.selection_vector);
+      ::arrow::internal::GenerateBitsUnrolled(
+          out_arr->buffers[1]->mutable_data(), out_arr->offset, out_arr->length,
+          [&]() -> bool {
+            util::string_view val = input_it();
+            return predicate(ctx, reinterpret_cast<const uint8_t*>(val.data()),
+                             val.size());
+          });
+      return;
+    }
+    ArrayIterator<Type> input_it(input);
     ::arrow::internal::GenerateBitsUnrolled(
         out_arr->buffers[1]->mutable_data(), out_arr->offset, input.length,
         [&]() -> bool {
@@ -1692,8 +1754,9 @@ void AddUnaryStringPredicate(std::string name, FunctionRegistry* registry,
   auto exec_64 = [](KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     ApplyPredicate<LargeStringType>(ctx, batch, Predicate::Call, out);
   };
-  DCHECK_OK(func->AddKernel({utf8()}, boolean(), std::move(exec_32)));
-  DCHECK_OK(func->AddKernel({large_utf8()}, boolean(), std::move(exec_64)));
+  DCHECK_OK(AddSelectionAwareKernel(func.get(), {utf8()}, boolean(), std::move(exec_32)));
+  DCHECK_OK(
+      AddSelectionAwareKernel(func.get(), {large_utf8()}, boolean(), std::move(exec_64)));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -24,12 +24,20 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
 
 #include "arrow/compute/api.h"
 
 namespace arrow {
 namespace compute {
 
+using ::arrow::internal::BinaryMemoTable;
+using ::arrow::internal::checked_cast;
+using ::arrow::internal::HashTable;
+using ::arrow::internal::ScalarMemoTable;
+using ::arrow::internal::SwissHashTable;
+
 static void BuildDictionary(benchmark::State& state) {  // NOLINT non-const reference
   const int64_t iterations = 1024;
 
@@ -225,6 +233,68 @@ static void UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{general_bench_cases[state.range(0)], 100});
 }
 
+// Compute unique values directly with a memo table, to compare the
+// hash table implementations usable by the hash kernels
+
+template <template <class> class HashTableTemplateType>
+Status MemoTableUnique(const Int64Array& arr) {
+  ScalarMemoTable<int64_t, HashTableTemplateType> memo_table(default_memory_pool());
+  for (int64_t i = 0; i < arr.length(); ++i) {
+    int32_t memo_index;
+    if (arr.IsNull(i)) {
+      memo_table.GetOrInsertNull();
+    } else {
+      RETURN_NOT_OK(memo_table.GetOrInsert(arr.Value(i), &memo_index));
+    }
+  }
+  std::vector<int64_t> uniques(memo_table.size());
+  memo_table.CopyValues(uniques.data());
+  benchmark::DoNotOptimize(uniques.data());
+  return Status::OK();
+}
+
+template <template <class> class HashTableTemplateType>
+Status MemoTableUnique(const StringArray& arr) {
+  BinaryMemoTable<BinaryBuilder, HashTableTemplateType> memo_table(default_memory_pool());
+  for (int64_t i = 0; i < arr.length(); ++i) {
+    int32_t memo_index;
+    if (arr.IsNull(i)) {
+      memo_table.GetOrInsertNull();
+    } else {
+      RETURN_NOT_OK(memo_table.GetOrInsert(arr.GetView(i), &memo_index));
+    }
+  }
+  std::vector<uint8_t> uniques(memo_table.values_size());
+  memo_table.CopyValues(uniques.data());
+  benchmark::DoNotOptimize(uniques.data());
+  return Status::OK();
+}
+
+template <typename ArrayType, template <class> class HashTableTemplateType,
+          typename ParamType>
+void BenchMemoTableUnique(benchmark::State& state, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+  const auto& typed_arr = checked_cast<const ArrayType&>(*arr);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(MemoTableUnique<HashTableTemplateType>(typed_arr));
+  }
+  params.SetMetadata(state);
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableUniqueInt64(benchmark::State& state) {
+  BenchMemoTableUnique<Int64Array, HashTableTemplateType>(
+      state, HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableUniqueString10bytes(benchmark::State& state) {
+  BenchMemoTableUnique<StringArray, HashTableTemplateType>(
+      state, HashParams<StringType>{general_bench_cases[state.range(0)], 10});
+}
+
 void HashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -238,6 +308,11 @@ BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
 
+BENCHMARK_TEMPLATE(MemoTableUniqueInt64, HashTable)->Apply(HashSetArgs);
+BENCHMARK_TEMPLATE(MemoTableUniqueInt64, SwissHashTable)->Apply(HashSetArgs);
+BENCHMARK_TEMPLATE(MemoTableUniqueString10bytes, HashTable)->Apply(HashSetArgs);
+BENCHMARK_TEMPLATE(MemoTableUniqueString10bytes, SwissHashTable)->Apply(HashSetArgs);
+
 void UInt8SetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(uint8_bench_cases.size()); ++i) {
     bench->Arg(i);
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <numeric>
 #include <type_traits>
@@ -1019,508 +1021,454 @@ class RadixRecordBatchSorter {
   uint64_t* indices_end_;
 };
 
-// Compare two records in the same RecordBatch or Table
-// (indexing is handled through ResolvedSortKey)
-template <typename ResolvedSortKey>
-class MultipleKeyComparator {
+// ----------------------------------------------------------------------
+// Table sorting implementations
+
+// Sort a table using a radix sort-like algorithm.
+// A distinct stable sort is called for each sort key, from the last key to the first.
+class TableRadixSorter {
  public:
-  explicit MultipleKeyComparator(const std::vector<ResolvedSortKey>& sort_keys)
-      : sort_keys_(sort_keys) {}
-
-  Status status() const { return status_; }
-
-  // Returns true if the left-th value should be ordered before the
-  // right-th value, false otherwise. The start_sort_key_index-th
-  // sort key and subsequent sort keys are used for comparison.
-  bool Compare(uint64_t left, uint64_t right, size_t start_sort_key_index) {
-    current_left_ = left;
-    current_right_ = right;
-    current_compared_ = 0;
-    auto num_sort_keys = sort_keys_.size();
-    for (size_t i = start_sort_key_index; i < num_sort_keys; ++i) {
-      current_sort_key_index_ = i;
-      status_ = VisitTypeInline(*sort_keys_[i].type, this);
-      // If the left value equals to the right value, we need to
-      // continue to sort.
-      if (current_compared_ != 0) {
-        break;
+  Status Sort(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
+              const Table& table, const SortOptions& options) {
+    for (auto i = options.sort_keys.size(); i > 0; --i) {
+      const auto& sort_key = options.sort_keys[i - 1];
+      const auto& chunked_array = table.GetColumnByName(sort_key.name);
+      if (!chunked_array) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
       }
+      // We can use ArraySorter only for the sort key that is
+      // processed first because ArraySorter doesn't care about
+      // existing indices.
+      const auto can_use_array_sorter = (i == 0);
+      ChunkedArraySorter sorter(ctx, indices_begin, indices_end, *chunked_array.get(),
+                                sort_key.order, can_use_array_sorter);
+      ARROW_RETURN_NOT_OK(sorter.Sort());
     }
-    return current_compared_ < 0;
+    return Status::OK();
   }
+};
 
-#define VISIT(TYPE)                          \
-  Status Visit(const TYPE& type) {           \
-    current_compared_ = CompareType<TYPE>(); \
-    return Status::OK();                     \
-  }
+// ----------------------------------------------------------------------
+// Multiple-key radix sorting (for both RecordBatch and Table)
 
-  VISIT_PHYSICAL_TYPES(VISIT)
+// Order-preserving conversions of fixed-width values to unsigned integers.
+template <typename T>
+enable_if_t<std::is_unsigned<T>::value, uint64_t> NormalizeValue(T value) {
+  return value;
+}
 
-#undef VISIT
+template <typename T>
+enable_if_t<std::is_signed<T>::value && std::is_integral<T>::value, uint64_t>
+NormalizeValue(T value) {
+  // Flip the sign bit so that negative values come first
+  using Unsigned = typename std::make_unsigned<T>::type;
+  constexpr Unsigned kSignBit = static_cast<Unsigned>(1) << (sizeof(T) * 8 - 1);
+  return static_cast<Unsigned>(static_cast<Unsigned>(value) ^ kSignBit);
+}
 
-  Status Visit(const DataType& type) {
-    return Status::TypeError("Unsupported type for RecordBatch sorting: ",
-                             type.ToString());
+template <typename Float, typename Unsigned>
+uint64_t NormalizeFloat(Float value) {
+  constexpr Unsigned kSignBit = static_cast<Unsigned>(1) << (sizeof(Unsigned) * 8 - 1);
+  // -0.0 and 0.0 compare equal
+  if (value == 0) {
+    value = 0;
   }
+  Unsigned bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  // Negative values: reverse their order; positive values: put them after
+  // negative values
+  return static_cast<Unsigned>((bits & kSignBit) ? ~bits : (bits | kSignBit));
+}
 
- private:
-  // Compares two records in the same table and returns -1, 0 or 1.
-  //
-  // -1: The left is less than the right.
-  // 0: The left equals to the right.
-  // 1: The left is greater than the right.
-  //
-  // This supports null and NaN. Null is processed in this and NaN
-  // is processed in CompareTypeValue().
-  template <typename Type>
-  int32_t CompareType() {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
-    const auto& sort_key = sort_keys_[current_sort_key_index_];
-    auto order = sort_key.order;
-    const auto chunk_left = sort_key.template GetChunk<ArrayType>(current_left_);
-    const auto chunk_right = sort_key.template GetChunk<ArrayType>(current_right_);
-    if (sort_key.null_count > 0) {
-      auto is_null_left = chunk_left.IsNull();
-      auto is_null_right = chunk_right.IsNull();
-      if (is_null_left && is_null_right) {
-        return 0;
-      } else if (is_null_left) {
-        return 1;
-      } else if (is_null_right) {
-        return -1;
-      }
-    }
-    return CompareTypeValue<Type>(chunk_left, chunk_right, order);
-  }
+inline uint64_t NormalizeValue(float value) {
+  return NormalizeFloat<float, uint32_t>(value);
+}
 
-  // For non-float types. Value is never NaN.
-  template <typename Type>
-  enable_if_t<!is_floating_type<Type>::value, int32_t> CompareTypeValue(
-      const ResolvedChunk<typename TypeTraits<Type>::ArrayType>& chunk_left,
-      const ResolvedChunk<typename TypeTraits<Type>::ArrayType>& chunk_right,
-      const SortOrder order) {
-    const auto left = chunk_left.GetView();
-    const auto right = chunk_right.GetView();
-    int32_t compared;
-    if (left == right) {
-      compared = 0;
-    } else if (left > right) {
-      compared = 1;
-    } else {
-      compared = -1;
-    }
-    if (order == SortOrder::Descending) {
-      compared = -compared;
-    }
-    return compared;
-  }
+inline uint64_t NormalizeValue(double value) {
+  return NormalizeFloat<double, uint64_t>(value);
+}
 
-  // For float types. Value may be NaN.
-  template <typename Type>
-  enable_if_t<is_floating_type<Type>::value, int32_t> CompareTypeValue(
-      const ResolvedChunk<typename TypeTraits<Type>::ArrayType>& chunk_left,
-      const ResolvedChunk<typename TypeTraits<Type>::ArrayType>& chunk_right,
-      const SortOrder order) {
-    const auto left = chunk_left.GetView();
-    const auto right = chunk_right.GetView();
-    auto is_nan_left = std::isnan(left);
-    auto is_nan_right = std::isnan(right);
-    if (is_nan_left && is_nan_right) {
-      return 0;
-    } else if (is_nan_left) {
-      return 1;
-    } else if (is_nan_right) {
-      return -1;
-    }
-    int32_t compared;
-    if (left == right) {
-      compared = 0;
-    } else if (left > right) {
-      compared = 1;
-    } else {
-      compared = -1;
-    }
-    if (order == SortOrder::Descending) {
-      compared = -compared;
-    }
-    return compared;
+// The first 8 bytes of a binary value, such that comparing prefixes gives
+// the same order as comparing values, unless the prefixes are equal.
+inline uint64_t BinaryPrefix(util::string_view value) {
+  uint64_t prefix = 0;
+  const size_t length = std::min<size_t>(value.size(), sizeof(uint64_t));
+  for (size_t i = 0; i < length; ++i) {
+    prefix = (prefix << 8) | static_cast<uint8_t>(value[i]);
   }
+  return prefix << (8 * (sizeof(uint64_t) - length));
+}
 
-  const std::vector<ResolvedSortKey>& sort_keys_;
-  Status status_;
-  int64_t current_left_;
-  int64_t current_right_;
-  size_t current_sort_key_index_;
-  int32_t current_compared_;
-};
-
-// Sort a batch using a single sort and multiple-key comparisons.
-class MultipleKeyRecordBatchSorter : public TypeVisitor {
+// Sort a RecordBatch or a Table with radix sorts on normalized keys.
+//
+// Each sort key column is converted to "normalized keys": one unsigned
+// integer per row, whose order is the order of the column values (taking the
+// sort order into account).  Fixed-width values are converted with an
+// order-preserving bit transformation, binary values are replaced by their
+// rank among the column's values.
+//
+// Rows are then sorted by the first key using a stable byte-wise LSD radix
+// sort restricted to the significant bytes of the normalized keys, followed
+// by a stable counting pass moving NaNs and nulls to the end.  Each following
+// key is only used to sort the groups of rows still tied on the previous keys
+// (radix sorting by the key, then by group), so that the sort stops as soon as
+// the leading keys are unique.
+//
+// Normalized keys are computed by iterating over each chunk in turn, so
+// chunked columns don't need any per-element chunk resolution.
+class MultipleKeyRadixSorter : public TypeVisitor {
  private:
   // Preprocessed sort key.
   struct ResolvedSortKey {
-    ResolvedSortKey(const std::shared_ptr<Array>& array, const SortOrder order)
-        : type(GetPhysicalType(array->type())),
-          owned_array(GetPhysicalArray(*array, type)),
-          array(*owned_array),
-          order(order),
-          null_count(array->null_count()) {}
-
-    template <typename ArrayType>
-    ResolvedChunk<ArrayType> GetChunk(int64_t index) const {
-      return {&checked_cast<const ArrayType&>(array), index};
-    }
-
-    const std::shared_ptr<DataType> type;
-    std::shared_ptr<Array> owned_array;
-    const Array& array;
+    std::shared_ptr<DataType> type;
+    ArrayVector chunks;
     SortOrder order;
-    int64_t null_count;
   };
 
-  using Comparator = MultipleKeyComparator<ResolvedSortKey>;
+  // The order of null-like values, after all other values
+  enum RowClass : uint8_t { kValue = 0, kNaN = 1, kNull = 2 };
 
  public:
-  MultipleKeyRecordBatchSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                               const RecordBatch& batch, const SortOptions& options)
-      : indices_begin_(indices_begin),
-        indices_end_(indices_end),
-        sort_keys_(ResolveSortKeys(batch, options.sort_keys, &status_)),
-        comparator_(sort_keys_) {}
+  MultipleKeyRadixSorter(uint64_t* indices_begin, uint64_t* indices_end,
+                         const RecordBatch& batch, const SortOptions& options)
+      : indices_(indices_begin), length_(indices_end - indices_begin) {
+    for (const auto& sort_key : options.sort_keys) {
+      auto array = batch.GetColumnByName(sort_key.name);
+      if (!array) {
+        status_ = Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+        break;
+      }
+      auto physical_type = GetPhysicalType(array->type());
+      auto physical_array = GetPhysicalArray(*array, physical_type);
+      sort_keys_.push_back(
+          {std::move(physical_type), {std::move(physical_array)}, sort_key.order});
+    }
+  }
+
+  MultipleKeyRadixSorter(uint64_t* indices_begin, uint64_t* indices_end,
+                         const Table& table, const SortOptions& options)
+      : indices_(indices_begin), length_(indices_end - indices_begin) {
+    for (const auto& sort_key : options.sort_keys) {
+      const auto& chunked_array = table.GetColumnByName(sort_key.name);
+      if (!chunked_array) {
+        status_ = Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+        break;
+      }
+      auto physical_type = GetPhysicalType(chunked_array->type());
+      auto physical_chunks = GetPhysicalChunks(*chunked_array, physical_type);
+      sort_keys_.push_back(
+          {std::move(physical_type), std::move(physical_chunks), sort_key.order});
+    }
+  }
 
-  // This is optimized for the first sort key. The first sort key sort
-  // is processed in this class. The second and following sort keys
-  // are processed in Comparator.
   Status Sort() {
     RETURN_NOT_OK(status_);
-    return sort_keys_[0].type->Accept(this);
+    if (length_ <= 1) {
+      return Status::OK();
+    }
+    row_keys_.resize(length_);
+    // Initially, all rows are tied in a single group
+    tied_positions_.resize(length_);
+    std::iota(tied_positions_.begin(), tied_positions_.end(), 0);
+    tied_groups_.assign(length_, 0);
+    num_groups_ = 1;
+
+    for (const auto& sort_key : sort_keys_) {
+      current_sort_key_ = &sort_key;
+      has_null_likes_ = false;
+      RETURN_NOT_OK(sort_key.type->Accept(this));
+      SortTiedRows();
+      if (tied_positions_.empty()) {
+        break;
+      }
+    }
+    return Status::OK();
   }
 
 #define VISIT(TYPE) \
-  Status Visit(const TYPE& type) override { return SortInternal<TYPE>(); }
+  Status Visit(const TYPE& type) override { return NormalizeKeys(type); }
 
   VISIT_PHYSICAL_TYPES(VISIT)
 
 #undef VISIT
 
  private:
-  static std::vector<ResolvedSortKey> ResolveSortKeys(
-      const RecordBatch& batch, const std::vector<SortKey>& sort_keys, Status* status) {
-    std::vector<ResolvedSortKey> resolved;
-    for (const auto& sort_key : sort_keys) {
-      auto array = batch.GetColumnByName(sort_key.name);
-      if (!array) {
-        *status = Status::Invalid("Nonexistent sort key column: ", sort_key.name);
-        break;
-      }
-      resolved.emplace_back(array, sort_key.order);
+  // Whether the current sort key needs to be normalized for this row
+  bool IsTied(int64_t row) const { return all_tied_ || row_is_tied_[row]; }
+
+  void SetRowClass(int64_t row, RowClass row_class) {
+    if (!has_null_likes_) {
+      has_null_likes_ = true;
+      row_classes_.assign(length_, kValue);
     }
-    return resolved;
+    row_classes_[row] = row_class;
   }
 
-  template <typename Type>
-  Status SortInternal() {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
+  void StartNormalizedKeys() {
+    all_tied_ = static_cast<int64_t>(tied_positions_.size()) == length_;
+    if (!all_tied_) {
+      row_is_tied_.assign(length_, false);
+      for (const int64_t position : tied_positions_) {
+        row_is_tied_[indices_[position]] = true;
+      }
+    }
+  }
 
-    auto& comparator = comparator_;
-    const auto& first_sort_key = sort_keys_[0];
-    const ArrayType& array = checked_cast<const ArrayType&>(first_sort_key.array);
-    auto nulls_begin = indices_end_;
-    nulls_begin = PartitionNullsInternal<Type>(first_sort_key);
-    // Sort first-key non-nulls
-    std::stable_sort(indices_begin_, nulls_begin, [&](uint64_t left, uint64_t right) {
-      // Both values are never null nor NaN
-      // (otherwise they've been partitioned away above).
-      const auto value_left = array.GetView(left);
-      const auto value_right = array.GetView(right);
-      if (value_left != value_right) {
-        bool compared = value_left < value_right;
-        if (first_sort_key.order == SortOrder::Ascending) {
-          return compared;
-        } else {
-          return !compared;
-        }
+  // Rebase the normalized keys on their minimum (or maximum, for descending
+  // order), so that fewer bytes are significant
+  void FinishNormalizedKeys(uint64_t min_key, uint64_t max_key) {
+    const bool descending = current_sort_key_->order == SortOrder::Descending;
+    for (int64_t row = 0; row < length_; ++row) {
+      if (!IsTied(row) || (has_null_likes_ && row_classes_[row] != kValue)) {
+        row_keys_[row] = 0;
+      } else {
+        row_keys_[row] = descending ? max_key - row_keys_[row] : row_keys_[row] - min_key;
       }
-      // If the left value equals to the right value,
-      // we need to compare the second and following
-      // sort keys.
-      return comparator.Compare(left, right, 1);
-    });
-    return comparator_.status();
+    }
+    key_width_ = ByteWidth(max_key >= min_key ? max_key - min_key : 0);
   }
 
-  // Behaves like PatitionNulls() but this supports multiple sort keys.
-  //
-  // For non-float types.
   template <typename Type>
-  enable_if_t<!is_floating_type<Type>::value, uint64_t*> PartitionNullsInternal(
-      const ResolvedSortKey& first_sort_key) {
+  enable_if_t<is_integer_type<Type>::value || is_floating_type<Type>::value, Status>
+  NormalizeKeys(const Type&) {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
-    if (first_sort_key.null_count == 0) {
-      return indices_end_;
-    }
-    const ArrayType& array = checked_cast<const ArrayType&>(first_sort_key.array);
-    StablePartitioner partitioner;
-    auto nulls_begin = partitioner(indices_begin_, indices_end_,
-                                   [&](uint64_t index) { return !array.IsNull(index); });
-    // Sort all nulls by second and following sort keys
-    // TODO: could we instead run an independent sort from the second key on
-    // this slice?
-    if (nulls_begin != indices_end_) {
-      auto& comparator = comparator_;
-      std::stable_sort(nulls_begin, indices_end_,
-                       [&comparator](uint64_t left, uint64_t right) {
-                         return comparator.Compare(left, right, 1);
-                       });
+    StartNormalizedKeys();
+    uint64_t min_key = std::numeric_limits<uint64_t>::max();
+    uint64_t max_key = 0;
+    int64_t row = 0;
+    for (const auto& chunk : current_sort_key_->chunks) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      const auto* values = array.raw_values();
+      const bool may_have_nulls = array.null_count() > 0;
+      for (int64_t i = 0; i < array.length(); ++i, ++row) {
+        if (!IsTied(row)) {
+          continue;
+        }
+        if (may_have_nulls && array.IsNull(i)) {
+          SetRowClass(row, kNull);
+        } else if (NullTraits<Type>::has_null_like_values && std::isnan(values[i])) {
+          SetRowClass(row, kNaN);
+        } else {
+          const uint64_t key = NormalizeValue(values[i]);
+          min_key = std::min(min_key, key);
+          max_key = std::max(max_key, key);
+          row_keys_[row] = key;
+        }
+      }
     }
-    return nulls_begin;
+    DCHECK_EQ(row, length_);
+    FinishNormalizedKeys(min_key, max_key);
+    return Status::OK();
   }
 
-  // Behaves like PatitionNulls() but this supports multiple sort keys.
-  //
-  // For float types.
   template <typename Type>
-  enable_if_t<is_floating_type<Type>::value, uint64_t*> PartitionNullsInternal(
-      const ResolvedSortKey& first_sort_key) {
+  enable_if_base_binary<Type, Status> NormalizeKeys(const Type&) {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
-    const ArrayType& array = checked_cast<const ArrayType&>(first_sort_key.array);
-    StablePartitioner partitioner;
-    uint64_t* nulls_begin;
-    if (first_sort_key.null_count == 0) {
-      nulls_begin = indices_end_;
-    } else {
-      nulls_begin = partitioner(indices_begin_, indices_end_,
-                                [&](uint64_t index) { return !array.IsNull(index); });
-    }
-    uint64_t* nans_and_nulls_begin =
-        partitioner(indices_begin_, nulls_begin,
-                    [&](uint64_t index) { return !std::isnan(array.GetView(index)); });
-    auto& comparator = comparator_;
-    if (nans_and_nulls_begin != nulls_begin) {
-      // Sort all NaNs by the second and following sort keys.
-      // TODO: could we instead run an independent sort from the second key on
-      // this slice?
-      std::stable_sort(nans_and_nulls_begin, nulls_begin,
-                       [&comparator](uint64_t left, uint64_t right) {
-                         return comparator.Compare(left, right, 1);
-                       });
-    }
-    if (nulls_begin != indices_end_) {
-      // Sort all nulls by the second and following sort keys.
-      // TODO: could we instead run an independent sort from the second key on
-      // this slice?
-      std::stable_sort(nulls_begin, indices_end_,
-                       [&comparator](uint64_t left, uint64_t right) {
-                         return comparator.Compare(left, right, 1);
-                       });
+    StartNormalizedKeys();
+    // Sort the rows by value, comparing prefixes before falling back on
+    // full comparisons, then replace each value by its rank
+    std::vector<util::string_view> values(length_);
+    std::vector<uint64_t> prefixes(length_);
+    std::vector<uint64_t> sorted_rows;
+    sorted_rows.reserve(tied_positions_.size());
+    int64_t row = 0;
+    for (const auto& chunk : current_sort_key_->chunks) {
+      const auto& array = checked_cast<const ArrayType&>(*chunk);
+      const bool may_have_nulls = array.null_count() > 0;
+      for (int64_t i = 0; i < array.length(); ++i, ++row) {
+        if (!IsTied(row)) {
+          continue;
+        }
+        if (may_have_nulls && array.IsNull(i)) {
+          SetRowClass(row, kNull);
+        } else {
+          values[row] = array.GetView(i);
+          prefixes[row] = BinaryPrefix(values[row]);
+          sorted_rows.push_back(row);
+        }
+      }
     }
-    return nans_and_nulls_begin;
-  }
-
-  uint64_t* indices_begin_;
-  uint64_t* indices_end_;
-  Status status_;
-  std::vector<ResolvedSortKey> sort_keys_;
-  Comparator comparator_;
-};
-
-// ----------------------------------------------------------------------
-// Table sorting implementations
-
-// Sort a table using a radix sort-like algorithm.
-// A distinct stable sort is called for each sort key, from the last key to the first.
-class TableRadixSorter {
- public:
-  Status Sort(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end,
-              const Table& table, const SortOptions& options) {
-    for (auto i = options.sort_keys.size(); i > 0; --i) {
-      const auto& sort_key = options.sort_keys[i - 1];
-      const auto& chunked_array = table.GetColumnByName(sort_key.name);
-      if (!chunked_array) {
-        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+    DCHECK_EQ(row, length_);
+    std::sort(sorted_rows.begin(), sorted_rows.end(), [&](uint64_t left, uint64_t right) {
+      if (prefixes[left] != prefixes[right]) {
+        return prefixes[left] < prefixes[right];
       }
-      // We can use ArraySorter only for the sort key that is
-      // processed first because ArraySorter doesn't care about
-      // existing indices.
-      const auto can_use_array_sorter = (i == 0);
-      ChunkedArraySorter sorter(ctx, indices_begin, indices_end, *chunked_array.get(),
-                                sort_key.order, can_use_array_sorter);
-      ARROW_RETURN_NOT_OK(sorter.Sort());
+      return values[left] < values[right];
+    });
+    uint64_t rank = 0;
+    for (size_t i = 0; i < sorted_rows.size(); ++i) {
+      if (i > 0 && values[sorted_rows[i]] != values[sorted_rows[i - 1]]) {
+        ++rank;
+      }
+      row_keys_[sorted_rows[i]] = rank;
     }
+    FinishNormalizedKeys(0, rank);
     return Status::OK();
   }
-};
 
-// Sort a table using a single sort and multiple-key comparisons.
-class MultipleKeyTableSorter : public TypeVisitor {
- private:
-  // TODO instead of resolving chunks for each column independently, we could
-  // split the table into RecordBatches and pay the cost of chunked indexing
-  // at the first column only.
-
-  // Preprocessed sort key.
-  struct ResolvedSortKey {
-    ResolvedSortKey(const ChunkedArray& chunked_array, const SortOrder order)
-        : order(order),
-          type(GetPhysicalType(chunked_array.type())),
-          chunks(GetPhysicalChunks(chunked_array, type)),
-          chunk_pointers(GetArrayPointers(chunks)),
-          null_count(chunked_array.null_count()),
-          num_chunks(chunked_array.num_chunks()),
-          resolver(chunk_pointers) {}
-
-    // Finds the target chunk and index in the target chunk from an
-    // index in chunked array.
-    template <typename ArrayType>
-    ResolvedChunk<ArrayType> GetChunk(int64_t index) const {
-      return resolver.Resolve<ArrayType>(index);
+  static int ByteWidth(uint64_t max_value) {
+    int width = 0;
+    while (width < 8 && (max_value >> (8 * width)) != 0) {
+      ++width;
     }
-
-    const SortOrder order;
-    const std::shared_ptr<DataType> type;
-    const ArrayVector chunks;
-    const std::vector<const Array*> chunk_pointers;
-    const int64_t null_count;
-    const int num_chunks;
-    const ChunkedArrayResolver resolver;
-  };
-
-  using Comparator = MultipleKeyComparator<ResolvedSortKey>;
-
- public:
-  MultipleKeyTableSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                         const Table& table, const SortOptions& options)
-      : indices_begin_(indices_begin),
-        indices_end_(indices_end),
-        sort_keys_(ResolveSortKeys(table, options.sort_keys, &status_)),
-        comparator_(sort_keys_) {}
-
-  // This is optimized for the first sort key. The first sort key sort
-  // is processed in this class. The second and following sort keys
-  // are processed in Comparator.
-  Status Sort() {
-    ARROW_RETURN_NOT_OK(status_);
-    return sort_keys_[0].type->Accept(this);
+    return width;
   }
 
-#define VISIT(TYPE) \
-  Status Visit(const TYPE& type) override { return SortInternal<TYPE>(); }
-
-  VISIT_PHYSICAL_TYPES(VISIT)
-
-#undef VISIT
-
- private:
-  static std::vector<ResolvedSortKey> ResolveSortKeys(
-      const Table& table, const std::vector<SortKey>& sort_keys, Status* status) {
-    std::vector<ResolvedSortKey> resolved;
-    resolved.reserve(sort_keys.size());
-    for (const auto& sort_key : sort_keys) {
-      const auto& chunked_array = table.GetColumnByName(sort_key.name);
-      if (!chunked_array) {
-        *status = Status::Invalid("Nonexistent sort key column: ", sort_key.name);
-        break;
+  // Sort the tied rows by (group, null-likes, normalized key), then find the
+  // groups of rows still tied
+  void SortTiedRows() {
+    const int64_t num_tied = static_cast<int64_t>(tied_positions_.size());
+    order_.resize(num_tied);
+    std::iota(order_.begin(), order_.end(), 0);
+
+    if (num_tied < kMinRadixGroupSize * static_cast<int64_t>(num_groups_)) {
+      // Radix passes over all tied rows would be more expensive than
+      // comparison sorts of the small groups
+      auto key_less = [&](int64_t left, int64_t right) {
+        const uint64_t left_row = indices_[tied_positions_[left]];
+        const uint64_t right_row = indices_[tied_positions_[right]];
+        if (has_null_likes_ && row_classes_[left_row] != row_classes_[right_row]) {
+          return row_classes_[left_row] < row_classes_[right_row];
+        }
+        return row_keys_[left_row] < row_keys_[right_row];
+      };
+      int64_t group_start = 0;
+      for (int64_t i = 1; i <= num_tied; ++i) {
+        if (i == num_tied || tied_groups_[i] != tied_groups_[group_start]) {
+          std::stable_sort(order_.begin() + group_start, order_.begin() + i, key_less);
+          group_start = i;
+        }
+      }
+    } else {
+      // LSD: least significant criterion first
+      RadixSortOrder(key_width_, [&](int64_t i) {
+        return row_keys_[indices_[tied_positions_[i]]];
+      });
+      if (has_null_likes_) {
+        RadixSortOrder(1, [&](int64_t i) {
+          return static_cast<uint64_t>(row_classes_[indices_[tied_positions_[i]]]);
+        });
       }
-      resolved.emplace_back(*chunked_array, sort_key.order);
+      RadixSortOrder(ByteWidth(num_groups_ - 1),
+                     [&](int64_t i) { return tied_groups_[i]; });
     }
-    return resolved;
-  }
 
-  template <typename Type>
-  Status SortInternal() {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    // Write back the sorted rows.  Since the groups are sorted and occupy
+    // contiguous positions, the rows stay in their group's positions.
+    std::vector<uint64_t> sorted_rows(num_tied);
+    std::vector<uint64_t> sorted_groups(num_tied);
+    for (int64_t i = 0; i < num_tied; ++i) {
+      sorted_rows[i] = indices_[tied_positions_[order_[i]]];
+      sorted_groups[i] = tied_groups_[order_[i]];
+    }
+    for (int64_t i = 0; i < num_tied; ++i) {
+      indices_[tied_positions_[i]] = sorted_rows[i];
+    }
 
-    auto& comparator = comparator_;
-    const auto& first_sort_key = sort_keys_[0];
-    auto nulls_begin = indices_end_;
-    nulls_begin = PartitionNullsInternal<Type>(first_sort_key);
-    std::stable_sort(indices_begin_, nulls_begin, [&](uint64_t left, uint64_t right) {
-      // Both values are never null nor NaN.
-      auto chunk_left = first_sort_key.GetChunk<ArrayType>(left);
-      auto chunk_right = first_sort_key.GetChunk<ArrayType>(right);
-      auto value_left = chunk_left.GetView();
-      auto value_right = chunk_right.GetView();
-      if (value_left == value_right) {
-        // If the left value equals to the right value,
-        // we need to compare the second and following
-        // sort keys.
-        return comparator.Compare(left, right, 1);
-      } else {
-        auto compared = value_left < value_right;
-        if (first_sort_key.order == SortOrder::Ascending) {
-          return compared;
-        } else {
-          return !compared;
+    // Find the new groups of tied rows, discarding single rows
+    auto same_class = [&](uint64_t left, uint64_t right) {
+      return !has_null_likes_ || row_classes_[left] == row_classes_[right];
+    };
+    std::vector<int64_t> new_positions;
+    std::vector<uint64_t> new_groups;
+    uint64_t num_new_groups = 0;
+    int64_t run_start = 0;
+    for (int64_t i = 1; i <= num_tied; ++i) {
+      if (i < num_tied && sorted_groups[i] == sorted_groups[run_start] &&
+          row_keys_[sorted_rows[i]] == row_keys_[sorted_rows[run_start]] &&
+          same_class(sorted_rows[i], sorted_rows[run_start])) {
+        continue;
+      }
+      if (i - run_start > 1) {
+        for (int64_t j = run_start; j < i; ++j) {
+          new_positions.push_back(tied_positions_[j]);
+          new_groups.push_back(num_new_groups);
         }
+        ++num_new_groups;
       }
-    });
-    return comparator_.status();
+      run_start = i;
+    }
+    tied_positions_ = std::move(new_positions);
+    tied_groups_ = std::move(new_groups);
+    num_groups_ = num_new_groups;
   }
 
-  // Behaves like PatitionNulls() but this supports multiple sort keys.
-  //
-  // For non-float types.
-  template <typename Type>
-  enable_if_t<!is_floating_type<Type>::value, uint64_t*> PartitionNullsInternal(
-      const ResolvedSortKey& first_sort_key) {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
-    if (first_sort_key.null_count == 0) {
-      return indices_end_;
+  // Stable LSD radix sort of order_ by the `width` low bytes of key_of(i)
+  template <typename KeyFunc>
+  void RadixSortOrder(int width, KeyFunc&& key_of) {
+    if (width == 0) {
+      return;
+    }
+    const int64_t length = static_cast<int64_t>(order_.size());
+    keys_.resize(length);
+    keys_scratch_.resize(length);
+    order_scratch_.resize(length);
+
+    // Compute the histograms of all bytes in a single pass
+    std::vector<std::array<int64_t, 256>> histograms(width);
+    for (auto& histogram : histograms) {
+      histogram.fill(0);
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const uint64_t key = key_of(order_[i]);
+      keys_[i] = key;
+      for (int byte = 0; byte < width; ++byte) {
+        ++histograms[byte][(key >> (8 * byte)) & 0xff];
+      }
     }
-    StablePartitioner partitioner;
-    auto nulls_begin =
-        partitioner(indices_begin_, indices_end_, [&first_sort_key](uint64_t index) {
-          const auto chunk = first_sort_key.GetChunk<ArrayType>(index);
-          return !chunk.IsNull();
-        });
-    DCHECK_EQ(indices_end_ - nulls_begin, first_sort_key.null_count);
-    auto& comparator = comparator_;
-    std::stable_sort(nulls_begin, indices_end_, [&](uint64_t left, uint64_t right) {
-      return comparator.Compare(left, right, 1);
-    });
-    return nulls_begin;
-  }
 
-  // Behaves like PatitionNulls() but this supports multiple sort keys.
-  //
-  // For float types.
-  template <typename Type>
-  enable_if_t<is_floating_type<Type>::value, uint64_t*> PartitionNullsInternal(
-      const ResolvedSortKey& first_sort_key) {
-    using ArrayType = typename TypeTraits<Type>::ArrayType;
-    StablePartitioner partitioner;
-    uint64_t* nulls_begin;
-    if (first_sort_key.null_count == 0) {
-      nulls_begin = indices_end_;
-    } else {
-      nulls_begin = partitioner(indices_begin_, indices_end_, [&](uint64_t index) {
-        const auto chunk = first_sort_key.GetChunk<ArrayType>(index);
-        return !chunk.IsNull();
-      });
+    for (int byte = 0; byte < width; ++byte) {
+      auto& histogram = histograms[byte];
+      const int shift = 8 * byte;
+      if (histogram[(keys_[0] >> shift) & 0xff] == length) {
+        // All keys have the same byte here
+        continue;
+      }
+      // Turn counts into starting offsets
+      int64_t offset = 0;
+      for (auto& count : histogram) {
+        const int64_t bucket_size = count;
+        count = offset;
+        offset += bucket_size;
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t pos = histogram[(keys_[i] >> shift) & 0xff]++;
+        keys_scratch_[pos] = keys_[i];
+        order_scratch_[pos] = order_[i];
+      }
+      keys_.swap(keys_scratch_);
+      order_.swap(order_scratch_);
     }
-    DCHECK_EQ(indices_end_ - nulls_begin, first_sort_key.null_count);
-    uint64_t* nans_begin = partitioner(indices_begin_, nulls_begin, [&](uint64_t index) {
-      const auto chunk = first_sort_key.GetChunk<ArrayType>(index);
-      return !std::isnan(chunk.GetView());
-    });
-    auto& comparator = comparator_;
-    // Sort all NaNs by the second and following sort keys.
-    std::stable_sort(nans_begin, nulls_begin, [&](uint64_t left, uint64_t right) {
-      return comparator.Compare(left, right, 1);
-    });
-    // Sort all nulls by the second and following sort keys.
-    std::stable_sort(nulls_begin, indices_end_, [&](uint64_t left, uint64_t right) {
-      return comparator.Compare(left, right, 1);
-    });
-    return nans_begin;
   }
 
-  uint64_t* indices_begin_;
-  uint64_t* indices_end_;
+  // Below this average group size, groups of tied rows are comparison sorted
+  static constexpr int64_t kMinRadixGroupSize = 1024;
+
+  uint64_t* indices_;
+  const int64_t length_;
   Status status_;
   std::vector<ResolvedSortKey> sort_keys_;
-  Comparator comparator_;
+
+  // Normalized keys of the current sort key, by row
+  const ResolvedSortKey* current_sort_key_ = nullptr;
+  std::vector<uint64_t> row_keys_;
+  std::vector<uint8_t> row_classes_;
+  bool has_null_likes_ = false;
+  int key_width_ = 0;
+
+  // Positions in indices_ of the rows not fully sorted yet, and their group
+  // of tied rows
+  std::vector<int64_t> tied_positions_;
+  std::vector<uint64_t> tied_groups_;
+  uint64_t num_groups_ = 0;
+  bool all_tied_ = true;
+  std::vector<bool> row_is_tied_;
+
+  // Scratch space for radix sorting
+  std::vector<int64_t> order_;
+  std::vector<int64_t> order_scratch_;
+  std::vector<uint64_t> keys_;
+  std::vector<uint64_t> keys_scratch_;
 };
 
 // ----------------------------------------------------------------------
@@ -1633,12 +1581,13 @@ class SortIndicesMetaFunction : public MetaFunction {
 
     // Radix sorting is consistently faster except when there is a large number
     // of sort keys, in which case it can end up degrading catastrophically.
-    // Cut off above 8 sort keys.
+    // Cut off above 8 sort keys, where MultipleKeyRadixSorter is faster
+    // since it only considers a key for the rows tied on the previous keys.
     if (n_sort_keys <= 8) {
       RadixRecordBatchSorter sorter(out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
-      MultipleKeyRecordBatchSorter sorter(out_begin, out_end, batch, options);
+      MultipleKeyRadixSorter sorter(out_begin, out_end, batch, options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     }
     return Datum(out);
@@ -1671,15 +1620,9 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
-    // TODO: We should choose suitable sort implementation
-    // automatically. The current TableRadixSorter implementation is
-    // faster than MultipleKeyTableSorter only when the number of
-    // sort keys is 2 and counting sort is used. So we always
-    // MultipleKeyTableSorter for now.
-    //
-    // TableRadixSorter sorter;
-    // ARROW_RETURN_NOT_OK(sorter.Sort(ctx, out_begin, out_end, table, options));
-    MultipleKeyTableSorter sorter(out_begin, out_end, table, options);
+    // Normalized keys are computed chunk by chunk, which avoids the cost of
+    // chunk resolution for each comparison.
+    MultipleKeyRadixSorter sorter(out_begin, out_end, table, options);
     ARROW_RETURN_NOT_OK(sorter.Sort());
     return Datum(out);
   }
@@ -180,6 +180,52 @@ BatchOrTableBenchmarkData MakeBatchOrTableBenchmarkDataInt64(
   return data;
 }
 
+// Columns cycle through int32, double and string types, for multiple-key
+// sorts on keys of different kinds
+BatchOrTableBenchmarkData MakeBatchOrTableBenchmarkDataMixed(
+    const RecordBatchSortIndicesArgs& args, int64_t num_chunks) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  FieldVector fields;
+  BatchOrTableBenchmarkData data;
+
+  for (int64_t i = 0; i < args.num_columns; ++i) {
+    auto name = std::to_string(i);
+    auto order = (i % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+    data.sort_keys.emplace_back(name, order);
+    if ((args.num_records % num_chunks) != 0) {
+      Status::Invalid("The number of chunks (", num_chunks,
+                      ") must be "
+                      "a multiple of the number of records (",
+                      args.num_records, ")")
+          .Abort();
+    }
+    auto num_records_in_array = args.num_records / num_chunks;
+    ArrayVector chunks;
+    for (int64_t j = 0; j < num_chunks; ++j) {
+      switch (i % 3) {
+        case 0:
+          chunks.push_back(rand.Int32(num_records_in_array, -1000, 1000,
+                                      args.null_proportion));
+          break;
+        case 1:
+          chunks.push_back(
+              rand.Float64(num_records_in_array, -1e6, 1e6, args.null_proportion));
+          break;
+        default:
+          chunks.push_back(rand.String(num_records_in_array, /*min_length=*/0,
+                                       /*max_length=*/16, args.null_proportion));
+          break;
+      }
+    }
+    ASSIGN_OR_ABORT(auto chunked_array, ChunkedArray::Make(chunks));
+    fields.push_back(field(name, chunked_array->type()));
+    data.columns.push_back(chunked_array);
+  }
+
+  data.schema = schema(fields);
+  return data;
+}
+
 static void RecordBatchSortIndicesInt64(benchmark::State& state, int64_t min,
                                         int64_t max) {
   RecordBatchSortIndicesArgs args(state);
@@ -205,6 +251,29 @@ static void TableSortIndicesInt64(benchmark::State& state, int64_t min, int64_t
   DatumSortIndicesBenchmark(state, Datum(*table), options);
 }
 
+static void RecordBatchSortIndicesMixed(benchmark::State& state) {
+  RecordBatchSortIndicesArgs args(state);
+
+  auto data = MakeBatchOrTableBenchmarkDataMixed(args, /*num_chunks=*/1);
+  ArrayVector columns;
+  for (const auto& chunked : data.columns) {
+    columns.push_back(chunked->chunk(0));
+  }
+
+  auto batch = RecordBatch::Make(data.schema, args.num_records, columns);
+  SortOptions options(data.sort_keys);
+  DatumSortIndicesBenchmark(state, Datum(*batch), options);
+}
+
+static void TableSortIndicesMixed(benchmark::State& state) {
+  TableSortIndicesArgs args(state);
+
+  auto data = MakeBatchOrTableBenchmarkDataMixed(args, args.num_chunks);
+  auto table = Table::Make(data.schema, data.columns, args.num_records);
+  SortOptions options(data.sort_keys);
+  DatumSortIndicesBenchmark(state, Datum(*table), options);
+}
+
 static void RecordBatchSortIndicesInt64Narrow(benchmark::State& state) {
   RecordBatchSortIndicesInt64(state, -100, 100);
 }
@@ -281,5 +350,22 @@ BENCHMARK(TableSortIndicesInt64Wide)
     })
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(RecordBatchSortIndicesMixed)
+    ->ArgsProduct({
+        {1 << 20},      // the number of records
+        {100, 0},       // inverse null proportion
+        {16, 8, 2, 1},  // the number of columns
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(TableSortIndicesMixed)
+    ->ArgsProduct({
+        {1 << 20},      // the number of records
+        {100, 0},       // inverse null proportion
+        {16, 8, 2, 1},  // the number of columns
+        {32, 4, 1},     // the number of chunks
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
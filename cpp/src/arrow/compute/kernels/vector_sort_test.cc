@@ -858,6 +858,24 @@ TEST_F(TestTableSortIndices, NaNAndNull) {
   AssertSortIndices(table, options, "[7, 1, 2, 6, 5, 4, 0, 3]");
 }
 
+TEST_F(TestTableSortIndices, SignedZeros) {
+  // -0.0 and 0.0 compare equal, so the next key decides
+  auto schema = ::arrow::schema({
+      {field("a", float64())},
+      {field("b", int32())},
+  });
+  SortOptions options(
+      {SortKey("a", SortOrder::Ascending), SortKey("b", SortOrder::Ascending)});
+  auto table = TableFromJSON(schema, {R"([{"a": 0.0,  "b": 3},
+                                          {"a": -0.0, "b": 2},
+                                          {"a": -1.0, "b": 5}
+                                         ])",
+                                      R"([{"a": -0.0, "b": 4},
+                                          {"a": 0.0,  "b": 1}
+                                         ])"});
+  AssertSortIndices(table, options, "[2, 4, 1, 0, 3]");
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -1053,32 +1071,97 @@ TEST_P(TestTableSortIndicesRandom, Sort) {
   const auto table = Table::Make(schema(fields), columns, length);
   std::default_random_engine engine(seed);
   std::uniform_int_distribution<> distribution(0);
-  const auto n_sort_keys = 5;
-  std::vector<SortKey> sort_keys;
-  const auto first_sort_key_order =
-      (distribution(engine) % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
-  sort_keys.emplace_back(first_sort_key_name, first_sort_key_order);
-  for (int i = 1; i < n_sort_keys; ++i) {
-    const auto& column_name = column_names[distribution(engine) % column_names.size()];
-    const auto order =
+  // Record batches are sorted differently with more than 8 sort keys
+  for (const int n_sort_keys : {5, 12}) {
+    std::vector<SortKey> sort_keys;
+    const auto first_sort_key_order =
         (distribution(engine) % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
-    sort_keys.emplace_back(column_name, order);
+    sort_keys.emplace_back(first_sort_key_name, first_sort_key_order);
+    for (int i = 1; i < n_sort_keys; ++i) {
+      const auto& column_name = column_names[distribution(engine) % column_names.size()];
+      const auto order =
+          (distribution(engine) % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+      sort_keys.emplace_back(column_name, order);
+    }
+    SortOptions options(sort_keys);
+    for (const int64_t num_chunks : {1, 2, 20}) {
+      TableBatchReader reader(*table);
+      reader.set_chunksize((length + num_chunks - 1) / num_chunks);
+      ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+      ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*chunked_table), options));
+      Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+    }
+    // Also validate RecordBatch sorting
+    TableBatchReader reader(*table);
+    RecordBatchVector batches;
+    ASSERT_OK(reader.ReadAll(&batches));
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*batches[0]), options));
+    Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
   }
-  SortOptions options(sort_keys);
-  for (const int64_t num_chunks : {1, 2, 20}) {
+}
+
+// Enough rows for groups of tied rows to be radix sorted, with small integer
+// ranges so that large groups of ties remain after the first sort keys
+TEST_P(TestTableSortIndicesRandom, SortManyRows) {
+  const auto first_sort_key_name = std::get<0>(GetParam());
+  const auto null_probability = std::get<1>(GetParam());
+  const auto seed = 0x61549225;
+  std::vector<std::string> column_names = {
+      "uint8", "uint16", "uint32", "uint64", "int8",   "int16",
+      "int32", "int64",  "float",  "double", "string",
+  };
+  std::vector<std::shared_ptr<Field>> fields = {
+      {field(column_names[0], uint8())},   {field(column_names[1], uint16())},
+      {field(column_names[2], uint32())},  {field(column_names[3], uint64())},
+      {field(column_names[4], int8())},    {field(column_names[5], int16())},
+      {field(column_names[6], int32())},   {field(column_names[7], int64())},
+      {field(column_names[8], float32())}, {field(column_names[9], float64())},
+      {field(column_names[10], utf8())},
+  };
+  const auto length = 5000;
+  std::vector<std::shared_ptr<Array>> columns = {
+      RandomRange<UInt8Type>(seed).Generate(length, 2, null_probability),
+      RandomRange<UInt16Type>(seed).Generate(length, 3, 0.0),
+      RandomRange<UInt32Type>(seed).Generate(length, 1000, null_probability),
+      Random<UInt64Type>(seed).Generate(length, 0.0),
+      RandomRange<Int8Type>(seed).Generate(length, 4, 0.0),
+      RandomRange<Int16Type>(seed).Generate(length, 2, null_probability),
+      Random<Int32Type>(seed).Generate(length, 0.0),
+      RandomRange<Int64Type>(seed).Generate(length, 3, null_probability),
+      Random<FloatType>(seed).Generate(length, null_probability, 1 - null_probability),
+      Random<DoubleType>(seed).Generate(length, 0.0, null_probability),
+      Random<StringType>(seed).Generate(length, null_probability),
+  };
+  const auto table = Table::Make(schema(fields), columns, length);
+  std::default_random_engine engine(seed);
+  std::uniform_int_distribution<> distribution(0);
+  for (const int n_sort_keys : {3, 12}) {
+    std::vector<SortKey> sort_keys;
+    const auto first_sort_key_order =
+        (distribution(engine) % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+    sort_keys.emplace_back(first_sort_key_name, first_sort_key_order);
+    for (int i = 1; i < n_sort_keys; ++i) {
+      const auto& column_name = column_names[distribution(engine) % column_names.size()];
+      const auto order =
+          (distribution(engine) % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+      sort_keys.emplace_back(column_name, order);
+    }
+    SortOptions options(sort_keys);
+    for (const int64_t num_chunks : {1, 3}) {
+      TableBatchReader reader(*table);
+      reader.set_chunksize((length + num_chunks - 1) / num_chunks);
+      ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
+      ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*chunked_table), options));
+      Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+    }
     TableBatchReader reader(*table);
-    reader.set_chunksize((length + num_chunks - 1) / num_chunks);
-    ASSERT_OK_AND_ASSIGN(auto chunked_table, Table::FromRecordBatchReader(&reader));
-    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*chunked_table), options));
+    RecordBatchVector batches;
+    ASSERT_OK(reader.ReadAll(&batches));
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*batches[0]), options));
     Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
   }
-  // Also validate RecordBatch sorting
-  TableBatchReader reader(*table);
-  RecordBatchVector batches;
-  ASSERT_OK(reader.ReadAll(&batches));
-  ASSERT_EQ(batches.size(), 1);
-  ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*batches[0]), options));
-  Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
 }
 
 INSTANTIATE_TEST_SUITE_P(NoNull, TestTableSortIndicesRandom,
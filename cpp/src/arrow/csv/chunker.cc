@@ -21,6 +21,7 @@
 #include <memory>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
@@ -31,8 +32,6 @@ namespace csv {
 
 namespace {
 
-// NOTE: csvmonkey (https://github.com/dw/csvmonkey) has optimization ideas
-
 template <bool quoting, bool escaping>
 class Lexer {
  public:
@@ -45,7 +44,7 @@ class Lexer {
     AT_QUOTED_ESCAPE
   };
 
-  explicit Lexer(const ParseOptions& options) : options_(options) {
+  explicit Lexer(const ParseOptions& options) : options_(options), scanner_(options_) {
     DCHECK_EQ(quoting, options_.quoting);
     DCHECK_EQ(escaping, options_.escaping);
   }
@@ -54,6 +53,9 @@ class Lexer {
     // The parsing state machine
     char c;
     DCHECK_GT(data_end - data, 0);
+    if (data_end != scanner_.end()) {
+      scanner_.Reset(data, data_end);
+    }
     if (ARROW_PREDICT_TRUE(state_ == FIELD_START)) {
       goto FieldStart;
     }
@@ -92,6 +94,12 @@ class Lexer {
       state_ = IN_FIELD;
       goto AbortLine;
     }
+    // Skip ordinary characters at once
+    data = scanner_.Next(data);
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      state_ = IN_FIELD;
+      goto AbortLine;
+    }
     c = *data++;
     if (escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
       if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -126,6 +134,11 @@ class Lexer {
       state_ = IN_QUOTED_FIELD;
       goto AbortLine;
     }
+    data = scanner_.Next(data);
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      state_ = IN_QUOTED_FIELD;
+      goto AbortLine;
+    }
     c = *data++;
     if (escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
       if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -180,6 +193,7 @@ class Lexer {
 
  protected:
   const ParseOptions& options_;
+  detail::SpecialCharScanner scanner_;
   State state_ = FIELD_START;
 };
 
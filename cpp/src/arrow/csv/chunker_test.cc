@@ -19,6 +19,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -122,6 +123,23 @@ TEST_P(BaseChunkerTest, Newlines) {
   }
 }
 
+TEST_P(BaseChunkerTest, LongValues) {
+  // Values spanning several SIMD blocks
+  const std::string a(100, 'a'), b(63, 'b'), c(64, 'c');
+  auto line1 = a + "," + b + "\n";
+  auto line2 = c + ",\"" + a + "\"\r";
+  auto line3 = b + "," + c + "\n";
+  auto csv = MakeCSVData({line1, line2, line3});
+  auto lengths = {line1.size(), line2.size(), line3.size()};
+
+  MakeChunker();
+  AssertChunking(*chunker_, csv, lengths);
+  if (options_.newlines_in_values) {
+    csv = MakeCSVData({"\"" + a + "\n" + b + "\"\"\n" + c + "\"," + a + "\n"});
+    AssertChunking(*chunker_, csv, std::vector<size_t>{csv.size()});
+  }
+}
+
 TEST_P(BaseChunkerTest, QuotingSimple) {
   auto csv = MakeCSVData({"1,\",3,\",5\n"});
   {
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/lexing_internal.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+#include "arrow/util/simd.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#include "arrow/csv/lexing_internal_avx2.h"
+#endif
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+namespace {
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+inline uint16_t ClassifySse42(const uint8_t* data, const __m128i* special_chars) {
+  const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i matches = _mm_cmpeq_epi8(v, special_chars[0]);
+  for (int i = 1; i < kNumSpecialChars; ++i) {
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, special_chars[i]));
+  }
+  return static_cast<uint16_t>(_mm_movemask_epi8(matches));
+}
+
+uint64_t ClassifyBlockDefault(const uint8_t* data, const uint8_t* special_chars) {
+  __m128i chars[kNumSpecialChars];
+  for (int i = 0; i < kNumSpecialChars; ++i) {
+    chars[i] = _mm_set1_epi8(static_cast<char>(special_chars[i]));
+  }
+  uint64_t mask = 0;
+  for (int64_t i = 0; i < kClassifyBlockSize; i += 16) {
+    mask |= static_cast<uint64_t>(ClassifySse42(data + i, chars)) << i;
+  }
+  return mask;
+}
+
+#else
+
+uint64_t ClassifyBlockDefault(const uint8_t* data, const uint8_t* special_chars) {
+  uint64_t mask = 0;
+  for (int64_t i = 0; i < kClassifyBlockSize; ++i) {
+    bool is_special = false;
+    for (int j = 0; j < kNumSpecialChars; ++j) {
+      is_special |= (data[i] == special_chars[j]);
+    }
+    mask |= static_cast<uint64_t>(is_special) << i;
+  }
+  return mask;
+}
+
+#endif
+
+struct ClassifyBlockDynamicFunction {
+  using FunctionType = ClassifyBlockFunc;
+
+  static std::vector<std::pair<::arrow::internal::DispatchLevel, FunctionType>>
+  implementations() {
+    using ::arrow::internal::DispatchLevel;
+    return {
+      { DispatchLevel::NONE, ClassifyBlockDefault }
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+      , { DispatchLevel::AVX2, ClassifyBlockAvx2 }
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+const char* SpecialCharScanner::NextSlow(const char* data) {
+  if (data < window_ || data - window_ >= kClassifyBlockSize) {
+    Load(data);
+  }
+  while (true) {
+    const uint64_t mask = mask_ & (~uint64_t(0) << (data - window_));
+    if (mask != 0) {
+      return window_ + BitUtil::CountTrailingZeros(mask);
+    }
+    data = window_ + kClassifyBlockSize;
+    if (data >= end_) {
+      return end_;
+    }
+    Load(data);
+  }
+}
+
+void SpecialCharScanner::Load(const char* data) {
+  if (ARROW_PREDICT_TRUE(end_ - data >= kClassifyBlockSize)) {
+    window_ = data;
+  } else if (end_ - begin_ >= kClassifyBlockSize) {
+    window_ = end_ - kClassifyBlockSize;
+  } else {
+    // Too short for a full block
+    window_ = begin_;
+    mask_ = 0;
+    for (int64_t i = 0; i < end_ - begin_; ++i) {
+      if (IsSpecialChar(static_cast<uint8_t>(begin_[i]))) {
+        mask_ |= uint64_t(1) << i;
+      }
+    }
+    return;
+  }
+  mask_ = classify_(reinterpret_cast<const uint8_t*>(window_), special_chars_);
+}
+
+ClassifyBlockFunc GetClassifyBlockFunc() {
+  static ::arrow::internal::DynamicDispatch<ClassifyBlockDynamicFunction> dispatch;
+  return dispatch.func;
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+// The number of distinct characters that can interrupt a run of field data:
+// delimiter, quote, escape, '\r' and '\n'
+constexpr int kNumSpecialChars = 5;
+
+// The number of bytes classified at once
+constexpr int64_t kClassifyBlockSize = 64;
+
+using ClassifyBlockFunc = uint64_t (*)(const uint8_t* data, const uint8_t* special_chars);
+
+// Return a bitmask with bit i set iff data[i] is one of the special characters,
+// for a block of kClassifyBlockSize bytes.  The best implementation for the
+// running CPU is selected at runtime.
+ClassifyBlockFunc GetClassifyBlockFunc();
+
+// A helper locating the next special character in CSV data.
+//
+// The data is classified kClassifyBlockSize bytes at a time using SIMD
+// instructions, so that the CSV state machines can skip over runs of ordinary
+// characters instead of examining them one at a time.  Quoted-ness is still
+// tracked by the callers: the scanner only finds candidates, which
+// is sufficient for them to resume byte-wise processing.
+class SpecialCharScanner {
+ public:
+  explicit SpecialCharScanner(const ParseOptions& options)
+      : classify_(GetClassifyBlockFunc()) {
+    // Disabled options are mapped to a character that is special anyway
+    special_chars_[0] = static_cast<uint8_t>(options.delimiter);
+    special_chars_[1] = static_cast<uint8_t>(options.quoting ? options.quote_char : '\n');
+    special_chars_[2] =
+        static_cast<uint8_t>(options.escaping ? options.escape_char : '\n');
+    special_chars_[3] = '\r';
+    special_chars_[4] = '\n';
+  }
+
+  // Start scanning a new range of data
+  void Reset(const char* data, const char* data_end) {
+    begin_ = data;
+    end_ = data_end;
+    Load(data);
+  }
+
+  const char* end() const { return end_; }
+
+  // Return a pointer to the first special character at or after `data`,
+  // or the end of the scanned range if there is none.
+  const char* Next(const char* data) {
+    DCHECK_GE(data, begin_);
+    DCHECK_LT(data, end_);
+    const int64_t offset = data - window_;
+    if (ARROW_PREDICT_TRUE(offset >= 0 && offset < kClassifyBlockSize)) {
+      const uint64_t mask = mask_ >> offset;
+      if (ARROW_PREDICT_TRUE(mask != 0)) {
+        return data + BitUtil::CountTrailingZeros(mask);
+      }
+    }
+    return NextSlow(data);
+  }
+
+ protected:
+  // Move to the block containing the next special character, if any
+  const char* NextSlow(const char* data);
+
+  // Classify the block starting at `data`, or ending at the end of the scanned
+  // range if fewer than kClassifyBlockSize bytes remain
+  void Load(const char* data);
+
+  bool IsSpecialChar(uint8_t c) const {
+    for (int i = 0; i < kNumSpecialChars; ++i) {
+      if (c == special_chars_[i]) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ClassifyBlockFunc classify_;
+  uint8_t special_chars_[kNumSpecialChars];
+  const char* begin_ = NULLPTR;
+  const char* end_ = NULLPTR;
+  // The currently classified block and its special characters
+  const char* window_ = NULLPTR;
+  uint64_t mask_ = 0;
+};
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
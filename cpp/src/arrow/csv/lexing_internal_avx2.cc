@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/lexing_internal_avx2.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace csv {
+namespace detail {
+
+namespace {
+
+inline uint32_t ClassifyAvx2(const uint8_t* data, const __m256i* special_chars) {
+  const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  __m256i matches = _mm256_cmpeq_epi8(v, special_chars[0]);
+  for (int i = 1; i < 5; ++i) {
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(v, special_chars[i]));
+  }
+  return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+}  // namespace
+
+uint64_t ClassifyBlockAvx2(const uint8_t* data, const uint8_t* special_chars) {
+  __m256i chars[5];
+  for (int i = 0; i < 5; ++i) {
+    chars[i] = _mm256_set1_epi8(static_cast<char>(special_chars[i]));
+  }
+  const uint64_t lo = ClassifyAvx2(data, chars);
+  const uint64_t hi = ClassifyAvx2(data + 32, chars);
+  return lo | (hi << 32);
+}
+
+}  // namespace detail
+}  // namespace csv
+}  // namespace arrow
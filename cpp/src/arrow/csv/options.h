@@ -118,6 +118,9 @@ struct ARROW_EXPORT ReadOptions {
   // Reader options
 
   /// Whether to use the global CPU thread pool
+  ///
+  /// This applies to StreamingReader as well, which then parses and converts
+  /// blocks ahead of the consumer.
   bool use_threads = true;
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
@@ -19,9 +19,11 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -32,6 +34,7 @@ namespace csv {
 
 using detail::DataBatch;
 using detail::ParsedValueDesc;
+using detail::SpecialCharScanner;
 
 namespace {
 
@@ -76,6 +79,22 @@ class PresizedDataWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Append `length` bytes from `data`.  At least kMinCopyLength bytes must be
+  // readable from `data`.
+  void PushFieldChars(const char* data, int64_t length) {
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    if (length <= kMinCopyLength && parsed_capacity_ - parsed_size_ >= kMinCopyLength) {
+      // Typical short field value: a fixed-size copy is much cheaper than a
+      // variable-sized one, the excess bytes are overwritten later.
+      memcpy(parsed_ + parsed_size_, data, kMinCopyLength);
+    } else {
+      memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(length));
+    }
+    parsed_size_ += length;
+  }
+
+  static constexpr int64_t kMinCopyLength = 16;
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -174,10 +193,29 @@ class BlockParserImpl {
  public:
   BlockParserImpl(MemoryPool* pool, ParseOptions options, int32_t num_cols,
                   int32_t max_num_rows)
-      : pool_(pool), options_(options), max_num_rows_(max_num_rows), batch_(num_cols) {}
+      : pool_(pool),
+        options_(options),
+        scanner_(options_),
+        max_num_rows_(max_num_rows),
+        batch_(num_cols) {}
 
   const DataBatch& parsed_batch() const { return batch_; }
 
+  // Copy the run of non-special characters starting at `data`, return its end
+  template <typename DataWriter>
+  const char* CopyOrdinaryChars(DataWriter* parsed_writer, const char* data) {
+    const char* run_end = scanner_.Next(data);
+    if (ARROW_PREDICT_TRUE(scanner_.end() - data >= DataWriter::kMinCopyLength)) {
+      parsed_writer->PushFieldChars(data, run_end - data);
+    } else {
+      // Near the end of the data, copy bytewise
+      for (; data < run_end; ++data) {
+        parsed_writer->PushFieldChar(*data);
+      }
+    }
+    return run_end;
+  }
+
   template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
   Status ParseLine(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                    const char* data, const char* data_end, bool is_final,
@@ -186,6 +224,7 @@ class BlockParserImpl {
     char c;
 
     DCHECK_GT(data_end, data);
+    DCHECK_EQ(data_end, scanner_.end());
 
     auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
 
@@ -228,6 +267,10 @@ class BlockParserImpl {
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       goto AbortLine;
     }
+    data = CopyOrdinaryChars(parsed_writer, data);
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
     c = *data++;
     if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
       if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -260,6 +303,10 @@ class BlockParserImpl {
     if (ARROW_PREDICT_FALSE(data == data_end)) {
       goto AbortLine;
     }
+    data = CopyOrdinaryChars(parsed_writer, data);
+    if (ARROW_PREDICT_FALSE(data == data_end)) {
+      goto AbortLine;
+    }
     c = *data++;
     if (SpecializedOptions::escaping && ARROW_PREDICT_FALSE(c == options_.escape_char)) {
       if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -384,6 +431,7 @@ class BlockParserImpl {
       const char* data = view.data();
       const char* data_end = view.data() + view.length();
       bool finished_parsing = false;
+      scanner_.Reset(data, data_end);
 
       if (batch_.num_cols_ == -1) {
         // Can't presize values when the number of columns is not known, first parse
@@ -481,6 +529,7 @@ class BlockParserImpl {
  protected:
   MemoryPool* pool_;
   const ParseOptions options_;
+  SpecialCharScanner scanner_;
   // The maximum number of rows to parse from a block
   int32_t max_num_rows_;
 
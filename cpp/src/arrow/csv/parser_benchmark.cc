@@ -122,6 +122,17 @@ static void ChunkCSVNoNewlinesBlock(
   state.SetBytesProcessed(0);
 }
 
+static void ChunkCSVVehiclesExample(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(vehicles_example);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, csv, options);
+}
+
 static void BenchmarkCSVParsing(benchmark::State& state,  // NOLINT non-const reference
                                 const std::string& csv, int32_t num_rows,
                                 ParseOptions options) {
@@ -194,6 +205,7 @@ static void ParseCSVStocksExample(
 BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
+BENCHMARK(ChunkCSVVehiclesExample);
 
 BENCHMARK(ParseCSVQuotedBlock);
 BENCHMARK(ParseCSVEscapedBlock);
@@ -166,6 +166,13 @@ void AssertParsePartial(BlockParser& parser, const std::string& str,
   ASSERT_EQ(parsed_size, expected_size);
 }
 
+void AssertParsePartial(BlockParser& parser, const std::vector<util::string_view>& data,
+                        size_t expected_size) {
+  uint32_t parsed_size = static_cast<uint32_t>(-1);
+  ASSERT_OK(parser.Parse(data, &parsed_size));
+  ASSERT_EQ(parsed_size, expected_size);
+}
+
 void AssertLastRowEq(const BlockParser& parser, const std::vector<std::string> expected) {
   std::vector<std::string> values;
   GetLastRow(parser, &values);
@@ -580,6 +587,45 @@ TEST(BlockParser, Escaping) {
   }
 }
 
+TEST(BlockParser, LongValues) {
+  // Values spanning several SIMD blocks, with special characters at
+  // various offsets
+  const std::string a(100, 'a'), b(63, 'b'), c(64, 'c'), d(65, 'd');
+  {
+    auto csv =
+        MakeCSVData({a + "," + b + "\n", c + "," + d + "\r\n", "x,\"" + a + "\"\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a, c, "x"}, {b, d, a}},
+                    {{false, false, false}, {false, false, true}} /* quoted */);
+  }
+  {
+    // Quoted values with embedded delimiters, newlines and double quotes
+    auto csv = MakeCSVData(
+        {"\"" + a + "," + b + "\n" + c + "\"\"" + d + "\"," + a + "\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "," + b + "\n" + c + "\"" + d}, {a}},
+                    {{true}, {false}} /* quoted */);
+  }
+  {
+    auto options = ParseOptions::Defaults();
+    options.escaping = true;
+    auto csv = MakeCSVData({b + "\\," + c + "," + d + "\\\\\n"});
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{b + "," + c}, {d + "\\"}});
+  }
+  {
+    // Several views, with a truncated last line
+    auto csv1 = a + "," + b + "\n";
+    auto csv2 = c + "," + d + "\n" + a;
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParsePartial(parser, {csv1, csv2}, csv1.size() + c.size() + d.size() + 2);
+    AssertColumnsEq(parser, {{a, c}, {b, d}});
+  }
+}
+
 // Generate test data with the given number of columns.
 std::string MakeLotsOfCsvColumns(int32_t num_columns) {
   std::string values, header;
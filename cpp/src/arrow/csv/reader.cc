@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -40,6 +42,7 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -716,6 +719,165 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        max_readahead_(std::max(thread_pool->GetCapacity(), 1)) {}
+
+  ~ThreadedStreamingReader() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // BaseStreamingReader members
+    for (auto& block : pending_blocks_) {
+      block.parsed.Wait();
+    }
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    // The parse tasks already run max_readahead_ blocks ahead of the consumer,
+    // only read one more block from the input
+    int32_t block_queue_size = 1;
+    ARROW_ASSIGN_OR_RAISE(auto rh_it,
+                          MakeReadaheadIterator(std::move(istream_it), block_queue_size));
+    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  struct PendingBlock {
+    int64_t block_index;
+    Future<ParseResult> parsed;
+  };
+
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (block_reader_ == nullptr) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = FeedDecoders();
+    if (!st.ok()) {
+      // Chunking or parse error => bail out
+      eof_ = true;
+      return st;
+    }
+
+    auto maybe_batch = DecodeNextBatch();
+    ++num_decoded_;
+    if (schema_ == nullptr && maybe_batch.ok()) {
+      schema_ = (*maybe_batch)->schema();
+    }
+    return maybe_batch;
+  }
+
+  // Launch parse tasks for the next blocks, keeping at most max_readahead_
+  // blocks in flight between the chunker and the consumer.
+  Status SubmitBlocks() {
+    while (!source_eof_ && num_submitted_ - num_decoded_ < max_readahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      CSVBlock block = *std::move(maybe_block);
+      ARROW_ASSIGN_OR_RAISE(auto parsed, thread_pool_->Submit([this, block] {
+        return Parse(block.partial, block.completion, block.buffer, block.block_index,
+                     block.is_final);
+      }));
+      pending_blocks_.push_back({block.block_index, std::move(parsed)});
+      ++num_submitted_;
+    }
+    return Status::OK();
+  }
+
+  // Hand parsed blocks to the column decoders, in order.  Waits for the block
+  // of the next batch to be parsed; the blocks following it are only handed
+  // over if already parsed successfully, so that their conversion starts early
+  // (parse errors are reported once the consumer reaches the faulty block).
+  Status FeedDecoders() {
+    while (true) {
+      RETURN_NOT_OK(SubmitBlocks());
+      if (pending_blocks_.empty()) {
+        break;
+      }
+      const auto& parsed = pending_blocks_.front().parsed;
+      const bool next_batch_block = num_inserted_ <= num_decoded_;
+      if (!next_batch_block && !(parsed.is_finished() && parsed.status().ok())) {
+        break;
+      }
+      PendingBlock block = std::move(pending_blocks_.front());
+      pending_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto result, block.parsed.result());
+      RETURN_NOT_OK(ProcessData(result.parser, block.block_index));
+      ++num_inserted_;
+    }
+    if (source_eof_ && pending_blocks_.empty() && !decoders_eof_) {
+      for (auto& decoder : column_decoders_) {
+        decoder->SetEOF(num_inserted_);
+      }
+      decoders_eof_ = true;
+    }
+    return Status::OK();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    block_reader_ = std::make_shared<ThreadedBlockReader>(MakeChunker(parse_options_),
+                                                          std::move(buffer_iterator_),
+                                                          std::move(first_buffer));
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  // Maximum number of blocks being parsed, converted or waiting for the consumer
+  // (besides the block read ahead from the input)
+  const int max_readahead_;
+
+  bool source_eof_ = false;
+  bool decoders_eof_ = false;
+  int64_t num_submitted_ = 0;
+  int64_t num_inserted_ = 0;
+  int64_t num_decoded_ = 0;
+  std::deque<PendingBlock> pending_blocks_;
+  std::shared_ptr<ThreadedBlockReader> block_reader_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -864,8 +1026,13 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
+                                                     parse_options, convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
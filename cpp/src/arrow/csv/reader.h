@@ -56,8 +56,13 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true (the default), blocks are parsed and
+  /// converted ahead of the consumer on the global CPU thread pool, still
+  /// yielding batches in file order.  At most as many blocks as the thread
+  /// pool's capacity are parsed, converted or waiting for the consumer, and
+  /// one more block is read from the input: the reader holds up to
+  /// (capacity + 1) blocks of ReadOptions::block_size bytes.  Set use_threads
+  /// to false to parse and convert on the calling thread, one block at a time.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace csv {
+
+// Make a CSV file of `num_rows` rows, with an optional faulty line at `bad_row`
+std::string MakeCSV(int num_rows, int bad_row = -1, const std::string& bad_line = "") {
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < num_rows; ++i) {
+    if (i == bad_row) {
+      csv += bad_line;
+    }
+    csv += std::to_string(i) + "," + std::to_string(i * 0.5) + ",s" +
+           std::to_string(i % 7) + "\n";
+  }
+  return csv;
+}
+
+struct StreamingResult {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Status status;
+};
+
+StreamingResult ReadStreaming(const std::string& csv, bool use_threads) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+  // Small blocks to exercise readahead
+  read_options.block_size = 1 << 10;
+
+  StreamingResult result;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+  auto maybe_reader =
+      StreamingReader::Make(default_memory_pool(), input, read_options,
+                            ParseOptions::Defaults(), ConvertOptions::Defaults());
+  if (!maybe_reader.ok()) {
+    result.status = maybe_reader.status();
+    return result;
+  }
+  auto reader = *maybe_reader;
+  while (true) {
+    std::shared_ptr<RecordBatch> batch;
+    result.status = reader->ReadNext(&batch);
+    if (!result.status.ok() || batch == nullptr) {
+      break;
+    }
+    result.batches.push_back(std::move(batch));
+  }
+  return result;
+}
+
+TEST(StreamingReaderTest, ThreadedMatchesSerial) {
+  const auto csv = MakeCSV(20000);
+  auto serial = ReadStreaming(csv, /*use_threads=*/false);
+  auto threaded = ReadStreaming(csv, /*use_threads=*/true);
+  ASSERT_OK(serial.status);
+  ASSERT_OK(threaded.status);
+
+  ASSERT_GT(threaded.batches.size(), 1);
+  ASSERT_EQ(threaded.batches.size(), serial.batches.size());
+  for (size_t i = 0; i < serial.batches.size(); ++i) {
+    AssertBatchesEqual(*serial.batches[i], *threaded.batches[i]);
+  }
+  ASSERT_EQ(threaded.batches[0]->schema()->field(0)->type()->id(), Type::INT64);
+}
+
+TEST(StreamingReaderTest, ThreadedErrorsInOrder) {
+  // A conversion error, then a parse error, far from the start of the file:
+  // batches preceding the faulty block are still delivered
+  for (const std::string bad_line : {"xyz,1,2\n", "1,2\n"}) {
+    const auto csv = MakeCSV(20000, /*bad_row=*/15000, bad_line);
+    auto serial = ReadStreaming(csv, /*use_threads=*/false);
+    auto threaded = ReadStreaming(csv, /*use_threads=*/true);
+    ASSERT_RAISES(Invalid, serial.status);
+    ASSERT_RAISES(Invalid, threaded.status);
+    ASSERT_EQ(threaded.status.message(), serial.status.message());
+    ASSERT_EQ(threaded.batches.size(), serial.batches.size());
+  }
+}
+
+TEST(StreamingReaderTest, ThreadedEarlyRelease) {
+  // Destroying the reader while blocks are still being read ahead
+  auto read_options = ReadOptions::Defaults();
+  read_options.block_size = 1 << 10;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(MakeCSV(20000)));
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, StreamingReader::Make(default_memory_pool(), input, read_options,
+                                         ParseOptions::Defaults(),
+                                         ConvertOptions::Defaults()));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  reader.reset();
+}
+
+}  // namespace csv
+}  // namespace arrow
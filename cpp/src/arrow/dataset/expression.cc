@@ -17,9 +17,11 @@
 
 #include "arrow/dataset/expression.h"
 
+#include <limits>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/dataset/expression_internal.h"
@@ -572,59 +574,202 @@ Result<Expression> Expression::Bind(const Schema& in_schema,
 
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input,
                                       compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
+  ARROW_ASSIGN_OR_RAISE(auto evaluator, ExpressionEvaluator::Make(expr, exec_context));
+  return evaluator->Evaluate(input);
+}
+
+class ExpressionEvaluator::Impl {
+ public:
+  explicit Impl(Expression expr, const compute::ExecContext& exec_context)
+      : expr_(std::move(expr)), exec_context_(exec_context) {
+    chunksize_ = exec_context_.exec_chunksize();
+    if (chunksize_ == std::numeric_limits<int64_t>::max()) {
+      chunksize_ = kDefaultChunksize;
+    }
   }
 
-  if (!expr.IsBound()) {
-    return Status::Invalid("Cannot Execute unbound expression.");
+  Status Compile() {
+    std::unordered_map<Expression, int, Expression::Hash> step_indices;
+    AddStep(expr_, &step_indices);
+
+    // The result is never released
+    steps_.back().last_use = static_cast<int>(steps_.size());
+    for (int i = 0; i < static_cast<int>(steps_.size()); ++i) {
+      for (int argument : steps_[i].arguments) {
+        steps_[argument].last_use = i;
+      }
+      if (steps_[i].expr.call()) ++num_calls_;
+    }
+    return Status::OK();
   }
 
-  if (!expr.IsScalarExpression()) {
-    return Status::Invalid(
-        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+  Result<Datum> Evaluate(const Datum& input) {
+    int64_t length = 0;
+    if (input.kind() == Datum::ARRAY) {
+      length = input.length();
+    } else if (input.kind() == Datum::RECORD_BATCH) {
+      length = input.record_batch()->num_rows();
+    }
+    if (num_calls_ == 0 || length <= chunksize_) {
+      return EvaluateChunk(input);
+    }
+
+    std::vector<std::shared_ptr<Array>> chunks;
+    for (int64_t offset = 0; offset < length; offset += chunksize_) {
+      Datum slice;
+      if (input.kind() == Datum::ARRAY) {
+        slice = input.array()->Slice(offset, chunksize_);
+      } else {
+        slice = input.record_batch()->Slice(offset, chunksize_);
+      }
+      ARROW_ASSIGN_OR_RAISE(Datum out, EvaluateChunk(slice));
+      if (out.is_scalar()) {
+        // The shape of the result does not depend on the rows
+        return out;
+      }
+      if (out.kind() == Datum::CHUNKED_ARRAY) {
+        for (const auto& chunk : out.chunked_array()->chunks()) {
+          chunks.push_back(chunk);
+        }
+      } else {
+        chunks.push_back(out.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto out, Concatenate(chunks, exec_context_.memory_pool()));
+    return Datum(std::move(out));
   }
 
-  if (auto lit = expr.literal()) return *lit;
+  const Expression& expr() const { return expr_; }
 
-  if (auto ref = expr.field_ref()) {
-    ARROW_ASSIGN_OR_RAISE(Datum field, GetDatumField(*ref, input));
+  int num_steps() const { return static_cast<int>(steps_.size()); }
 
-    if (field.descr() != expr.descr()) {
-      // Refernced field was present but didn't have the expected type.
-      // Should we just error here? For now, pay dispatch cost and just cast.
-      ARROW_ASSIGN_OR_RAISE(
-          field, compute::Cast(field, expr.descr().type, compute::CastOptions::Safe(),
-                               exec_context));
-    }
+ private:
+  struct Step {
+    Expression expr;
+    // The indices of the steps computing the arguments of a call
+    std::vector<int> arguments;
+    // The index of the last step reading this step's output
+    int last_use = -1;
+
+    std::unique_ptr<compute::KernelContext> kernel_context;
+    std::unique_ptr<compute::detail::KernelExecutor> executor;
+    // The argument descriptors the executor was initialized with
+    std::vector<ValueDescr> descrs;
+  };
 
-    return field;
+  int AddStep(const Expression& expr,
+              std::unordered_map<Expression, int, Expression::Hash>* step_indices) {
+    auto it = step_indices->find(expr);
+    if (it != step_indices->end()) return it->second;
+
+    Step step;
+    step.expr = expr;
+    if (auto call = expr.call()) {
+      for (const Expression& argument : call->arguments) {
+        step.arguments.push_back(AddStep(argument, step_indices));
+      }
+      step.kernel_context.reset(new compute::KernelContext(&exec_context_));
+      step.kernel_context->SetState(call->kernel_state.get());
+    }
+    int index = static_cast<int>(steps_.size());
+    steps_.push_back(std::move(step));
+    step_indices->emplace(expr, index);
+    return index;
+  }
+
+  Result<Datum> EvaluateChunk(const Datum& input) {
+    std::vector<Datum> values(steps_.size());
+    for (int i = 0; i < static_cast<int>(steps_.size()); ++i) {
+      ARROW_ASSIGN_OR_RAISE(values[i], EvaluateStep(&steps_[i], input, &values));
+      for (int argument : steps_[i].arguments) {
+        if (steps_[argument].last_use == i) {
+          values[argument] = Datum();
+        }
+      }
+    }
+    return std::move(values.back());
   }
 
-  auto call = CallNotNull(expr);
+  Result<Datum> EvaluateStep(Step* step, const Datum& input,
+                             std::vector<Datum>* values) {
+    const Expression& expr = step->expr;
+    if (auto lit = expr.literal()) return *lit;
+
+    if (auto ref = expr.field_ref()) {
+      ARROW_ASSIGN_OR_RAISE(Datum field, GetDatumField(*ref, input));
+
+      if (field.descr() != expr.descr()) {
+        // Refernced field was present but didn't have the expected type.
+        // Should we just error here? For now, pay dispatch cost and just cast.
+        ARROW_ASSIGN_OR_RAISE(
+            field, compute::Cast(field, expr.descr().type, compute::CastOptions::Safe(),
+                                 &exec_context_));
+      }
+
+      return field;
+    }
 
-  std::vector<Datum> arguments(call->arguments.size());
-  for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    auto call = CallNotNull(expr);
+
+    std::vector<Datum> arguments(step->arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      arguments[i] = (*values)[step->arguments[i]];
+    }
+
+    // The executor only needs to be set up again if the argument shapes change
+    auto descrs = GetDescriptors(arguments);
+    if (step->executor == nullptr || descrs != step->descrs) {
+      step->executor = compute::detail::KernelExecutor::MakeScalar();
+      RETURN_NOT_OK(step->executor->Init(step->kernel_context.get(),
+                                         {call->kernel, descrs, call->options.get()}));
+      step->descrs = std::move(descrs);
+    }
+
+    compute::detail::DatumAccumulator listener;
+    RETURN_NOT_OK(step->executor->Execute(arguments, &listener));
+    return step->executor->WrapResults(arguments, listener.values());
   }
 
-  auto executor = compute::detail::KernelExecutor::MakeScalar();
+  Expression expr_;
+  compute::ExecContext exec_context_;
+  int64_t chunksize_;
+  std::vector<Step> steps_;
+  int num_calls_ = 0;
+};
 
-  compute::KernelContext kernel_context(exec_context);
-  kernel_context.SetState(call->kernel_state.get());
+ExpressionEvaluator::ExpressionEvaluator(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
 
-  auto kernel = call->kernel;
-  auto descrs = GetDescriptors(arguments);
-  auto options = call->options.get();
-  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, descrs, options}));
+ExpressionEvaluator::~ExpressionEvaluator() = default;
 
-  auto listener = std::make_shared<compute::detail::DatumAccumulator>();
-  RETURN_NOT_OK(executor->Execute(arguments, listener.get()));
-  return executor->WrapResults(arguments, listener->values());
+constexpr int64_t ExpressionEvaluator::kDefaultChunksize;
+
+Result<std::unique_ptr<ExpressionEvaluator>> ExpressionEvaluator::Make(
+    Expression expr, compute::ExecContext* exec_context) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot Execute unbound expression.");
+  }
+
+  if (!expr.IsScalarExpression()) {
+    return Status::Invalid(
+        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+  }
+
+  compute::ExecContext default_exec_context;
+  std::unique_ptr<Impl> impl(new Impl(
+      std::move(expr), exec_context != nullptr ? *exec_context : default_exec_context));
+  RETURN_NOT_OK(impl->Compile());
+  return std::unique_ptr<ExpressionEvaluator>(new ExpressionEvaluator(std::move(impl)));
 }
 
+Result<Datum> ExpressionEvaluator::Evaluate(const Datum& input) {
+  return impl_->Evaluate(input);
+}
+
+const Expression& ExpressionEvaluator::expression() const { return impl_->expr(); }
+
+int ExpressionEvaluator::num_steps() const { return impl_->num_steps(); }
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -210,6 +211,44 @@ ARROW_DS_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Datum& input,
                                       compute::ExecContext* = NULLPTR);
 
+/// \brief A bound scalar expression compiled for repeated evaluation
+///
+/// The expression is flattened into a sequence of steps in which common
+/// subexpressions appear once, and the executor of each call is set up once.
+/// Each intermediate result is released as soon as its last consumer has run,
+/// so that its memory can be reused by the following steps.
+///
+/// Array and RecordBatch inputs are evaluated in slices of exec_chunksize rows
+/// (kDefaultChunksize rows if the ExecContext keeps its unbounded default),
+/// which keeps the intermediates of a complex expression in the CPU caches.
+/// Only the result is assembled at full length.
+///
+/// An ExpressionEvaluator must not be used from several threads at once.
+class ARROW_DS_EXPORT ExpressionEvaluator {
+ public:
+  static constexpr int64_t kDefaultChunksize = 1 << 14;
+
+  /// Compile a bound scalar expression. The ExecContext is copied.
+  static Result<std::unique_ptr<ExpressionEvaluator>> Make(
+      Expression expr, compute::ExecContext* = NULLPTR);
+
+  ~ExpressionEvaluator();
+
+  /// Evaluate the expression against an input Datum
+  Result<Datum> Evaluate(const Datum& input);
+
+  const Expression& expression() const;
+
+  /// The number of distinct literals, field references and calls evaluated
+  int num_steps() const;
+
+ private:
+  class Impl;
+  explicit ExpressionEvaluator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 // Serialization
 
 ARROW_DS_EXPORT
@@ -30,6 +30,7 @@
 #include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 using testing::HasSubstr;
 using testing::UnorderedElementsAreArray;
@@ -531,6 +532,68 @@ TEST(Expression, ExecuteDictionaryTransparent) {
   ])"));
 }
 
+TEST(ExpressionEvaluator, CommonSubexpressions) {
+  auto sum = call("add", {field_ref("a"), field_ref("b")});
+  auto expr = and_(greater(sum, literal(0.0)), less(sum, literal(10.0)));
+  auto in_schema = schema({field("a", float64()), field("b", float64())});
+  ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*in_schema));
+
+  // a, b, add, 0.0, greater, 10.0, less, and_kleene
+  ASSERT_OK_AND_ASSIGN(auto evaluator, ExpressionEvaluator::Make(expr));
+  ASSERT_EQ(evaluator->num_steps(), 8);
+
+  auto batch = RecordBatchFromJSON(in_schema, R"([
+    {"a": 6.125, "b": 3.375},
+    {"a": 0.0,   "b": null},
+    {"a": -1,    "b": 4.75},
+    {"a": 7,     "b": 4}
+  ])");
+  ASSERT_OK_AND_ASSIGN(Datum actual, evaluator->Evaluate(batch));
+  ASSERT_OK_AND_ASSIGN(Datum expected, NaiveExecuteScalarExpression(expr, batch));
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+}
+
+TEST(ExpressionEvaluator, Chunked) {
+  auto in_schema =
+      schema({field("a", float64()), field("b", float64()), field("s", utf8())});
+  random::RandomArrayGenerator rand(/*seed=*/0x5EED);
+  auto make_batch = [&](int64_t length) {
+    return RecordBatch::Make(in_schema, length,
+                             {rand.Float64(length, -10, 10, /*null_probability=*/0.1),
+                              rand.Float64(length, -10, 10, /*null_probability=*/0.1),
+                              rand.String(length, 0, 5, /*null_probability=*/0.1)});
+  };
+
+  auto sum = call("add", {field_ref("a"), field_ref("b")});
+  for (Expression expr : {
+           and_(greater(sum, literal(0.0)), less(sum, field_ref("a"))),
+           call("multiply", {sum, sum}),
+           call("ascii_upper", {field_ref("s")}),
+           field_ref("b"),
+       }) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*in_schema));
+    for (int64_t chunksize : {int64_t(1000), int64_t(333), int64_t(100000)}) {
+      compute::ExecContext exec_context;
+      exec_context.set_exec_chunksize(chunksize);
+      ASSERT_OK_AND_ASSIGN(auto evaluator,
+                           ExpressionEvaluator::Make(expr, &exec_context));
+
+      // An evaluator can be reused with several inputs
+      for (int64_t length : {int64_t(0), int64_t(10), int64_t(5000)}) {
+        auto batch = make_batch(length);
+        ASSERT_OK_AND_ASSIGN(Datum actual, evaluator->Evaluate(batch));
+        ASSERT_OK_AND_ASSIGN(Datum expected, NaiveExecuteScalarExpression(expr, batch));
+        ASSERT_OK(actual.make_array()->ValidateFull());
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+}
+
+TEST(ExpressionEvaluator, Invalid) {
+  ASSERT_RAISES(Invalid, ExpressionEvaluator::Make(field_ref("a")));
+}
+
 void ExpectIdenticalIfUnchanged(Expression modified, Expression original) {
   if (modified == original) {
     // no change -> must be identical
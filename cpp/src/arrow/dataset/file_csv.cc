@@ -28,10 +28,12 @@
 #include "arrow/csv/reader.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/result.h"
 #include "arrow/type.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 
@@ -157,6 +159,30 @@ class CsvScanTask : public ScanTask {
     return IteratorFromReader(std::move(reader));
   }
 
+  Result<RecordBatchGenerator> ExecuteAsync() override {
+    // The CSV reader has no asynchronous API. Opening it reads and converts the
+    // first block, so it is deferred to the first batch read in the background
+    // rather than done by the caller.
+    struct Impl {
+      Result<std::shared_ptr<RecordBatch>> Next() {
+        if (reader_ == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(reader_, OpenReader(source_, *format_, options_, pool_));
+        }
+        return reader_->Next();
+      }
+
+      std::shared_ptr<const CsvFileFormat> format_;
+      FileSource source_;
+      std::shared_ptr<ScanOptions> options_;
+      MemoryPool* pool_;
+      std::shared_ptr<csv::StreamingReader> reader_;
+    };
+
+    return MakeBackgroundGenerator(
+        RecordBatchIterator(Impl{format_, source_, options(), context()->pool, nullptr}),
+        context()->async_context.executor);
+  }
+
  private:
   std::shared_ptr<const CsvFileFormat> format_;
   FileSource source_;
@@ -30,6 +30,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 
 namespace arrow {
 namespace dataset {
@@ -59,6 +60,19 @@ N/A
     return Batches(std::move(scan_task_it));
   }
 
+  RecordBatchVector BatchesAsync(Fragment* fragment) {
+    RecordBatchVector batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    for (auto maybe_scan_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto scan_task, maybe_scan_task);
+      EXPECT_OK_AND_ASSIGN(auto batch_gen, scan_task->ExecuteAsync());
+      auto collected = CollectAsyncGenerator(batch_gen);
+      EXPECT_OK_AND_ASSIGN(auto task_batches, collected.result());
+      batches.insert(batches.end(), task_batches.begin(), task_batches.end());
+    }
+    return batches;
+  }
+
  protected:
   std::shared_ptr<CsvFileFormat> format_ = std::make_shared<CsvFileFormat>();
   std::shared_ptr<ScanOptions> opts_;
@@ -99,6 +113,30 @@ TEST_F(TestCsvFileFormat, ScanRecordBatchReaderWithVirtualColumn) {
   ASSERT_EQ(row_count, 3);
 }
 
+TEST_F(TestCsvFileFormat, ScanRecordBatchReaderAsync) {
+  auto source = GetFileSource();
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  int64_t row_count = 0;
+
+  for (const auto& batch : BatchesAsync(fragment.get())) {
+    AssertSchemaEqual(*batch->schema(), *schema_);
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, 3);
+
+  // Errors opening the file are reported by the generator
+  source = GetFileSource("");
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(*source));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task, scan_task_it.Next());
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, scan_task->ExecuteAsync());
+  ASSERT_RAISES(Invalid, batch_gen().result());
+}
+
 TEST_F(TestCsvFileFormat, OpenFailureWithRelevantError) {
   auto source = GetFileSource("");
   EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr("<Buffer>"),
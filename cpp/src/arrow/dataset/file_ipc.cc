@@ -27,6 +27,7 @@
 #include "arrow/dataset/scanner.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 
@@ -72,6 +73,20 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+/// \brief Open a reader of the fields materialized by a scan
+static inline Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenScanReader(
+    const FileSource& source, const std::vector<std::string>& materialized_fields,
+    MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+
+  auto options = default_read_options();
+  options.memory_pool = pool;
+  ARROW_ASSIGN_OR_RAISE(options.included_fields,
+                        GetIncludedFields(*reader->schema(), materialized_fields));
+
+  return OpenReader(source, options);
+}
+
 /// \brief A ScanTask backed by an Ipc file.
 class IpcScanTask : public ScanTask {
  public:
@@ -81,20 +96,6 @@ class IpcScanTask : public ScanTask {
 
   Result<RecordBatchIterator> Execute() override {
     struct Impl {
-      static Result<RecordBatchIterator> Make(
-          const FileSource& source, std::vector<std::string> materialized_fields,
-          MemoryPool* pool) {
-        ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
-
-        auto options = default_read_options();
-        options.memory_pool = pool;
-        ARROW_ASSIGN_OR_RAISE(options.included_fields,
-                              GetIncludedFields(*reader->schema(), materialized_fields));
-
-        ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, options));
-        return RecordBatchIterator(Impl{std::move(reader), 0});
-      }
-
       Result<std::shared_ptr<RecordBatch>> Next() {
         if (i_ == reader_->num_record_batches()) {
           return nullptr;
@@ -107,7 +108,19 @@ class IpcScanTask : public ScanTask {
       int i_;
     };
 
-    return Impl::Make(source_, options_->MaterializedFields(), context_->pool);
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader,
+        OpenScanReader(source_, options_->MaterializedFields(), context_->pool));
+    return RecordBatchIterator(Impl{std::move(reader), 0});
+  }
+
+  Result<RecordBatchGenerator> ExecuteAsync() override {
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader,
+        OpenScanReader(source_, options_->MaterializedFields(), context_->pool));
+    // The buffers of up to batch_readahead batches are read concurrently
+    return reader->GetRecordBatchGenerator(options_->batch_readahead,
+                                           context_->async_context);
   }
 
  private:
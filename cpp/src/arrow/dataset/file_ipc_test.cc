@@ -33,6 +33,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -106,6 +107,19 @@ class TestIpcFileFormat : public ArrowIpcWriterMixin {
     return Batches(std::move(scan_task_it));
   }
 
+  RecordBatchVector BatchesAsync(Fragment* fragment) {
+    RecordBatchVector batches;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    for (auto maybe_scan_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto scan_task, maybe_scan_task);
+      EXPECT_OK_AND_ASSIGN(auto batch_gen, scan_task->ExecuteAsync());
+      auto collected = CollectAsyncGenerator(batch_gen);
+      EXPECT_OK_AND_ASSIGN(auto task_batches, collected.result());
+      batches.insert(batches.end(), task_batches.begin(), task_batches.end());
+    }
+    return batches;
+  }
+
  protected:
   std::shared_ptr<IpcFileFormat> format_ = std::make_shared<IpcFileFormat>();
   std::shared_ptr<ScanOptions> opts_;
@@ -148,6 +162,33 @@ TEST_F(TestIpcFileFormat, ScanRecordBatchReaderWithVirtualColumn) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestIpcFileFormat, ScanRecordBatchReaderAsync) {
+  auto reader =
+      GetRecordBatchReader(schema({field("f64", float64()), field("i32", int32())}));
+  auto source = GetFileSource(reader.get());
+
+  // Only the projected field is read
+  opts_ = ScanOptions::Make(schema_);
+  opts_->batch_readahead = 2;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  RecordBatchVector expected;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    expected.push_back(std::move(batch));
+  }
+  auto actual = BatchesAsync(fragment.get());
+
+  ASSERT_EQ(actual.size(), expected.size());
+  int64_t row_count = 0;
+  for (size_t i = 0; i < actual.size(); ++i) {
+    AssertSchemaEqual(*actual[i]->schema(), *schema_, /*check_metadata=*/false);
+    AssertBatchesEqual(*expected[i], *actual[i]);
+    row_count += actual[i]->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
 TEST_F(TestIpcFileFormat, WriteRecordBatchReader) {
   std::shared_ptr<RecordBatchReader> reader = GetRecordBatchReader();
   auto source = GetFileSource(reader.get());
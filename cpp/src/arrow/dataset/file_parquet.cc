@@ -17,13 +17,16 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_base.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
@@ -34,7 +37,10 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -49,48 +55,6 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
-/// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
-class ParquetScanTask : public ScanTask {
- public:
-  ParquetScanTask(int row_group, std::vector<int> column_projection,
-                  std::shared_ptr<parquet::arrow::FileReader> reader,
-                  std::shared_ptr<ScanOptions> options,
-                  std::shared_ptr<ScanContext> context)
-      : ScanTask(std::move(options), std::move(context)),
-        row_group_(row_group),
-        column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
-
-  Result<RecordBatchIterator> Execute() override {
-    // The construction of parquet's RecordBatchReader is deferred here to
-    // control the memory usage of consumers who materialize all ScanTasks
-    // before dispatching them, e.g. for scheduling purposes.
-    //
-    // The memory and IO incurred by the RecordBatchReader is allocated only
-    // when Execute is called.
-    struct {
-      Result<std::shared_ptr<RecordBatch>> operator()() const {
-        return record_batch_reader->Next();
-      }
-
-      // The RecordBatchIterator must hold a reference to the FileReader;
-      // since it must outlive the wrapped RecordBatchReader
-      std::shared_ptr<parquet::arrow::FileReader> file_reader;
-      std::unique_ptr<RecordBatchReader> record_batch_reader;
-    } NextBatch;
-
-    NextBatch.file_reader = reader_;
-    RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
-                                                &NextBatch.record_batch_reader));
-    return MakeFunctionIterator(std::move(NextBatch));
-  }
-
- private:
-  int row_group_;
-  std::vector<int> column_projection_;
-  std::shared_ptr<parquet::arrow::FileReader> reader_;
-};
-
 static parquet::ReaderProperties MakeReaderProperties(
     const ParquetFileFormat& format, MemoryPool* pool = default_memory_pool()) {
   parquet::ReaderProperties properties(pool);
@@ -124,6 +88,32 @@ static Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
+static util::optional<Expression> StatisticsAsExpression(
+    const Field& field, const parquet::Statistics& statistics) {
+  auto field_expr = field_ref(field.name());
+
+  // Optimize for corner case where all values are nulls
+  if (statistics.num_values() == statistics.null_count()) {
+    return equal(std::move(field_expr), literal(MakeNullScalar(field.type())));
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
+    return util::nullopt;
+  }
+
+  auto maybe_min = min->CastTo(field.type());
+  auto maybe_max = max->CastTo(field.type());
+  if (maybe_min.ok() && maybe_max.ok()) {
+    min = maybe_min.MoveValueUnsafe();
+    max = maybe_max.MoveValueUnsafe();
+    return and_(greater_equal(field_expr, literal(min)),
+                less_equal(field_expr, literal(max)));
+  }
+
+  return util::nullopt;
+}
+
 static util::optional<Expression> ColumnChunkStatisticsAsExpression(
     const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
   // For the remaining of this function, failure to extract/parse statistics
@@ -142,29 +132,7 @@ static util::optional<Expression> ColumnChunkStatisticsAsExpression(
     return util::nullopt;
   }
 
-  const auto& field = schema_field.field;
-  auto field_expr = field_ref(field->name());
-
-  // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == statistics->null_count()) {
-    return equal(std::move(field_expr), literal(MakeNullScalar(field->type())));
-  }
-
-  std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
-    return util::nullopt;
-  }
-
-  auto maybe_min = min->CastTo(field->type());
-  auto maybe_max = max->CastTo(field->type());
-  if (maybe_min.ok() && maybe_max.ok()) {
-    min = maybe_min.MoveValueUnsafe();
-    max = maybe_max.MoveValueUnsafe();
-    return and_(greater_equal(field_expr, literal(min)),
-                less_equal(field_expr, literal(max)));
-  }
-
-  return util::nullopt;
+  return StatisticsAsExpression(*schema_field.field, *statistics);
 }
 
 static void AddColumnIndices(const SchemaField& schema_field,
@@ -206,6 +174,310 @@ static std::vector<int> InferColumnProjection(const parquet::arrow::FileReader&
   return columns_selection;
 }
 
+// Intersect two sets of row ranges
+static parquet::RowRanges IntersectRowRanges(const parquet::RowRanges& left,
+                                             const parquet::RowRanges& right) {
+  parquet::RowRanges intersection;
+  size_t l = 0, r = 0;
+  while (l < left.size() && r < right.size()) {
+    const int64_t start = std::max(left[l].start, right[r].start);
+    const int64_t end = std::min(left[l].end, right[r].end);
+    if (start < end) {
+      intersection.push_back({start, end});
+    }
+    if (left[l].end < right[r].end) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return intersection;
+}
+
+// Select the rows of a row group which may satisfy `filter`, using the page
+// statistics recorded in the ColumnIndex of the filtered columns. Returns
+// util::nullopt if no page index could be used.
+static Result<util::optional<parquet::RowRanges>> FilterPages(
+    const Expression& filter, parquet::arrow::FileReader* reader, int row_group,
+    MemoryPool* pool) {
+  if (filter == literal(true)) {
+    return util::nullopt;
+  }
+
+  std::shared_ptr<Schema> physical_schema;
+  RETURN_NOT_OK(reader->GetSchema(&physical_schema));
+  const auto& manifest = reader->manifest();
+  auto row_group_reader = reader->parquet_reader()->RowGroup(row_group);
+  const int64_t num_rows = row_group_reader->metadata()->num_rows();
+
+  util::optional<parquet::RowRanges> selected;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (const FieldRef& ref : FieldsInExpression(filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema));
+    if (match.empty()) continue;
+
+    const SchemaField& schema_field = manifest.schema_fields[match[0]];
+    // Pages of repeated columns don't start at record boundaries
+    if (!schema_field.is_leaf() ||
+        manifest.descr->Column(schema_field.column_index)->max_repetition_level() > 0) {
+      continue;
+    }
+
+    auto column_index = row_group_reader->GetColumnIndex(schema_field.column_index);
+    auto offset_index = row_group_reader->GetOffsetIndex(schema_field.column_index);
+    if (column_index == nullptr || offset_index == nullptr) continue;
+
+    const auto& pages = offset_index->page_locations();
+    if (static_cast<size_t>(column_index->num_pages()) != pages.size()) continue;
+
+    parquet::RowRanges column_selected;
+    for (size_t i = 0; i < pages.size(); ++i) {
+      const int64_t start = pages[i].first_row_index;
+      const int64_t end = i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows;
+
+      util::optional<Expression> page_expr;
+      if (column_index->null_pages()[i]) {
+        page_expr = equal(field_ref(schema_field.field->name()),
+                          literal(MakeNullScalar(schema_field.field->type())));
+      } else if (auto statistics = column_index->page_statistics(
+                     static_cast<int>(i), end - start, pool)) {
+        page_expr = StatisticsAsExpression(*schema_field.field, *statistics);
+      }
+
+      if (page_expr.has_value()) {
+        ARROW_ASSIGN_OR_RAISE(auto bound, page_expr->Bind(*physical_schema));
+        ARROW_ASSIGN_OR_RAISE(auto page_filter,
+                              SimplifyWithGuarantee(filter, std::move(bound)));
+        if (!page_filter.IsSatisfiable()) continue;
+      }
+
+      if (!column_selected.empty() && column_selected.back().end == start) {
+        column_selected.back().end = end;
+      } else if (start < end) {
+        column_selected.push_back({start, end});
+      }
+    }
+
+    if (selected.has_value()) {
+      selected = IntersectRowRanges(*selected, column_selected);
+    } else {
+      selected = std::move(column_selected);
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected;
+}
+
+template <typename ScalarType>
+static uint64_t HashAsInt32(const parquet::BloomFilter& bloom_filter,
+                            const Scalar& value) {
+  return bloom_filter.Hash(
+      static_cast<int32_t>(checked_cast<const ScalarType&>(value).value));
+}
+
+template <typename ScalarType>
+static uint64_t HashAsInt64(const parquet::BloomFilter& bloom_filter,
+                            const Scalar& value) {
+  return bloom_filter.Hash(
+      static_cast<int64_t>(checked_cast<const ScalarType&>(value).value));
+}
+
+// Hash a value of a column as the writer of its Bloom filter did, i.e. over
+// the plain encoding of the value once converted to the column's physical type.
+// Returns util::nullopt if that conversion isn't known to be exact. In
+// particular, floating point values are not handled since equal values (0.0
+// and -0.0) may have different encodings.
+static util::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                                const parquet::ColumnDescriptor& descr,
+                                                const Scalar& value) {
+  if (!value.is_valid) {
+    return util::nullopt;
+  }
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32:
+      switch (value.type->id()) {
+        case Type::INT8:
+          return HashAsInt32<Int8Scalar>(bloom_filter, value);
+        case Type::INT16:
+          return HashAsInt32<Int16Scalar>(bloom_filter, value);
+        case Type::INT32:
+          return HashAsInt32<Int32Scalar>(bloom_filter, value);
+        case Type::UINT8:
+          return HashAsInt32<UInt8Scalar>(bloom_filter, value);
+        case Type::UINT16:
+          return HashAsInt32<UInt16Scalar>(bloom_filter, value);
+        case Type::UINT32:
+          return HashAsInt32<UInt32Scalar>(bloom_filter, value);
+        case Type::DATE32:
+          return HashAsInt32<Date32Scalar>(bloom_filter, value);
+        default:
+          return util::nullopt;
+      }
+    case parquet::Type::INT64:
+      switch (value.type->id()) {
+        case Type::INT64:
+          return HashAsInt64<Int64Scalar>(bloom_filter, value);
+        case Type::UINT64:
+          return HashAsInt64<UInt64Scalar>(bloom_filter, value);
+        default:
+          return util::nullopt;
+      }
+    case parquet::Type::BYTE_ARRAY:
+      if (is_base_binary_like(value.type->id())) {
+        const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+        const parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()),
+                                            buffer.data());
+        return bloom_filter.Hash(&byte_array);
+      }
+      return util::nullopt;
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY:
+      if (value.type->id() == Type::FIXED_SIZE_BINARY) {
+        const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+        const parquet::FLBA flba(buffer.data());
+        return bloom_filter.Hash(&flba, static_cast<uint32_t>(buffer.size()));
+      }
+      return util::nullopt;
+    default:
+      return util::nullopt;
+  }
+}
+
+// Whether the Bloom filters of a row group prove that no row satisfies `filter`.
+// Only the equality and is_in predicates between a column and literal values
+// which are members of the conjunction `filter` are considered: the row group
+// is excluded if the Bloom filter of the column holds none of the values.
+static Result<bool> BloomFiltersExcludeRowGroup(const Expression& filter,
+                                                parquet::arrow::FileReader* reader,
+                                                int row_group) {
+  auto call = filter.call();
+  if (call == nullptr) {
+    return false;
+  }
+  std::vector<Expression> members{filter};
+  if (call->function_name == "and_kleene") {
+    members = FlattenedAssociativeChain(filter).fringe;
+  }
+
+  std::shared_ptr<Schema> physical_schema;
+  RETURN_NOT_OK(reader->GetSchema(&physical_schema));
+  const auto& manifest = reader->manifest();
+  auto row_group_reader = reader->parquet_reader()->RowGroup(row_group);
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (const Expression& member : members) {
+    auto member_call = member.call();
+    if (member_call == nullptr || member_call->arguments.empty()) continue;
+    const FieldRef* ref = member_call->arguments[0].field_ref();
+    if (ref == nullptr) continue;
+
+    // The values one of which the column must hold to satisfy the predicate
+    std::vector<std::shared_ptr<Scalar>> values;
+    if (member_call->function_name == "equal") {
+      const Datum* lit = member_call->arguments[1].literal();
+      if (lit == nullptr || !lit->is_scalar()) continue;
+      values.push_back(lit->scalar());
+    } else if (member_call->function_name == "is_in") {
+      const auto* set_lookup_options = GetSetLookupOptions(*member_call);
+      if (!set_lookup_options->value_set.is_array()) continue;
+      auto value_array = set_lookup_options->value_set.make_array();
+      // Nulls in the value set match nulls, which Bloom filters don't record
+      if (value_array->null_count() > 0 && !set_lookup_options->skip_nulls) continue;
+      for (int64_t i = 0; i < value_array->length(); ++i) {
+        if (value_array->IsNull(i)) continue;
+        ARROW_ASSIGN_OR_RAISE(auto value, value_array->GetScalar(i));
+        values.push_back(std::move(value));
+      }
+    } else {
+      continue;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto match, ref->FindOneOrNone(*physical_schema));
+    if (match.empty()) continue;
+    const SchemaField& schema_field = manifest.schema_fields[match[0]];
+    if (!schema_field.is_leaf()) continue;
+
+    auto bloom_filter = row_group_reader->GetBloomFilter(schema_field.column_index);
+    if (bloom_filter == nullptr) continue;
+
+    const auto& descr = *manifest.descr->Column(schema_field.column_index);
+    bool may_contain = false;
+    for (const auto& value : values) {
+      if (!value->type->Equals(*schema_field.field->type())) {
+        may_contain = true;
+        break;
+      }
+      auto hash = BloomFilterHash(*bloom_filter, descr, *value);
+      if (!hash.has_value() || bloom_filter->FindHash(*hash)) {
+        may_contain = true;
+        break;
+      }
+    }
+    if (!may_contain) {
+      return true;
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return false;
+}
+
+/// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
+class ParquetScanTask : public ScanTask {
+ public:
+  ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  std::shared_ptr<parquet::arrow::FileReader> reader, bool use_page_index,
+                  std::shared_ptr<ScanOptions> options,
+                  std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        row_group_(row_group),
+        column_projection_(std::move(column_projection)),
+        reader_(std::move(reader)),
+        use_page_index_(use_page_index) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // The construction of parquet's RecordBatchReader is deferred here to
+    // control the memory usage of consumers who materialize all ScanTasks
+    // before dispatching them, e.g. for scheduling purposes.
+    //
+    // The memory and IO incurred by the RecordBatchReader is allocated only
+    // when Execute is called.
+    struct {
+      Result<std::shared_ptr<RecordBatch>> operator()() const {
+        return record_batch_reader->Next();
+      }
+
+      // The RecordBatchIterator must hold a reference to the FileReader;
+      // since it must outlive the wrapped RecordBatchReader
+      std::shared_ptr<parquet::arrow::FileReader> file_reader;
+      std::unique_ptr<RecordBatchReader> record_batch_reader;
+    } NextBatch;
+
+    NextBatch.file_reader = reader_;
+    util::optional<parquet::RowRanges> row_ranges;
+    if (use_page_index_) {
+      ARROW_ASSIGN_OR_RAISE(row_ranges,
+                            FilterPages(options_->filter, reader_.get(), row_group_,
+                                        context_->pool));
+    }
+    if (!row_ranges.has_value()) {
+      RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
+                                                  &NextBatch.record_batch_reader));
+    } else if (row_ranges->empty()) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    } else {
+      RETURN_NOT_OK(reader_->GetRecordBatchReader(row_group_, column_projection_,
+                                                  *row_ranges,
+                                                  &NextBatch.record_batch_reader));
+    }
+    return MakeFunctionIterator(std::move(NextBatch));
+  }
+
+ private:
+  int row_group_;
+  std::vector<int> column_projection_;
+  std::shared_ptr<parquet::arrow::FileReader> reader_;
+  bool use_page_index_;
+};
+
 bool ParquetFileFormat::Equals(const FileFormat& other) const {
   if (other.type_name() != type_name()) return false;
 
@@ -216,7 +488,9 @@ bool ParquetFileFormat::Equals(const FileFormat& other) const {
   // FIXME extract these to scan time options so comparison is unnecessary
   return reader_options.use_buffered_stream == other_reader_options.use_buffered_stream &&
          reader_options.buffer_size == other_reader_options.buffer_size &&
-         reader_options.dict_columns == other_reader_options.dict_columns;
+         reader_options.dict_columns == other_reader_options.dict_columns &&
+         reader_options.use_page_index == other_reader_options.use_page_index &&
+         reader_options.use_bloom_filter == other_reader_options.use_bloom_filter;
 }
 
 ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_properties) {
@@ -317,12 +591,25 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     if (row_groups.empty()) MakeEmpty();
   }
 
+  if (reader_options.use_bloom_filter) {
+    // Unlike statistics, Bloom filters aren't part of the metadata and must be
+    // read from the file, so they are only used once it is open
+    std::vector<int> selected;
+    for (int row_group : row_groups) {
+      ARROW_ASSIGN_OR_RAISE(bool excluded, BloomFiltersExcludeRowGroup(
+                                               options->filter, reader.get(), row_group));
+      if (!excluded) selected.push_back(row_group);
+    }
+    row_groups = std::move(selected);
+  }
+
   auto column_projection = InferColumnProjection(*reader, *options);
   ScanTaskVector tasks(row_groups.size());
 
   for (size_t i = 0; i < row_groups.size(); ++i) {
     tasks[i] = std::make_shared<ParquetScanTask>(row_groups[i], column_projection, reader,
-                                                 options, context);
+                                                 reader_options.use_page_index, options,
+                                                 context);
   }
 
   return MakeVectorIterator(std::move(tasks));
@@ -101,6 +101,15 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// option will be removed after support is added for simultaneous parallelization
     /// across files and columns.
     bool enable_parallel_column_conversion = false;
+
+    /// Skip the data pages which can't satisfy the scan's filter, using the page
+    /// indexes (ColumnIndex and OffsetIndex) of the row groups when present.
+    bool use_page_index = true;
+
+    /// Skip the row groups which can't satisfy the scan's filter according to
+    /// the Bloom filters of their column chunks, when present. These are used
+    /// for equality and is_in predicates.
+    bool use_bloom_filter = true;
   } reader_options;
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -18,9 +18,11 @@
 #include "arrow/dataset/file_parquet.h"
 
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
@@ -513,6 +515,97 @@ TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragmentsUsingStringColum
   CountRowGroupsInFragment(fragment, {0, 3}, equal(field_ref("x"), literal("a")));
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group of 1000 rows, written in pages of 100 rows
+  constexpr int64_t kRowGroupSize = 1000;
+  std::vector<int64_t> values(kRowGroupSize);
+  std::iota(values.begin(), values.end(), 0);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type>(values, &array);
+  auto table = Table::Make(schema({field("i64", int64())}), {array});
+
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder()
+                        .write_batch_size(100)
+                        ->data_pagesize(1)
+                        ->disable_dictionary()
+                        ->enable_write_page_index()
+                        ->build();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowGroupSize, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  opts_ = ScanOptions::Make(table->schema());
+  schema_ = table->schema();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+
+  // Only the pages which may satisfy the filter are read
+  SetFilter(greater_equal(field_ref("i64"), literal<int64_t>(750)));
+  CountRowsAndBatchesInScan(fragment, 300, 1);
+
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(150)),
+                equal(field_ref("i64"), literal<int64_t>(420))));
+  CountRowsAndBatchesInScan(fragment, 200, 1);
+
+  SetFilter(equal(field_ref("i64"), literal(kRowGroupSize)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  format_->reader_options.use_page_index = false;
+  SetFilter(greater_equal(field_ref("i64"), literal<int64_t>(750)));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Row group r holds the even values 2 * (4 * k + r): all row groups span the
+  // same range, so that statistics can't tell them apart
+  constexpr int kNumRowGroups = 4;
+  constexpr int kRowGroupSize = 250;
+  std::vector<int64_t> values;
+  for (int r = 0; r < kNumRowGroups; ++r) {
+    for (int k = 0; k < kRowGroupSize; ++k) {
+      values.push_back(2 * (kNumRowGroups * k + r));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type>(values, &array);
+  auto table = Table::Make(schema({field("i64", int64())}), {array});
+
+  parquet::BloomFilterOptions bloom_filter_options;
+  bloom_filter_options.ndv = kRowGroupSize;
+  bloom_filter_options.fpp = 0.01;
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("i64", bloom_filter_options)
+                        ->build();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, kRowGroupSize, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  opts_ = ScanOptions::Make(table->schema());
+  schema_ = table->schema();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+
+  // 84 = 2 * (4 * 10 + 2) is only in the third row group
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(84)));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+
+  // Odd values are in none
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(85)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(call("is_in", {field_ref("i64")},
+                 compute::SetLookupOptions{ArrayFromJSON(int64(), "[84, 85, 86]")}));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowGroupSize, 2);
+
+  format_->reader_options.use_bloom_filter = false;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(84)));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+}
+
 TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
   constexpr int64_t kNumRowGroups = 16;
   constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
@@ -41,6 +41,8 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   auto copy = ScanOptions::Make(std::move(schema));
   copy->filter = filter;
   copy->batch_size = batch_size;
+  copy->fragment_readahead = fragment_readahead;
+  copy->batch_readahead = batch_readahead;
   return copy;
 }
 
@@ -59,10 +61,19 @@ std::vector<std::string> ScanOptions::MaterializedFields() const {
   return fields;
 }
 
+Result<RecordBatchGenerator> ScanTask::ExecuteAsync() {
+  ARROW_ASSIGN_OR_RAISE(auto batch_it, Execute());
+  return MakeBackgroundGenerator(std::move(batch_it), context_->async_context.executor);
+}
+
 Result<RecordBatchIterator> InMemoryScanTask::Execute() {
   return MakeVectorIterator(record_batches_);
 }
 
+Result<RecordBatchGenerator> InMemoryScanTask::ExecuteAsync() {
+  return MakeVectorGenerator(record_batches_);
+}
+
 Result<FragmentIterator> Scanner::GetFragments() {
   if (fragment_ != nullptr) {
     return MakeVectorIterator(FragmentVector{fragment_});
@@ -82,6 +93,43 @@ Result<ScanTaskIterator> Scanner::Scan() {
   return GetScanTaskIterator(std::move(fragment_it), scan_options_, scan_context_);
 }
 
+Result<RecordBatchGenerator> Scanner::ScanBatchesAsync() {
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it, GetFragments());
+  auto options = scan_options_;
+  auto context = scan_context_;
+  auto executor = context->async_context.executor;
+
+  // Fragment discovery may involve I/O, so run it in the background as well
+  auto fragment_gen = MakeBackgroundGenerator(std::move(fragment_it), executor);
+
+  // Fragment -> generator of its (filtered and projected) batches. Scanning a
+  // fragment may block (e.g. on reading file metadata), hence the executor.
+  std::function<Future<RecordBatchGenerator>(const std::shared_ptr<Fragment>&)>
+      scan_fragment = [options, context, executor](
+                          const std::shared_ptr<Fragment>& fragment) {
+        return DeferNotOk(executor->Submit([=]() -> Result<RecordBatchGenerator> {
+          ARROW_ASSIGN_OR_RAISE(
+              auto scan_task_it,
+              GetScanTaskIterator(MakeVectorIterator(FragmentVector{fragment}), options,
+                                  context));
+          std::vector<RecordBatchGenerator> task_gens;
+          for (auto maybe_scan_task : scan_task_it) {
+            ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
+            ARROW_ASSIGN_OR_RAISE(auto task_gen, scan_task->ExecuteAsync());
+            task_gens.push_back(std::move(task_gen));
+          }
+          auto batch_gen = MakeConcatenatedGenerator(
+              MakeVectorGenerator(std::move(task_gens)));
+          return MakeReadaheadGenerator(std::move(batch_gen), options->batch_readahead);
+        }));
+      };
+
+  auto fragment_batch_gens =
+      MakeReadaheadGenerator(MakeMappedGenerator(std::move(fragment_gen), scan_fragment),
+                             options->fragment_readahead);
+  return MakeConcatenatedGenerator(std::move(fragment_batch_gens));
+}
+
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context) {
@@ -134,6 +182,16 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Readahead(int32_t fragment_readahead, int32_t batch_readahead) {
+  if (fragment_readahead < 0 || batch_readahead < 0) {
+    return Status::Invalid("Readahead must be non-negative, got ", fragment_readahead,
+                           " fragments and ", batch_readahead, " batches");
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  scan_options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchSize(int64_t batch_size) {
   if (batch_size <= 0) {
     return Status::Invalid("BatchSize must be greater than 0, got ", batch_size);
@@ -224,5 +282,17 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
                                   FlattenRecordBatchVector(std::move(state->batches)));
 }
 
+Future<std::shared_ptr<Table>> Scanner::ToTableAsync() {
+  auto maybe_batch_gen = ScanBatchesAsync();
+  if (!maybe_batch_gen.ok()) {
+    return Future<std::shared_ptr<Table>>::MakeFinished(maybe_batch_gen.status());
+  }
+  auto schema = scan_options_->schema();
+  return CollectAsyncGenerator(maybe_batch_gen.MoveValueUnsafe())
+      .Then([schema](const RecordBatchVector& batches) {
+        return Table::FromRecordBatches(schema, batches);
+      });
+}
+
 }  // namespace dataset
 }  // namespace arrow
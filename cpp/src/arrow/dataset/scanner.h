@@ -29,14 +29,20 @@
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
 
 constexpr int64_t kDefaultBatchSize = 1 << 20;
+constexpr int32_t kDefaultFragmentReadahead = 4;
+constexpr int32_t kDefaultBatchReadahead = 16;
+
+using RecordBatchGenerator = AsyncGenerator<std::shared_ptr<RecordBatch>>;
 
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
@@ -46,6 +52,10 @@ struct ARROW_DS_EXPORT ScanContext {
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// The executor on which the asynchronous scan path issues blocking reads.
+  /// Defaults to the global IO thread pool.
+  io::AsyncContext async_context;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -74,6 +84,13 @@ class ARROW_DS_EXPORT ScanOptions {
   // Maximum row count for scanned batches.
   int64_t batch_size = kDefaultBatchSize;
 
+  // Maximum number of fragments opened concurrently by an asynchronous scan.
+  int32_t fragment_readahead = kDefaultFragmentReadahead;
+
+  // Maximum number of batches requested ahead of the consumer, per fragment,
+  // by an asynchronous scan.
+  int32_t batch_readahead = kDefaultBatchReadahead;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -104,6 +121,12 @@ class ARROW_DS_EXPORT ScanTask {
   /// particular ScanTask implementation
   virtual Result<RecordBatchIterator> Execute() = 0;
 
+  /// \brief Like Execute, but yielding the record batches asynchronously.
+  ///
+  /// The default implementation pulls the batches of Execute() on the
+  /// context's async executor, so that the caller's thread is never blocked.
+  virtual Result<RecordBatchGenerator> ExecuteAsync();
+
   virtual ~ScanTask() = default;
 
   const std::shared_ptr<ScanOptions>& options() const { return options_; }
@@ -128,6 +151,8 @@ class ARROW_DS_EXPORT InMemoryScanTask : public ScanTask {
 
   Result<RecordBatchIterator> Execute() override;
 
+  Result<RecordBatchGenerator> ExecuteAsync() override;
+
  protected:
   std::vector<std::shared_ptr<RecordBatch>> record_batches_;
 };
@@ -163,12 +188,23 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Asynchronously scan the record batches of all fragments, in order.
+  ///
+  /// Up to ScanOptions::fragment_readahead fragments are opened concurrently,
+  /// and up to ScanOptions::batch_readahead batches of each are requested ahead
+  /// of the consumer, so that I/O and decoding overlap without blocking the
+  /// calling thread.
+  Result<RecordBatchGenerator> ScanBatchesAsync();
+
   /// \brief Convert a Scanner into a Table.
   ///
   /// Use this convenience utility with care. This will serially materialize the
   /// Scan result in memory before creating the Table.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Convert a Scanner into a Table, using the asynchronous scan path.
+  Future<std::shared_ptr<Table>> ToTableAsync();
+
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
   Result<FragmentIterator> GetFragments();
 
@@ -234,6 +270,15 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set how far ahead an asynchronous scan reads.
+  ///
+  /// \param[in] fragment_readahead the maximum number of fragments opened
+  ///            concurrently.
+  /// \param[in] batch_readahead the maximum number of batches requested ahead
+  ///            of the consumer, per fragment.
+  /// \returns An error if either number is negative.
+  Status Readahead(int32_t fragment_readahead, int32_t batch_readahead);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
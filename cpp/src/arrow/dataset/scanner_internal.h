@@ -30,26 +30,31 @@
 namespace arrow {
 namespace dataset {
 
+inline Result<std::shared_ptr<RecordBatch>> FilterSingleBatch(
+    std::shared_ptr<RecordBatch> in, const Expression& filter, MemoryPool* pool) {
+  compute::ExecContext exec_context{pool};
+  ARROW_ASSIGN_OR_RAISE(Datum mask,
+                        ExecuteScalarExpression(filter, Datum(in), &exec_context));
+
+  if (mask.is_scalar()) {
+    const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+    if (mask_scalar.is_valid && mask_scalar.value) {
+      return std::move(in);
+    }
+    return in->Slice(0, 0);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      Datum filtered,
+      compute::Filter(in, mask, compute::FilterOptions::Defaults(), &exec_context));
+  return filtered.record_batch();
+}
+
 inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it, Expression filter,
                                              MemoryPool* pool) {
   return MakeMaybeMapIterator(
-      [=](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
-        compute::ExecContext exec_context{pool};
-        ARROW_ASSIGN_OR_RAISE(Datum mask,
-                              ExecuteScalarExpression(filter, Datum(in), &exec_context));
-
-        if (mask.is_scalar()) {
-          const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
-          if (mask_scalar.is_valid && mask_scalar.value) {
-            return std::move(in);
-          }
-          return in->Slice(0, 0);
-        }
-
-        ARROW_ASSIGN_OR_RAISE(
-            Datum filtered,
-            compute::Filter(in, mask, compute::FilterOptions::Defaults(), &exec_context));
-        return filtered.record_batch();
+      [=](std::shared_ptr<RecordBatch> in) {
+        return FilterSingleBatch(std::move(in), filter, pool);
       },
       std::move(it));
 }
@@ -92,6 +97,33 @@ class FilterAndProjectScanTask : public ScanTask {
     return ProjectRecordBatch(std::move(filter_it), &projector_, context_->pool);
   }
 
+  Result<RecordBatchGenerator> ExecuteAsync() override {
+    ARROW_ASSIGN_OR_RAISE(auto gen, task_->ExecuteAsync());
+
+    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
+                          SimplifyWithGuarantee(filter_, partition_));
+
+    RETURN_NOT_OK(
+        KeyValuePartitioning::SetDefaultValuesFromKeys(partition_, &projector_));
+
+    // Batches may outlive this task, so capture the projector by value
+    auto projector = projector_;
+    auto pool = context_->pool;
+    std::function<Future<std::shared_ptr<RecordBatch>>(
+        const std::shared_ptr<RecordBatch>&)>
+        filter_and_project = [simplified_filter, projector,
+                              pool](const std::shared_ptr<RecordBatch>& in) {
+          auto filtered = FilterSingleBatch(in, simplified_filter, pool);
+          if (!filtered.ok()) {
+            return Future<std::shared_ptr<RecordBatch>>::MakeFinished(filtered.status());
+          }
+          RecordBatchProjector local_projector{projector};
+          return Future<std::shared_ptr<RecordBatch>>::MakeFinished(
+              local_projector.Project(**filtered, pool));
+        };
+    return MakeMappedGenerator(std::move(gen), std::move(filter_and_project));
+  }
+
  private:
   std::shared_ptr<ScanTask> task_;
   Expression partition_;
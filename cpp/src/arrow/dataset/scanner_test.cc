@@ -54,6 +54,15 @@ class TestScanner : public DatasetFixtureMixin {
     // Verifies that the unified BatchReader is equivalent to flattening all the
     // structures of the scanner, i.e. Scanner[Dataset[ScanTask[RecordBatch]]]
     AssertScannerEquals(expected.get(), &scanner);
+
+    // The asynchronous scan path yields the same batches, in the same order
+    ASSERT_OK_AND_ASSIGN(auto batch_gen, scanner.ScanBatchesAsync());
+    auto collected = CollectAsyncGenerator(batch_gen);
+    ASSERT_OK_AND_ASSIGN(auto batches, collected.result());
+    ASSERT_EQ(static_cast<int64_t>(batches.size()), total_batches);
+    for (const auto& actual : batches) {
+      AssertBatchesEqual(*batch, *actual);
+    }
   }
 };
 
@@ -144,6 +153,25 @@ TEST_F(TestScanner, ToTable) {
   ctx_->use_threads = true;
   ASSERT_OK_AND_ASSIGN(actual, scanner.ToTable());
   AssertTablesEqual(*expected, *actual);
+
+  ASSERT_OK_AND_ASSIGN(actual, scanner.ToTableAsync().result());
+  AssertTablesEqual(*expected, *actual);
+}
+
+TEST_F(TestScanner, ScanBatchesAsyncReadahead) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(kBatchSize, schema_);
+  auto scanner = MakeScanner(batch);
+
+  for (int32_t readahead : {0, 1, 64}) {
+    options_->fragment_readahead = readahead;
+    options_->batch_readahead = readahead;
+    ASSERT_OK_AND_ASSIGN(auto batch_gen, scanner.ScanBatchesAsync());
+    auto collected = CollectAsyncGenerator(batch_gen);
+    ASSERT_OK_AND_ASSIGN(auto batches, collected.result());
+    ASSERT_EQ(static_cast<int64_t>(batches.size()),
+              kNumberChildDatasets * kNumberBatches);
+  }
 }
 
 class TestScannerBuilder : public ::testing::Test {
@@ -180,6 +208,17 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+  ASSERT_OK(builder.Readahead(2, 8));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_EQ(scanner->options()->fragment_readahead, 2);
+  ASSERT_EQ(scanner->options()->batch_readahead, 8);
+
+  ASSERT_RAISES(Invalid, builder.Readahead(-1, 8));
+  ASSERT_RAISES(Invalid, builder.Readahead(2, -1));
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
@@ -20,11 +20,15 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -47,6 +51,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/client_auth.h"
@@ -95,6 +100,13 @@ FlightClientOptions::FlightClientOptions()
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+StripedGetOptions::StripedGetOptions()
+    : max_concurrent_streams(::arrow::internal::GetCpuThreadPool()->GetCapacity()),
+      max_in_flight_batches(16),
+      preserve_order(false) {}
+
+StripedGetOptions StripedGetOptions::Defaults() { return StripedGetOptions(); }
+
 struct ClientRpc {
   grpc::ClientContext context;
 
@@ -1214,6 +1226,202 @@ class FlightClient::FlightClientImpl {
   int64_t write_size_limit_bytes_;
 };
 
+namespace {
+
+/// A RecordBatchReader fed by worker threads, each of which reads the
+/// DoGet streams of one endpoint after another. Received batches are
+/// queued per endpoint; a worker blocks while max_in_flight_batches are
+/// queued, unless the consumer waits on the endpoint it is reading (in
+/// ordered mode), so that the consumer can always make progress.
+class StripedStreamReader : public RecordBatchReader {
+ public:
+  StripedStreamReader(FlightClient* client, const FlightCallOptions& call_options,
+                      const FlightInfo& info, const StripedGetOptions& options,
+                      std::shared_ptr<Schema> schema)
+      : client_(client),
+        call_options_(call_options),
+        endpoints_(info.endpoints()),
+        options_(options),
+        schema_(std::move(schema)),
+        stripes_(endpoints_.size()),
+        streams_(endpoints_.size(), nullptr) {}
+
+  ~StripedStreamReader() override { Stop(); }
+
+  void Start() {
+    int num_threads = static_cast<int>(endpoints_.size());
+    if (options_.max_concurrent_streams > 0) {
+      num_threads = std::min(num_threads, options_.max_concurrent_streams);
+    }
+    for (int i = 0; i < num_threads; ++i) {
+      workers_.emplace_back(&StripedStreamReader::WorkerLoop, this);
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    const size_t num_stripes = stripes_.size();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!status_.ok()) {
+        return status_;
+      }
+      // In unordered mode, batches are always queued on the first stripe
+      if (options_.preserve_order) {
+        while (current_ < num_stripes && stripes_[current_].finished &&
+               stripes_[current_].batches.empty()) {
+          ++current_;
+          // Wake up the worker of the new current stripe
+          cond_.notify_all();
+        }
+        if (current_ == num_stripes) {
+          break;
+        }
+      } else if (num_finished_ == num_stripes &&
+                 (num_stripes == 0 || stripes_[0].batches.empty())) {
+        break;
+      }
+      auto& batches = stripes_[current_].batches;
+      if (!batches.empty()) {
+        *out = std::move(batches.front());
+        batches.pop_front();
+        --in_flight_;
+        cond_.notify_all();
+        return Status::OK();
+      }
+      cond_.wait(lock);
+    }
+    out->reset();
+    return Status::OK();
+  }
+
+ private:
+  struct Stripe {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool finished = false;
+  };
+
+  void WorkerLoop() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_ || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      Status st = ReadEndpoint(index);
+      std::lock_guard<std::mutex> lock(mutex_);
+      stripes_[index].finished = true;
+      ++num_finished_;
+      if (!st.ok() && !stopped_) {
+        status_ = st;
+        CancelStreams();
+      }
+      cond_.notify_all();
+    }
+  }
+
+  Status ReadEndpoint(size_t index) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    FlightClient* client = client_;
+    std::unique_ptr<FlightClient> location_client;
+    if (!endpoint.locations.empty()) {
+      RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(),
+                                          options_.client_options, &location_client));
+      client = location_client.get();
+    }
+    std::unique_ptr<FlightStreamReader> stream;
+    RETURN_NOT_OK(client->DoGet(call_options_, endpoint.ticket, &stream));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return MakeFlightError(FlightStatusCode::Cancelled, "Striped DoGet was stopped");
+      }
+      streams_[index] = stream.get();
+    }
+    Status st = ReadStream(index, stream.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_[index] = nullptr;
+    return st;
+  }
+
+  Status ReadStream(size_t index, FlightStreamReader* stream) {
+    const size_t queue_index = options_.preserve_order ? index : 0;
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(stream->Next(&chunk));
+      if (chunk.data == nullptr) {
+        return Status::OK();
+      }
+      if (!chunk.data->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+        return Status::Invalid("Endpoint ", index, " returned schema ",
+                               chunk.data->schema()->ToString(),
+                               ", expected the flight's schema ", schema_->ToString());
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      // The current stripe only bypasses the limit while the consumer has
+      // nothing to read from it
+      cond_.wait(lock, [&] {
+        return stopped_ || in_flight_ < options_.max_in_flight_batches ||
+               (options_.preserve_order && index == current_ &&
+                stripes_[index].batches.empty());
+      });
+      if (stopped_) {
+        return MakeFlightError(FlightStatusCode::Cancelled, "Striped DoGet was stopped");
+      }
+      stripes_[queue_index].batches.push_back(std::move(chunk.data));
+      ++in_flight_;
+      cond_.notify_all();
+    }
+  }
+
+  // Must be called with the mutex held
+  void CancelStreams() {
+    stopped_ = true;
+    for (FlightStreamReader* stream : streams_) {
+      if (stream != nullptr) {
+        stream->Cancel();
+      }
+    }
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      CancelStreams();
+      cond_.notify_all();
+    }
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+    workers_.clear();
+  }
+
+  FlightClient* client_;
+  const FlightCallOptions call_options_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const StripedGetOptions options_;
+  const std::shared_ptr<Schema> schema_;
+  std::vector<std::thread> workers_;
+
+  // Protected by mutex_
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::vector<Stripe> stripes_;
+  std::vector<FlightStreamReader*> streams_;
+  size_t next_endpoint_ = 0;
+  size_t num_finished_ = 0;
+  size_t current_ = 0;
+  int64_t in_flight_ = 0;
+  bool stopped_ = false;
+  Status status_;
+};
+
+}  // namespace
+
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
 
 FlightClient::~FlightClient() {}
@@ -1277,6 +1485,23 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetStriped(const FlightCallOptions& options,
+                                  const FlightInfo& info,
+                                  const StripedGetOptions& striped_options,
+                                  std::shared_ptr<RecordBatchReader>* stream) {
+  if (striped_options.max_in_flight_batches <= 0) {
+    return Status::Invalid("max_in_flight_batches must be positive");
+  }
+  std::shared_ptr<Schema> schema;
+  ipc::DictionaryMemo dictionary_memo;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+  auto reader = std::make_shared<StripedStreamReader>(this, options, info,
+                                                      striped_options, std::move(schema));
+  reader->Start();
+  *stream = std::move(reader);
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
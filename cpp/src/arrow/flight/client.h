@@ -126,6 +126,42 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for FlightClient::DoGetStriped.
+class ARROW_FLIGHT_EXPORT StripedGetOptions {
+ public:
+  StripedGetOptions();
+
+  /// \brief The maximum number of endpoints read at once, each by
+  ///     its own thread. All endpoints are read concurrently if not
+  ///     positive.
+  ///
+  /// Defaults to the capacity of the CPU thread pool.
+  int max_concurrent_streams;
+
+  /// \brief The maximum number of batches received but not yet
+  ///     consumed, across all endpoints.
+  ///
+  /// A stream stops reading from the network while the limit is
+  /// reached. When preserve_order is set, the stream currently
+  /// consumed may exceed it by one batch, so that the consumer can
+  /// always make progress.
+  int64_t max_in_flight_batches;
+
+  /// \brief Whether to return the batches of each endpoint in turn,
+  ///     in endpoint order, rather than as they arrive.
+  ///
+  /// Endpoints are still read concurrently; the batches of later
+  /// endpoints are buffered until the earlier ones are consumed.
+  bool preserve_order;
+
+  /// \brief Options used to connect to the endpoints which list a
+  ///     location; endpoints without a location are read from this client.
+  FlightClientOptions client_options;
+
+  /// \brief Get default options.
+  static StripedGetOptions Defaults();
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -280,6 +316,32 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read all the endpoints of a flight concurrently as a
+  /// single stream of record batches
+  ///
+  /// Each endpoint is fetched with DoGet, from its first location or,
+  /// if it lists none, from this client. Servers may thus stripe a
+  /// dataset over several streams, to use more connections and cores
+  /// than a single DoGet would, by returning several endpoints from
+  /// GetFlightInfo.
+  ///
+  /// All endpoints must send batches of the flight's schema. The first
+  /// error of any stream is returned by the reader, and cancels the
+  /// other streams. This client must outlive the returned reader.
+  ///
+  /// \param[in] options Per-RPC options, used for every DoGet call
+  /// \param[in] info the flight to read
+  /// \param[in] striped_options how the endpoints are read and merged
+  /// \param[out] stream the returned RecordBatchReader
+  /// \return Status
+  Status DoGetStriped(const FlightCallOptions& options, const FlightInfo& info,
+                      const StripedGetOptions& striped_options,
+                      std::shared_ptr<RecordBatchReader>* stream);
+  Status DoGetStriped(const FlightInfo& info,
+                      std::shared_ptr<RecordBatchReader>* stream) {
+    return DoGetStriped({}, info, StripedGetOptions::Defaults(), stream);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
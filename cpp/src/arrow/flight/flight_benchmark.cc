@@ -38,6 +38,7 @@
 
 #include "arrow/flight/api.h"
 #include "arrow/flight/perf.pb.h"
+#include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/test_util.h"
 
 DEFINE_string(server_host, "",
@@ -57,6 +58,8 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_striped, false,
+            "Test DoGetStriped, reading all the streams through a single reader");
 
 namespace perf = arrow::flight::perf;
 namespace acc = boost::accumulators;
@@ -170,6 +173,36 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
   return PerformanceResult{num_batches, num_records, num_bytes};
 }
 
+arrow::Result<PerformanceResult> RunDoGetStripedTest(FlightClient* client,
+                                                     const FlightInfo& plan,
+                                                     PerformanceStats* stats) {
+  auto options = StripedGetOptions::Defaults();
+  options.max_concurrent_streams = FLAGS_num_threads;
+  std::shared_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(client->DoGetStriped({}, plan, options, &reader));
+
+  // This is hard-coded for right now, 4 columns each with int64
+  const int bytes_per_record = 32;
+
+  std::shared_ptr<RecordBatch> batch;
+  int64_t num_bytes = 0;
+  int64_t num_records = 0;
+  int64_t num_batches = 0;
+  StopWatch timer;
+  while (true) {
+    timer.Start();
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    stats->AddLatency(timer.Stop());
+    if (!batch) {
+      break;
+    }
+    ++num_batches;
+    num_records += batch->num_rows();
+    num_bytes += batch->num_rows() * bytes_per_record;
+  }
+  return PerformanceResult{num_batches, num_records, num_bytes};
+}
+
 arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint,
@@ -251,6 +284,15 @@ Status DoSinglePerfRun(FlightClient* client, bool test_put, PerformanceStats* st
 
   int64_t start_total_records = stats->total_records;
 
+  if (FLAGS_test_striped && !test_put) {
+    ARROW_ASSIGN_OR_RAISE(auto perf, RunDoGetStripedTest(client, *plan, stats));
+    stats->Update(perf.num_batches, perf.num_records, perf.num_bytes);
+    if (perf.num_records != static_cast<int64_t>(plan->total_records())) {
+      return Status::Invalid("Did not consume expected number of records");
+    }
+    return Status::OK();
+  }
+
   auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
   auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
@@ -295,6 +337,7 @@ Status DoSinglePerfRun(FlightClient* client, bool test_put, PerformanceStats* st
 }
 
 Status RunPerformanceTest(FlightClient* client, bool test_put) {
+  const auto copies_before = internal::GetFlightDataCopyStats();
   StopWatch timer;
   timer.Start();
 
@@ -336,6 +379,15 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  // Bytes copied rather than referenced by the client's gRPC (de)serialization
+  const auto copies = internal::GetFlightDataCopyStats();
+  const int64_t bytes_copied =
+      test_put ? copies.serialized_bytes_copied - copies_before.serialized_bytes_copied
+               : copies.deserialized_bytes_copied -
+                     copies_before.deserialized_bytes_copied;
+  std::cout << "Bytes copied per batch: "
+            << static_cast<double>(bytes_copied) / stats.total_batches << std::endl;
+
   return Status::OK();
 }
 
@@ -378,6 +430,8 @@ int main(int argc, char** argv) {
   std::cout << "Testing method: ";
   if (FLAGS_test_put) {
     std::cout << "DoPut";
+  } else if (FLAGS_test_striped) {
+    std::cout << "DoGetStriped";
   } else {
     std::cout << "DoGet";
   }
@@ -1467,6 +1467,81 @@ TEST_F(TestFlightClient, DoGetLargeBatch) {
   CheckDoGet(ticket, expected_batches);
 }
 
+TEST_F(TestFlightClient, DoGetStriped) {
+  BatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  const int num_batches = static_cast<int>(expected_batches.size());
+
+  // Endpoints without a location are read from the client's own server
+  std::vector<FlightEndpoint> endpoints(3, FlightEndpoint{{"ticket-ints-1"}, {}});
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*expected_batches[0]->schema(),
+                           FlightDescriptor::Path({"striped"}), endpoints, -1, -1,
+                           &data));
+  FlightInfo info(data);
+
+  for (bool preserve_order : {true, false}) {
+    for (int max_concurrent_streams : {0, 2}) {
+      for (int64_t max_in_flight_batches : {1, 16}) {
+        SCOPED_TRACE(std::to_string(preserve_order) + " " +
+                     std::to_string(max_concurrent_streams) + " " +
+                     std::to_string(max_in_flight_batches));
+        auto options = StripedGetOptions::Defaults();
+        options.preserve_order = preserve_order;
+        options.max_concurrent_streams = max_concurrent_streams;
+        options.max_in_flight_batches = max_in_flight_batches;
+        std::shared_ptr<RecordBatchReader> reader;
+        ASSERT_OK(client_->DoGetStriped({}, info, options, &reader));
+        AssertSchemaEqual(*expected_batches[0]->schema(), *reader->schema());
+
+        BatchVector batches;
+        ASSERT_OK(reader->ReadAll(&batches));
+        ASSERT_EQ(endpoints.size() * num_batches, batches.size());
+        std::vector<int> counts(num_batches, 0);
+        for (size_t i = 0; i < batches.size(); ++i) {
+          // The example batches all have a different length
+          int index = static_cast<int>(batches[i]->num_rows() - 10);
+          ASSERT_GE(index, 0);
+          ASSERT_LT(index, num_batches);
+          if (preserve_order) {
+            ASSERT_EQ(i % num_batches, index);
+          }
+          ASSERT_BATCHES_APPROX_EQUAL(*expected_batches[index], *batches[i]);
+          ++counts[index];
+        }
+        for (int count : counts) {
+          ASSERT_EQ(static_cast<int>(endpoints.size()), count);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestFlightClient, DoGetStripedError) {
+  std::vector<FlightEndpoint> endpoints(4, FlightEndpoint{{"ticket-ints-1"}, {}});
+  endpoints[2].ticket.ticket = "ARROW-5095-fail";
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"striped"}),
+                           endpoints, -1, -1, &data));
+  FlightInfo info(data);
+
+  for (bool preserve_order : {true, false}) {
+    auto options = StripedGetOptions::Defaults();
+    options.preserve_order = preserve_order;
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGetStriped({}, info, options, &reader));
+    BatchVector batches;
+    Status status = reader->ReadAll(&batches);
+    ASSERT_RAISES(UnknownError, status);
+    ASSERT_THAT(status.message(), ::testing::HasSubstr("Server-side error"));
+  }
+
+  auto options = StripedGetOptions::Defaults();
+  options.max_in_flight_batches = 0;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid, client_->DoGetStriped({}, info, options, &reader));
+}
+
 TEST_F(TestFlightClient, DoExchange) {
   auto descr = FlightDescriptor::Command("counter");
   BatchVector batches;
@@ -36,6 +36,7 @@
 #include "arrow/flight/api.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/perf.pb.h"
+#include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/test_util.h"
 
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
@@ -251,5 +252,11 @@ int main(int argc, char** argv) {
     std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
   }
   ARROW_CHECK_OK(g_server->Serve());
+
+  const auto copies = arrow::flight::internal::GetFlightDataCopyStats();
+  std::cout << "Messages serialized: " << copies.num_serialized
+            << ", bytes copied: " << copies.serialized_bytes_copied << std::endl;
+  std::cout << "Messages deserialized: " << copies.num_deserialized
+            << ", bytes copied: " << copies.deserialized_bytes_copied << std::endl;
   return 0;
 }
@@ -17,6 +17,7 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -70,6 +71,36 @@ using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
+namespace {
+
+// Relaxed: the counts are only read for reporting
+struct CopyCounters {
+  std::atomic<int64_t> num_serialized{0};
+  std::atomic<int64_t> serialized_bytes_copied{0};
+  std::atomic<int64_t> num_deserialized{0};
+  std::atomic<int64_t> deserialized_bytes_copied{0};
+};
+
+CopyCounters g_copy_counters;
+
+void Increment(std::atomic<int64_t>* counter, int64_t nbytes) {
+  counter->fetch_add(nbytes, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+FlightDataCopyStats GetFlightDataCopyStats() {
+  FlightDataCopyStats stats;
+  stats.num_serialized = g_copy_counters.num_serialized.load(std::memory_order_relaxed);
+  stats.serialized_bytes_copied =
+      g_copy_counters.serialized_bytes_copied.load(std::memory_order_relaxed);
+  stats.num_deserialized =
+      g_copy_counters.num_deserialized.load(std::memory_order_relaxed);
+  stats.deserialized_bytes_copied =
+      g_copy_counters.deserialized_bytes_copied.load(std::memory_order_relaxed);
+  return stats;
+}
+
 bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
                        CodedInputStream* input, std::shared_ptr<Buffer>* out) {
   uint32_t length;
@@ -121,6 +152,7 @@ class GrpcBuffer : public MutableBuffer {
         const uint8_t length = slice.data.inlined.length;
         ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
         std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+        Increment(&g_copy_counters.deserialized_bytes_copied, length);
       }
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
@@ -132,6 +164,8 @@ class GrpcBuffer : public MutableBuffer {
       }
       grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
       grpc_byte_buffer_reader_destroy(&reader);
+      Increment(&g_copy_counters.deserialized_bytes_copied,
+                static_cast<int64_t>(GRPC_SLICE_LENGTH(slice)));
 
       // Steal the slice reference
       *out = std::make_shared<GrpcBuffer>(slice, false);
@@ -285,17 +319,22 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
 
         slices.push_back(SliceFromBuffer(buffer));
 
-        // Write padding if not multiple of 8
+        // Write padding if not multiple of 8, referencing static memory
+        // rather than copying it
         const auto remainder = static_cast<int>(
             BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
         if (remainder) {
-          slices.push_back(grpc::Slice(kPaddingBytes, remainder));
+          slices.push_back(
+              grpc::Slice(kPaddingBytes, remainder, grpc::Slice::STATIC_SLICE));
         }
       }
     }
 
     DCHECK_EQ(static_cast<int>(header_size), header_stream.ByteCount());
   }
+  // Only the header was copied, the body slices reference the IPC buffers
+  Increment(&g_copy_counters.num_serialized, 1);
+  Increment(&g_copy_counters.serialized_bytes_copied, static_cast<int64_t>(header_size));
 
   // Hand off the slices to the returned ByteBuffer
   *out = grpc::ByteBuffer(slices.data(), slices.size());
@@ -318,6 +357,7 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
 
   std::shared_ptr<arrow::Buffer> wrapped_buffer;
   GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  Increment(&g_copy_counters.num_deserialized, 1);
 
   auto buffer_length = static_cast<int>(wrapped_buffer->size());
   CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "arrow/flight/internal.h"
@@ -53,6 +54,24 @@ struct FlightData {
   ::arrow::Result<std::unique_ptr<ipc::Message>> OpenMessage();
 };
 
+/// Process-wide counts of the FlightData bytes which the gRPC serialization
+/// copies rather than references, for performance testing
+struct FlightDataCopyStats {
+  /// Number of messages serialized
+  int64_t num_serialized = 0;
+  /// Bytes copied when serializing: the protobuf header, which embeds the
+  /// IPC metadata. Body buffers are referenced.
+  int64_t serialized_bytes_copied = 0;
+  /// Number of messages deserialized
+  int64_t num_deserialized = 0;
+  /// Bytes copied when deserializing: messages which gRPC received in
+  /// several slices are made contiguous
+  int64_t deserialized_bytes_copied = 0;
+};
+
+ARROW_FLIGHT_EXPORT
+FlightDataCopyStats GetFlightDataCopyStats();
+
 /// Write Flight message on gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if some error occurred (connection closed?).
 bool WritePayload(const FlightPayload& payload,
@@ -59,6 +59,10 @@ using KVVector = flatbuffers::Vector<KeyValueOffset>;
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// This uncompressed length in the prefix of a body buffer of a compressed
+// message means that the buffer data was written uncompressed
+constexpr int64_t kNoCompressionLength = -1;
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion::V5;
 
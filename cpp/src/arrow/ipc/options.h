@@ -18,6 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/ipc/type_fwd.h"
@@ -66,6 +69,24 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD.
   std::shared_ptr<util::Codec> codec;
 
+  /// \brief Per-field overrides of `codec`, by top-level field index
+  ///
+  /// A null codec writes the buffers of the field uncompressed, for example
+  /// for data known not to compress. The IPC format records a single
+  /// compression type per message, so other codecs must have the same
+  /// compression type as `codec` (they may use another compression level).
+  /// Ignored if `codec` is null; dictionary batches always use `codec`.
+  std::unordered_map<int, std::shared_ptr<util::Codec>> field_codecs;
+
+  /// \brief Minimum space savings for a buffer to be written compressed
+  ///
+  /// Space savings are 1 - compressed size / uncompressed size. Buffers
+  /// compressing worse than this, such as random floating-point data, are
+  /// written uncompressed, which also spares their decompression when reading.
+  /// If NaN (the default), buffers are always written compressed; otherwise
+  /// this must be between 0 and 1.
+  double min_space_savings = std::numeric_limits<double>::quiet_NaN();
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <ostream>
@@ -640,6 +642,121 @@ TEST_F(TestWriteRecordBatch, WriteWithCompression) {
   }
 }
 
+// A codec "compressing" by copying, to check how buffers are written
+// regardless of the compression libraries available
+class CopyingCodec : public util::Codec {
+ public:
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    std::memcpy(output_buffer, input, static_cast<size_t>(input_len));
+    return input_len;
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    std::memcpy(output_buffer, input, static_cast<size_t>(input_len));
+    return input_len;
+  }
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override {
+    return input_len;
+  }
+
+  Result<std::shared_ptr<util::Compressor>> MakeCompressor() override {
+    return Status::NotImplemented("Streaming compression");
+  }
+
+  Result<std::shared_ptr<util::Decompressor>> MakeDecompressor() override {
+    return Status::NotImplemented("Streaming decompression");
+  }
+
+  Compression::type compression_type() const override { return Compression::LZ4_FRAME; }
+};
+
+TEST_F(TestWriteRecordBatch, MinSpaceSavingsWritesUncompressedBuffers) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  int64_t length = 100;
+  auto values = rg.Int32(length, 0, 1000, /*null_probability=*/0);
+  auto batch =
+      RecordBatch::Make(::arrow::schema({field("f0", int32())}), length, {values});
+  const auto& data = checked_cast<const Int32Array&>(*values);
+
+  IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+  write_options.codec = std::make_shared<CopyingCodec>();
+  auto CheckValuesBuffer = [&](int64_t expected_length_prefix) {
+    ASSERT_OK_AND_ASSIGN(auto serialized, SerializeRecordBatch(*batch, write_options));
+    io::BufferReader reader(serialized);
+    ASSERT_OK_AND_ASSIGN(auto message, ReadMessage(&reader));
+    // Without nulls the validity bitmap is empty: the body starts with the values
+    const uint8_t* body = message->body()->data();
+    ASSERT_EQ(expected_length_prefix,
+              BitUtil::FromLittleEndian(*reinterpret_cast<const int64_t*>(body)));
+    ASSERT_EQ(0, std::memcmp(body + sizeof(int64_t), data.raw_values(),
+                             length * sizeof(int32_t)));
+  };
+
+  // Without a minimum, buffers are compressed even without any space savings
+  CheckValuesBuffer(length * sizeof(int32_t));
+  // Otherwise buffers which don't compress enough are prefixed with -1
+  write_options.min_space_savings = 0.1;
+  CheckValuesBuffer(internal::kNoCompressionLength);
+  // ... like those of a field with a null codec
+  write_options.min_space_savings = std::numeric_limits<double>::quiet_NaN();
+  write_options.field_codecs[0] = nullptr;
+  CheckValuesBuffer(internal::kNoCompressionLength);
+}
+
+TEST_F(TestWriteRecordBatch, WriteWithFieldCodecsAndMinSpaceSavings) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  int64_t length = 500;
+  auto schema = ::arrow::schema(
+      {field("f0", int32()), field("f1", float64()), field("f2", utf8())});
+  auto batch = RecordBatch::Make(schema, length,
+                                 {rg.Int32(length, 0, 3, /*null_probability=*/0.1),
+                                  rg.Float64(length, 0, 1, /*null_probability=*/0),
+                                  rg.String(length, 0, 10, /*null_probability=*/0.1)});
+
+  std::vector<Compression::type> codecs = {Compression::LZ4_FRAME, Compression::ZSTD};
+  for (auto codec : codecs) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    ASSERT_OK_AND_ASSIGN(auto compressed, SerializeRecordBatch(*batch, write_options));
+
+    // A null codec leaves the buffers of a field uncompressed
+    write_options.field_codecs[0] = nullptr;
+    ASSERT_OK_AND_ASSIGN(write_options.field_codecs[2], util::Codec::Create(codec));
+    CheckRoundtrip(*batch, write_options);
+    ASSERT_OK_AND_ASSIGN(auto serialized, SerializeRecordBatch(*batch, write_options));
+    ASSERT_GT(serialized->size(), compressed->size());
+
+    // Buffers which don't compress enough are written uncompressed
+    write_options.field_codecs.clear();
+    for (double min_space_savings : {0.0, 0.5, 1.0}) {
+      write_options.min_space_savings = min_space_savings;
+      CheckRoundtrip(*batch, write_options);
+    }
+    ASSERT_OK_AND_ASSIGN(serialized, SerializeRecordBatch(*batch, write_options));
+    ASSERT_GT(serialized->size(), compressed->size());
+
+    write_options.min_space_savings = 1.5;
+    ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+    write_options.min_space_savings = 0.5;
+    write_options.field_codecs[3] = nullptr;
+    ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+    for (auto other_codec : codecs) {
+      if (other_codec != codec && util::Codec::IsAvailable(other_codec)) {
+        write_options.field_codecs.clear();
+        ASSERT_OK_AND_ASSIGN(write_options.field_codecs[0],
+                             util::Codec::Create(other_codec));
+        ASSERT_RAISES(Invalid, SerializeRecordBatch(*batch, write_options));
+      }
+    }
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1616,6 +1733,264 @@ TEST_F(TestStreamFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
 TEST_F(TestFileFormat, ReadFieldSubset) { TestReadSubsetOfFields(); }
 
+// A file which makes the reader fetch all the buffers of a batch at once
+class NonZeroCopyBufferReader : public io::BufferReader {
+ public:
+  using io::BufferReader::BufferReader;
+
+  bool supports_zero_copy() const override { return false; }
+};
+
+// A RandomAccessFile counting the reads issued to the wrapped file
+class ReadCountingFile : public io::RandomAccessFile {
+ public:
+  explicit ReadCountingFile(std::shared_ptr<io::RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ++num_reads_;
+    return file_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ++num_reads_;
+    return file_->ReadAt(position, nbytes);
+  }
+
+  int64_t num_reads() const { return num_reads_.load(); }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  std::atomic<int64_t> num_reads_{0};
+};
+
+TEST(TestRecordBatchFileReader, CoalescedAndPreBufferedReads) {
+  auto my_schema = schema({field("a", int32()), field("b", utf8()),
+                           field("c", list(int16())), field("d", float64()),
+                           field("e", struct_({field("f", boolean())}))});
+  random::RandomArrayGenerator rand(/*seed=*/42);
+  BatchVector batches;
+  for (int i = 0; i < 4; ++i) {
+    auto list_values = rand.Int16(300, -10, 10, /*null_probability=*/0.2);
+    auto struct_values = rand.Boolean(100, 0.5, /*null_probability=*/0.2);
+    ArrayVector columns = {
+        rand.Int32(100, -10, 10, /*null_probability=*/0.2),
+        rand.String(100, 0, 10, /*null_probability=*/0.2),
+        // The size of a random list array is its number of offsets
+        rand.List(*list_values, 101, /*null_probability=*/0.2),
+        rand.Float64(100, -1, 1, /*null_probability=*/0.2),
+        *StructArray::Make({struct_values}, {"f"})};
+    batches.push_back(RecordBatch::Make(my_schema, 100, columns));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, my_schema));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  const std::vector<std::vector<int>> included_fields = {{}, {1, 3}, {2, 4}};
+  for (const auto& fields : included_fields) {
+    for (bool zero_copy : {true, false}) {
+      SCOPED_TRACE(zero_copy ? "zero-copy" : "not zero-copy");
+      std::shared_ptr<io::RandomAccessFile> buffer_file;
+      if (zero_copy) {
+        buffer_file = std::make_shared<io::BufferReader>(buffer);
+      } else {
+        buffer_file = std::make_shared<NonZeroCopyBufferReader>(buffer);
+      }
+      auto file = std::make_shared<ReadCountingFile>(buffer_file);
+      auto options = IpcReadOptions::Defaults();
+      options.included_fields = fields;
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+
+      auto check_batch = [&](int i) {
+        ASSERT_OK_AND_ASSIGN(auto actual, reader->ReadRecordBatch(i));
+        ASSERT_OK(actual->ValidateFull());
+        auto expected = batches[i];
+        for (int j = my_schema->num_fields() - 1; j >= 0 && !fields.empty(); --j) {
+          if (std::find(fields.begin(), fields.end(), j) == fields.end()) {
+            ASSERT_OK_AND_ASSIGN(expected, expected->RemoveColumn(j));
+          }
+        }
+        AssertBatchesEqual(*expected, *actual);
+      };
+
+      int64_t num_reads = file->num_reads();
+      for (int i = 0; i < 4; ++i) {
+        check_batch(i);
+      }
+      const int64_t num_on_demand_reads = file->num_reads() - num_reads;
+      // Batches which were not pre-buffered are still read on demand
+      ASSERT_OK(reader->PreBuffer({0, 2}, io::AsyncContext(),
+                                  io::CacheOptions::Defaults()));
+      for (int i = 0; i < 4; ++i) {
+        check_batch(i);
+      }
+      ASSERT_OK(reader->PreBuffer({3, 1}, io::AsyncContext(),
+                                  io::CacheOptions::Defaults()));
+      for (int i = 0; i < 4; ++i) {
+        check_batch(i);
+      }
+      ASSERT_RAISES(Invalid, reader->PreBuffer({4}, io::AsyncContext(),
+                                               io::CacheOptions::Defaults()));
+
+      // Pre-buffering all the batches coalesces their reads
+      num_reads = file->num_reads();
+      ASSERT_OK(reader->PreBuffer({0, 1, 2, 3}, io::AsyncContext(),
+                                  io::CacheOptions::Defaults()));
+      for (int i = 0; i < 4; ++i) {
+        check_batch(i);
+      }
+      ASSERT_LT(file->num_reads() - num_reads, num_on_demand_reads);
+    }
+  }
+}
+
+TEST(TestRecordBatchFileReader, ReadAsync) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto my_schema = schema({field("a", int64()), field("b", dict_type),
+                           field("c", large_utf8())});
+  random::RandomArrayGenerator rand(/*seed=*/42);
+  auto dict = rand.String(10, 0, 5, /*null_probability=*/0);
+  BatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_OK_AND_ASSIGN(
+        auto dict_array,
+        DictionaryArray::FromArrays(dict_type, rand.Int32(100, 0, 9, 0.1), dict));
+    batches.push_back(RecordBatch::Make(
+        my_schema, 100,
+        {rand.Int64(100, -10, 10, 0.1), dict_array, rand.LargeString(100, 0, 10, 0.1)}));
+  }
+
+  // Write to an actual file, whose asynchronous reads go through the IO pool
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("ipc-read-async-"));
+  ASSERT_OK_AND_ASSIGN(auto path, temp_dir->path().Join("batches.arrow"));
+  {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(path.ToString()));
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, my_schema));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  }
+
+  for (bool select_fields : {false, true}) {
+    auto options = IpcReadOptions::Defaults();
+    BatchVector expected = batches;
+    if (select_fields) {
+      options.included_fields = {1, 2};
+      for (auto& batch : expected) {
+        ASSERT_OK_AND_ASSIGN(batch, batch->RemoveColumn(0));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto file, io::ReadableFile::Open(path.ToString()));
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+
+    std::vector<Future<std::shared_ptr<RecordBatch>>> futures;
+    for (int i = 0; i < 5; ++i) {
+      futures.push_back(reader->ReadRecordBatchAsync(i, io::AsyncContext()));
+    }
+    for (int i = 0; i < 5; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, futures[i].result());
+      ASSERT_OK(batch->ValidateFull());
+      AssertBatchesEqual(*expected[i], *batch);
+    }
+    auto out_of_bounds = reader->ReadRecordBatchAsync(5, io::AsyncContext());
+    ASSERT_RAISES(Invalid, out_of_bounds.result());
+
+    for (int readahead : {0, 2, 10}) {
+      ASSERT_OK_AND_ASSIGN(
+          auto generator, reader->GetRecordBatchGenerator(readahead, io::AsyncContext()));
+      auto collected = CollectAsyncGenerator(generator);
+      ASSERT_OK_AND_ASSIGN(auto actual, collected.result());
+      ASSERT_EQ(actual.size(), expected.size());
+      for (size_t i = 0; i < actual.size(); ++i) {
+        AssertBatchesEqual(*expected[i], *actual[i]);
+      }
+    }
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator(-1, io::AsyncContext()));
+  }
+}
+
+// A RecordBatchFileReader only implementing the synchronous API
+class SyncOnlyFileReader : public RecordBatchFileReader {
+ public:
+  explicit SyncOnlyFileReader(std::shared_ptr<RecordBatchFileReader> reader)
+      : reader_(std::move(reader)) {}
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+  int num_record_batches() const override { return reader_->num_record_batches(); }
+  MetadataVersion version() const override { return reader_->version(); }
+  std::shared_ptr<const KeyValueMetadata> metadata() const override {
+    return reader_->metadata();
+  }
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) override {
+    return reader_->ReadRecordBatch(i);
+  }
+  ReadStats stats() const override { return reader_->stats(); }
+
+ private:
+  std::shared_ptr<RecordBatchFileReader> reader_;
+};
+
+TEST(TestRecordBatchFileReader, DefaultAsyncImplementations) {
+  auto my_schema = schema({field("a", int32()), field("b", utf8())});
+  random::RandomArrayGenerator rand(/*seed=*/42);
+  BatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    batches.push_back(RecordBatch::Make(
+        my_schema, 100,
+        {rand.Int32(100, -10, 10, /*null_probability=*/0.2),
+         rand.String(100, 0, 10, /*null_probability=*/0.2)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, my_schema));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto file = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(auto file_reader, RecordBatchFileReader::Open(file));
+  SyncOnlyFileReader reader(file_reader);
+
+  for (int i = 0; i < 5; ++i) {
+    auto future = reader.ReadRecordBatchAsync(i, io::AsyncContext());
+    ASSERT_OK_AND_ASSIGN(auto batch, future.result());
+    AssertBatchesEqual(*batches[i], *batch);
+  }
+  for (int readahead : {0, 2, 10}) {
+    ASSERT_OK_AND_ASSIGN(auto generator,
+                         reader.GetRecordBatchGenerator(readahead, io::AsyncContext()));
+    auto collected = CollectAsyncGenerator(generator);
+    ASSERT_OK_AND_ASSIGN(auto actual, collected.result());
+    ASSERT_EQ(actual.size(), batches.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *actual[i]);
+    }
+  }
+  ASSERT_RAISES(Invalid, reader.GetRecordBatchGenerator(-1, io::AsyncContext()));
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
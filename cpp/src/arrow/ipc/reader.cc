@@ -18,11 +18,13 @@
 #include "arrow/ipc/reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cstdint>
 #include <cstring>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -31,8 +33,10 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
@@ -42,10 +46,12 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
@@ -108,16 +114,131 @@ Status InvalidMessageType(MessageType expected, MessageType actual) {
 // ----------------------------------------------------------------------
 // Record batch read path
 
+/// Ranges of a file which were already read
+struct PrefetchedRanges {
+  /// Sorted and non-overlapping
+  std::vector<io::ReadRange> ranges;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+};
+
+/// Where the body of a message is read from
+struct MessageBody {
+  /// A body held entirely by `file`
+  MessageBody(io::RandomAccessFile* file)  // NOLINT runtime/explicit
+      : MessageBody(file, 0, -1) {}
+
+  MessageBody(io::RandomAccessFile* file, int64_t offset, int64_t length,
+              io::internal::ReadRangeCache* cache = NULLPTR,
+              const PrefetchedRanges* prefetched = NULLPTR)
+      : file(file),
+        offset(offset),
+        length(length),
+        cache(cache),
+        prefetched(prefetched) {}
+
+  io::RandomAccessFile* file;
+  /// The position of the body in `file`
+  int64_t offset;
+  /// The length of the body, or -1 if only known from the message metadata
+  int64_t length;
+  /// Pre-buffered ranges of `file` holding the body, if any
+  io::internal::ReadRangeCache* cache;
+  /// Already read ranges of `file` holding the body, if any
+  const PrefetchedRanges* prefetched;
+};
+
+// Sort `ranges` and merge those overlapping, which shouldn't happen in
+// well-formed files but must not reach the range coalescing logic
+std::vector<io::ReadRange> MergeOverlappingRanges(std::vector<io::ReadRange> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const io::ReadRange& a, const io::ReadRange& b) {
+              return a.offset < b.offset;
+            });
+  std::vector<io::ReadRange> merged;
+  for (const auto& range : ranges) {
+    if (range.length == 0) {
+      continue;
+    }
+    if (!merged.empty() && range.offset < merged.back().offset + merged.back().length) {
+      merged.back().length = std::max(merged.back().length,
+                                      range.offset + range.length - merged.back().offset);
+    } else {
+      merged.push_back(range);
+    }
+  }
+  return merged;
+}
+
+// Coalesce `ranges` for reading, according to the default cache options
+std::vector<io::ReadRange> CoalesceRanges(std::vector<io::ReadRange> ranges) {
+  const auto options = io::CacheOptions::Defaults();
+  return io::internal::CoalesceReadRanges(MergeOverlappingRanges(std::move(ranges)),
+                                          options.hole_size_limit,
+                                          options.range_size_limit);
+}
+
+Status CheckReadSize(const io::ReadRange& range, const Buffer& buffer) {
+  if (buffer.size() < range.length) {
+    return Status::IOError("Expected to be able to read ", range.length,
+                           " bytes at offset ", range.offset, ", got ", buffer.size());
+  }
+  return Status::OK();
+}
+
+// Slice each of `ranges` from the already read ranges containing them
+Status SlicePrefetchedRanges(const PrefetchedRanges& prefetched,
+                             const std::vector<io::ReadRange>& ranges,
+                             const std::vector<std::shared_ptr<Buffer>*>& out) {
+  const auto& coalesced = prefetched.ranges;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& range = ranges[i];
+    if (range.length == 0) {
+      out[i]->reset(new Buffer(nullptr, 0));
+      continue;
+    }
+    // Find the prefetched range containing this one
+    auto it = std::upper_bound(coalesced.begin(), coalesced.end(), range.offset,
+                               [](int64_t offset, const io::ReadRange& coalesced_range) {
+                                 return offset < coalesced_range.offset;
+                               });
+    if (it == coalesced.begin() || !(--it)->Contains(range)) {
+      return Status::Invalid("Range at offset ", range.offset, " of length ",
+                             range.length, " was not prefetched");
+    }
+    *out[i] = SliceBuffer(prefetched.buffers[it - coalesced.begin()],
+                          range.offset - it->offset, range.length);
+  }
+  return Status::OK();
+}
+
+// Read `ranges` of `file`, coalescing the reads of nearby ranges
+Status ReadRangesCoalesced(io::RandomAccessFile* file,
+                           const std::vector<io::ReadRange>& ranges,
+                           const std::vector<std::shared_ptr<Buffer>*>& out) {
+  PrefetchedRanges prefetched;
+  prefetched.ranges = CoalesceRanges(ranges);
+  for (const auto& range : prefetched.ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, file->ReadAt(range.offset, range.length));
+    RETURN_NOT_OK(CheckReadSize(range, *buffer));
+    prefetched.buffers.push_back(std::move(buffer));
+  }
+  return SlicePrefetchedRanges(prefetched, ranges, out);
+}
+
 /// The field_index and buffer_index are incremented based on how much of the
 /// batch is "consumed" (through nested data reconstruction, for example)
+///
+/// Buffers are not read while loading fields, but only by ReadBuffers(), so
+/// that reads of nearby buffers can be coalesced.
 class ArrayLoader {
  public:
   explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
                        MetadataVersion metadata_version, const IpcReadOptions& options,
-                       io::RandomAccessFile* file)
+                       const MessageBody& body, int64_t body_length)
       : metadata_(metadata),
         metadata_version_(metadata_version),
-        file_(file),
+        body_(body),
+        body_length_(body_length),
         max_recursion_depth_(options.max_recursion_depth) {}
 
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
@@ -135,7 +256,38 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
-    return file_->ReadAt(offset, length).Value(out);
+    if (offset > body_length_ || length > body_length_ - offset) {
+      return Status::IOError("Buffer ", buffer_index_, " exceeds the message body");
+    }
+    read_ranges_.push_back({body_.offset + offset, length});
+    read_destinations_.push_back(out);
+    return Status::OK();
+  }
+
+  /// \brief The ranges of the body file holding the buffers requested so far
+  const std::vector<io::ReadRange>& read_ranges() const { return read_ranges_; }
+
+  /// \brief Read the buffers requested so far into their arrays
+  Status ReadBuffers() {
+    if (body_.prefetched != nullptr) {
+      RETURN_NOT_OK(
+          SlicePrefetchedRanges(*body_.prefetched, read_ranges_, read_destinations_));
+    } else if (body_.cache != nullptr) {
+      for (size_t i = 0; i < read_ranges_.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(*read_destinations_[i], body_.cache->Read(read_ranges_[i]));
+      }
+    } else if (body_.file->supports_zero_copy()) {
+      for (size_t i = 0; i < read_ranges_.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(*read_destinations_[i],
+                              body_.file->ReadAt(read_ranges_[i].offset,
+                                                 read_ranges_[i].length));
+      }
+    } else {
+      RETURN_NOT_OK(ReadRangesCoalesced(body_.file, read_ranges_, read_destinations_));
+    }
+    read_ranges_.clear();
+    read_destinations_.clear();
+    return Status::OK();
   }
 
   Status LoadType(const DataType& type) { return VisitTypeInline(type, this); }
@@ -331,7 +483,9 @@ class ArrayLoader {
     // - dense union children must be rewritten (at least one of them)
     //   to insert the required null slots that were formerly omitted
     // So instead we bail out.
-    if (out_->null_count != 0 && out_->buffers[0] != nullptr) {
+    // (the validity bitmap itself is only read later, see ReadBuffers)
+    if (!skip_io_ && out_->null_count != 0 &&
+        internal::HasValidityBitmap(type.id(), metadata_version_)) {
       return Status::Invalid(
           "Cannot read pre-1.0.0 Union array with top-level validity bitmap");
     }
@@ -358,32 +512,41 @@ class ArrayLoader {
  private:
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
-  io::RandomAccessFile* file_;
+  const MessageBody body_;
+  const int64_t body_length_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
   bool skip_io_ = false;
+  std::vector<io::ReadRange> read_ranges_;
+  std::vector<std::shared_ptr<Buffer>*> read_destinations_;
 
   const Field* field_;
   ArrayData* out_;
 };
 
-Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
-                                                 const IpcReadOptions& options,
-                                                 util::Codec* codec) {
-  if (buf == nullptr || buf->size() == 0) {
-    return buf;
-  }
-
-  if (buf->size() < 8) {
+// The uncompressed length prefixed to a body buffer of a compressed message
+Result<int64_t> GetUncompressedLength(const Buffer& buf) {
+  if (buf.size() < 8) {
     return Status::Invalid(
         "Likely corrupted message, compressed buffers "
         "are larger than 8 bytes by construction");
   }
+  int64_t uncompressed_size =
+      BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(buf.data()));
+  if (uncompressed_size < 0 && uncompressed_size != internal::kNoCompressionLength) {
+    return Status::Invalid("Likely corrupted message, negative uncompressed length ",
+                           uncompressed_size);
+  }
+  return uncompressed_size;
+}
 
+Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
+                                                 int64_t uncompressed_size,
+                                                 const IpcReadOptions& options,
+                                                 util::Codec* codec) {
   const uint8_t* data = buf->data();
   int64_t compressed_size = buf->size() - sizeof(int64_t);
-  int64_t uncompressed_size = BitUtil::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
 
   ARROW_ASSIGN_OR_RAISE(auto uncompressed,
                         AllocateBuffer(uncompressed_size, options.memory_pool));
@@ -426,13 +589,37 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   // Flatten all buffers
   auto buffers = BufferAccumulator{}.Get(*fields);
 
+  // Buffers written uncompressed (see IpcWriteOptions::min_space_savings) are
+  // sliced in place, only the others are decompressed
+  std::vector<std::shared_ptr<Buffer>*> compressed_buffers;
+  std::vector<int64_t> uncompressed_sizes;
+  for (auto buffer : buffers) {
+    if (*buffer == nullptr || (*buffer)->size() == 0) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t uncompressed_size, GetUncompressedLength(**buffer));
+    if (uncompressed_size == internal::kNoCompressionLength) {
+      *buffer = SliceBuffer(*buffer, sizeof(int64_t));
+    } else {
+      compressed_buffers.push_back(buffer);
+      uncompressed_sizes.push_back(uncompressed_size);
+    }
+  }
+  if (compressed_buffers.empty()) {
+    return Status::OK();
+  }
+
   std::unique_ptr<util::Codec> codec;
   ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
 
+  // Fan out one task per buffer on the CPU thread pool
+  const int num_buffers = static_cast<int>(compressed_buffers.size());
   return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
+      options.use_threads && num_buffers > 1, num_buffers, [&](int i) {
+        ARROW_ASSIGN_OR_RAISE(
+            *compressed_buffers[i],
+            DecompressBuffer(*compressed_buffers[i], uncompressed_sizes[i], options,
+                             codec.get()));
         return Status::OK();
       });
 }
@@ -441,8 +628,8 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
-  ArrayLoader loader(metadata, metadata_version, options, file);
+    Compression::type compression, const MessageBody& body, int64_t body_length) {
+  ArrayLoader loader(metadata, metadata_version, options, body, body_length);
 
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
@@ -469,6 +656,7 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
       RETURN_NOT_OK(loader.SkipField(&field));
     }
   }
+  RETURN_NOT_OK(loader.ReadBuffers());
 
   // Dictionary resolution needs to happen on the unfiltered columns,
   // because fields are mapped structurally (by path in the original schema).
@@ -493,13 +681,14 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
     const IpcReadOptions& options, MetadataVersion metadata_version,
-    Compression::type compression, io::RandomAccessFile* file) {
+    Compression::type compression, const MessageBody& body, int64_t body_length) {
   if (inclusion_mask.size() > 0) {
     return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, dictionary_memo,
-                                 options, metadata_version, compression, file);
+                                 options, metadata_version, compression, body,
+                                 body_length);
   } else {
     return LoadRecordBatchSubset(metadata, schema, nullptr, dictionary_memo, options,
-                                 metadata_version, compression, file);
+                                 metadata_version, compression, body, body_length);
   }
 }
 
@@ -578,7 +767,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
 Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
     const Buffer& metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const DictionaryMemo* dictionary_memo,
-    const IpcReadOptions& options, io::RandomAccessFile* file) {
+    const IpcReadOptions& options, const MessageBody& body) {
   const flatbuf::Message* message = nullptr;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -586,6 +775,10 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
+  if (body.length >= 0 && message->bodyLength() > body.length) {
+    return Status::IOError("Message body length ", message->bodyLength(),
+                           " exceeds the ", body.length, " bytes available");
+  }
 
   Compression::type compression;
   RETURN_NOT_OK(GetCompression(batch, &compression));
@@ -597,7 +790,7 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
   }
   return LoadRecordBatch(batch, schema, inclusion_mask, dictionary_memo, options,
                          internal::GetMetadataVersion(message->version()), compression,
-                         file);
+                         body, message->bodyLength());
 }
 
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
@@ -705,10 +898,11 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
 
   // Load the dictionary data from the dictionary batch
   ArrayLoader loader(batch_meta, internal::GetMetadataVersion(message->version()),
-                     options, file);
+                     options, file, message->bodyLength());
   const auto dict_data = std::make_shared<ArrayData>();
   const Field dummy_field("", value_type);
   RETURN_NOT_OK(loader.Load(&dummy_field, dict_data.get()));
+  RETURN_NOT_OK(loader.ReadBuffers());
 
   if (compression != Compression::UNCOMPRESSED) {
     ArrayDataVector dict_fields{dict_data};
@@ -916,7 +1110,9 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
   return FileBlock{block->offset(), block->metaDataLength(), block->bodyLength()};
 }
 
-class RecordBatchFileReaderImpl : public RecordBatchFileReader {
+class RecordBatchFileReaderImpl
+    : public RecordBatchFileReader,
+      public std::enable_shared_from_this<RecordBatchFileReaderImpl> {
  public:
   RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {}
 
@@ -937,18 +1133,99 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       read_dictionaries_ = true;
     }
 
-    ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
+    // Only read the metadata of the message here: the loader then reads the
+    // buffers of the included fields, rather than the whole body
+    const FileBlock block = GetRecordBatchBlock(i);
+    std::shared_ptr<Buffer> metadata;
+    io::internal::ReadRangeCache* cache = nullptr;
+    auto it = pre_buffered_metadata_.find(i);
+    if (it != pre_buffered_metadata_.end()) {
+      metadata = it->second;
+      cache = pre_buffered_bodies_.get();
+    } else {
+      ARROW_ASSIGN_OR_RAISE(metadata, ReadMessageMetadata(block));
+    }
+    ++stats_.num_messages;
 
-    CHECK_HAS_BODY(*message);
-    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
+    MessageBody body(file_, block.offset + block.metadata_length, block.body_length,
+                     cache);
     ARROW_ASSIGN_OR_RAISE(
-        auto batch,
-        ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                &dictionary_memo_, options_, reader.get()));
+        auto batch, ReadRecordBatchInternal(*metadata, schema_, field_inclusion_mask_,
+                                            &dictionary_memo_, options_, body));
     ++stats_.num_record_batches;
     return batch;
   }
 
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(
+      int i, const io::AsyncContext& ctx) override {
+    return DeferNotOk(DoReadRecordBatchAsync(i, ctx));
+  }
+
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      int readahead, const io::AsyncContext& ctx) override {
+    if (readahead < 0) {
+      return Status::Invalid("Readahead must be non-negative, got ", readahead);
+    }
+    // Read the dictionaries upfront rather than when the generator is
+    // first invoked
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+    auto self = shared_from_this();
+    auto next_index = std::make_shared<std::atomic<int>>(0);
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator = [self, next_index, ctx]() {
+      const int i = next_index->fetch_add(1);
+      if (i >= self->num_record_batches()) {
+        return AsyncGeneratorEnd<std::shared_ptr<RecordBatch>>();
+      }
+      return self->ReadRecordBatchAsync(i, ctx);
+    };
+    return MakeReadaheadGenerator(std::move(generator), readahead);
+  }
+
+  Status PreBuffer(const std::vector<int>& indices, const io::AsyncContext& ctx,
+                   const io::CacheOptions& options) override {
+    for (int i : indices) {
+      if (i < 0 || i >= num_record_batches()) {
+        return Status::Invalid("Out of bounds record batch index: ", i);
+      }
+    }
+    pre_buffered_metadata_.clear();
+    pre_buffered_bodies_.reset();
+
+    // First read the metadata of the batches, which tells where their
+    // buffers are...
+    std::vector<io::ReadRange> metadata_ranges;
+    for (int i : indices) {
+      const FileBlock block = GetRecordBatchBlock(i);
+      RETURN_NOT_OK(CheckBlockAlignment(block));
+      metadata_ranges.push_back({block.offset, block.metadata_length});
+    }
+    io::internal::ReadRangeCache metadata_cache(shared_file_, ctx, options);
+    RETURN_NOT_OK(metadata_cache.Cache(MergeOverlappingRanges(metadata_ranges)));
+
+    std::unordered_map<int, std::shared_ptr<Buffer>> metadata_buffers;
+    std::vector<io::ReadRange> body_ranges;
+    for (size_t k = 0; k < indices.size(); ++k) {
+      const FileBlock block = GetRecordBatchBlock(indices[k]);
+      ARROW_ASSIGN_OR_RAISE(auto buffer, metadata_cache.Read(metadata_ranges[k]));
+      ARROW_ASSIGN_OR_RAISE(auto metadata, UnpackMessageMetadata(std::move(buffer)));
+      MessageBody body(file_, block.offset + block.metadata_length, block.body_length);
+      ARROW_ASSIGN_OR_RAISE(auto ranges, GetRecordBatchBodyRanges(*metadata, body));
+      body_ranges.insert(body_ranges.end(), ranges.begin(), ranges.end());
+      metadata_buffers[indices[k]] = std::move(metadata);
+    }
+
+    // ...then cache the buffers of the included fields
+    auto bodies =
+        std::make_shared<io::internal::ReadRangeCache>(shared_file_, ctx, options);
+    RETURN_NOT_OK(bodies->Cache(MergeOverlappingRanges(std::move(body_ranges))));
+    pre_buffered_metadata_ = std::move(metadata_buffers);
+    pre_buffered_bodies_ = std::move(bodies);
+    return Status::OK();
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
               const IpcReadOptions& options) {
     owned_file_ = file;
@@ -958,6 +1235,12 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Status Open(io::RandomAccessFile* file, int64_t footer_offset,
               const IpcReadOptions& options) {
     file_ = file;
+    shared_file_ = owned_file_;
+    if (shared_file_ == nullptr) {
+      // Not owned: the caller keeps the file alive with this reader
+      shared_file_ =
+          std::shared_ptr<io::RandomAccessFile>(file_, [](io::RandomAccessFile*) {});
+    }
     options_ = options;
     footer_offset_ = footer_offset;
     RETURN_NOT_OK(ReadFooter());
@@ -984,12 +1267,138 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+  static Status CheckBlockAlignment(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
+
+  // Read the flatbuffer metadata of the message in `block`, but not its body
+  Result<std::shared_ptr<Buffer>> ReadMessageMetadata(const FileBlock& block) {
+    RETURN_NOT_OK(CheckBlockAlignment(block));
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    return UnpackMessageMetadata(std::move(buffer));
+  }
+
+  // Strip the length prefix (and continuation token) of message metadata
+  static Result<std::shared_ptr<Buffer>> UnpackMessageMetadata(
+      std::shared_ptr<Buffer> buffer) {
+    int64_t prefix_size = sizeof(int32_t);
+    if (buffer->size() < prefix_size) {
+      return Status::Invalid("Message metadata is too short: ", buffer->size());
+    }
+    int32_t flatbuffer_size =
+        BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(buffer->data()));
+    if (flatbuffer_size == internal::kIpcContinuationToken) {
+      prefix_size += sizeof(int32_t);
+      if (buffer->size() < prefix_size) {
+        return Status::Invalid("Message metadata is too short: ", buffer->size());
+      }
+      flatbuffer_size = BitUtil::FromLittleEndian(
+          util::SafeLoadAs<int32_t>(buffer->data() + sizeof(int32_t)));
+    }
+    if (flatbuffer_size <= 0 || flatbuffer_size > buffer->size() - prefix_size) {
+      return Status::Invalid("flatbuffer size ", flatbuffer_size,
+                             " invalid for message metadata of size ", buffer->size());
+    }
+    return SliceBuffer(std::move(buffer), prefix_size, flatbuffer_size);
+  }
+
+  // The ranges of the file holding the buffers of the included fields of a
+  // record batch
+  Result<std::vector<io::ReadRange>> GetRecordBatchBodyRanges(const Buffer& metadata,
+                                                              const MessageBody& body) {
+    const flatbuf::Message* message = nullptr;
+    RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+    auto batch = message->header_as_RecordBatch();
+    if (batch == nullptr) {
+      return Status::IOError(
+          "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    }
+    if (message->bodyLength() > body.length) {
+      return Status::IOError("Message body length ", message->bodyLength(),
+                             " exceeds the ", body.length, " bytes available");
+    }
+    ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()),
+                       options_, body, message->bodyLength());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const Field& field = *schema_->field(i);
+      ArrayData column;
+      if (field_inclusion_mask_.empty() || field_inclusion_mask_[i]) {
+        RETURN_NOT_OK(loader.Load(&field, &column));
+      } else {
+        RETURN_NOT_OK(loader.SkipField(&field));
+      }
+    }
+    return loader.read_ranges();
+  }
+
+  Result<Future<std::shared_ptr<RecordBatch>>> DoReadRecordBatchAsync(
+      int i, const io::AsyncContext& ctx) {
+    if (i < 0 || i >= num_record_batches()) {
+      return Status::Invalid("Out of bounds record batch index: ", i);
+    }
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+    const FileBlock block = GetRecordBatchBlock(i);
+    RETURN_NOT_OK(CheckBlockAlignment(block));
+    ++stats_.num_messages;
+    ++stats_.num_record_batches;
+
+    auto self = shared_from_this();
+    auto metadata_read =
+        shared_file_->ReadAsync(ctx, block.offset, block.metadata_length);
+    return metadata_read.Then([self, block, ctx](const std::shared_ptr<Buffer>& buffer) {
+      return DeferNotOk(self->ReadRecordBatchBodyAsync(block, buffer, ctx));
+    });
+  }
+
+  // Issue the reads of the buffers of the included fields of a record batch,
+  // given its metadata, and decode the batch once they complete
+  Result<Future<std::shared_ptr<RecordBatch>>> ReadRecordBatchBodyAsync(
+      const FileBlock& block, std::shared_ptr<Buffer> buffer,
+      const io::AsyncContext& ctx) {
+    RETURN_NOT_OK(CheckReadSize({block.offset, block.metadata_length}, *buffer));
+    ARROW_ASSIGN_OR_RAISE(auto metadata, UnpackMessageMetadata(std::move(buffer)));
+    const int64_t body_offset = block.offset + block.metadata_length;
+    ARROW_ASSIGN_OR_RAISE(
+        auto ranges,
+        GetRecordBatchBodyRanges(*metadata,
+                                 MessageBody(file_, body_offset, block.body_length)));
+
+    auto prefetched = std::make_shared<PrefetchedRanges>();
+    prefetched->ranges = CoalesceRanges(std::move(ranges));
+    std::vector<Future<std::shared_ptr<Buffer>>> reads;
+    for (const auto& range : prefetched->ranges) {
+      reads.push_back(shared_file_->ReadAsync(ctx, range.offset, range.length));
+    }
+
+    auto self = shared_from_this();
+    return All(std::move(reads))
+        .Then([self, block, metadata, prefetched](
+                  const std::vector<Result<std::shared_ptr<Buffer>>>& results)
+                  -> Result<std::shared_ptr<RecordBatch>> {
+          for (size_t i = 0; i < results.size(); ++i) {
+            RETURN_NOT_OK(results[i].status());
+            RETURN_NOT_OK(CheckReadSize(prefetched->ranges[i], **results[i]));
+            prefetched->buffers.push_back(*results[i]);
+          }
+          MessageBody body(self->file_, block.offset + block.metadata_length,
+                           block.body_length, /*cache=*/nullptr, prefetched.get());
+          return ReadRecordBatchInternal(*metadata, self->schema_,
+                                         self->field_inclusion_mask_,
+                                         &self->dictionary_memo_, self->options_, body);
+        });
+  }
+
+  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+    RETURN_NOT_OK(CheckBlockAlignment(block));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
     // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -1080,6 +1489,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::vector<bool> field_inclusion_mask_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
+  // owned_file_, or a non-owning pointer to file_, for asynchronous reads
+  std::shared_ptr<io::RandomAccessFile> shared_file_;
 
   // The location where the Arrow file layout ends. May be the end of the file
   // or some other location if embedded in a larger file.
@@ -1098,6 +1509,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   // Schema with deselected fields dropped
   std::shared_ptr<Schema> out_schema_;
 
+  // Set by PreBuffer(): the metadata of the pre-buffered batches, by index,
+  // and the cache holding their buffers
+  std::unordered_map<int, std::shared_ptr<Buffer>> pre_buffered_metadata_;
+  std::shared_ptr<io::internal::ReadRangeCache> pre_buffered_bodies_;
+
   ReadStats stats_;
 };
 
@@ -1128,6 +1544,37 @@ Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
   return result;
 }
 
+Future<std::shared_ptr<RecordBatch>> RecordBatchFileReader::ReadRecordBatchAsync(
+    int i, const io::AsyncContext& ctx) {
+  return Future<std::shared_ptr<RecordBatch>>::MakeFinished(ReadRecordBatch(i));
+}
+
+Result<AsyncGenerator<std::shared_ptr<RecordBatch>>>
+RecordBatchFileReader::GetRecordBatchGenerator(int readahead,
+                                               const io::AsyncContext& ctx) {
+  if (readahead < 0) {
+    return Status::Invalid("Readahead must be non-negative, got ", readahead);
+  }
+  // ReadRecordBatch isn't required to be thread-safe: the background
+  // generator reads the batches one after another, ahead of the consumer
+  auto next_index = std::make_shared<int>(0);
+  auto batch_it = MakeFunctionIterator(
+      [this, next_index]() -> Result<std::shared_ptr<RecordBatch>> {
+        if (*next_index >= num_record_batches()) {
+          return nullptr;
+        }
+        return ReadRecordBatch((*next_index)++);
+      });
+  auto generator = MakeBackgroundGenerator(std::move(batch_it), ctx.executor);
+  return MakeReadaheadGenerator(std::move(generator), readahead);
+}
+
+Status RecordBatchFileReader::PreBuffer(const std::vector<int>& indices,
+                                        const io::AsyncContext& ctx,
+                                        const io::CacheOptions& options) {
+  return Status::OK();
+}
+
 Status Listener::OnEOS() { return Status::OK(); }
 
 Status Listener::OnSchemaDecoded(std::shared_ptr<Schema> schema) { return Status::OK(); }
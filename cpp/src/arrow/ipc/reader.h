@@ -25,12 +25,14 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/options.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -167,6 +169,63 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Read a particular record batch from the file, asynchronously
+  ///
+  /// The message metadata and then the buffers of the included fields are
+  /// read with RandomAccessFile::ReadAsync, and the batch is decoded by the
+  /// thread completing the last read. Dictionaries are read synchronously
+  /// the first time a batch is read.
+  ///
+  /// The reader must have been opened with a shared_ptr to the file, or the
+  /// file must outlive the returned future.
+  ///
+  /// The default implementation reads the batch synchronously with
+  /// ReadRecordBatch.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] ctx the context in which to issue the reads
+  /// \return a future of the read batch
+  virtual Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(
+      int i, const io::AsyncContext& ctx);
+
+  /// \brief Return a generator of the record batches of the file, in order
+  ///
+  /// Up to `readahead` batches after the one requested are read
+  /// concurrently, which hides the latency of high-latency filesystems
+  /// (e.g. Amazon S3) when scanning a file. See ReadRecordBatchAsync.
+  ///
+  /// The default implementation reads the batches one at a time with
+  /// ReadRecordBatch, on the executor of `ctx`. The reader must then
+  /// outlive the generator.
+  ///
+  /// \param[in] readahead the number of batches to read ahead
+  /// \param[in] ctx the context in which to issue the reads
+  /// \return a generator of the batches, ending with a null batch
+  virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      int readahead, const io::AsyncContext& ctx);
+
+  /// \brief Pre-buffer the included fields of the specified record batches
+  ///
+  /// Readers can optionally call this to cache the necessary slices of the
+  /// file in-memory before deserialization: the buffers of the fields
+  /// selected by IpcReadOptions::included_fields are fetched concurrently,
+  /// with nearby reads coalesced according to options. This is intended to
+  /// increase performance when reading from high-latency filesystems
+  /// (e.g. Amazon S3).
+  ///
+  /// Record batches that were not pre-buffered are still read on demand.
+  /// Data remains buffered in memory until either PreBuffer() is called
+  /// again, or the reader itself is destructed.
+  ///
+  /// The default implementation does nothing: all batches are read on
+  /// demand.
+  ///
+  /// \param[in] indices the indices of the record batches to pre-buffer
+  /// \param[in] ctx the context in which to issue the reads
+  /// \param[in] options options to coalesce the reads
+  virtual Status PreBuffer(const std::vector<int>& indices, const io::AsyncContext& ctx,
+                           const io::CacheOptions& options);
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
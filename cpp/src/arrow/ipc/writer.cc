@@ -18,6 +18,7 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -182,28 +183,83 @@ class RecordBatchSerializer {
 
   Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
                         std::shared_ptr<Buffer>* out) {
+    if (codec == nullptr) {
+      return WriteUncompressedBuffer(buffer, out);
+    }
+
     // Convert buffer to uncompressed-length-prefixed compressed buffer
     int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
-    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t)));
+    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(maximum_length + sizeof(int64_t),
+                                                      options_.memory_pool));
 
     int64_t actual_length;
     ARROW_ASSIGN_OR_RAISE(actual_length,
                           codec->Compress(buffer.size(), buffer.data(), maximum_length,
                                           result->mutable_data() + sizeof(int64_t)));
+    // Always false if min_space_savings is NaN
+    if (1.0 - static_cast<double>(actual_length) / buffer.size() <
+        options_.min_space_savings) {
+      return WriteUncompressedBuffer(buffer, out);
+    }
     *reinterpret_cast<int64_t*>(result->mutable_data()) =
         BitUtil::ToLittleEndian(buffer.size());
     *out = SliceBuffer(std::move(result), /*offset=*/0, actual_length + sizeof(int64_t));
     return Status::OK();
   }
 
-  Status CompressBodyBuffers() {
+  // Convert buffer to a buffer prefixed with kNoCompressionLength, which
+  // readers don't decompress
+  Status WriteUncompressedBuffer(const Buffer& buffer, std::shared_ptr<Buffer>* out) {
+    ARROW_ASSIGN_OR_RAISE(auto result, AllocateBuffer(buffer.size() + sizeof(int64_t),
+                                                      options_.memory_pool));
+    *reinterpret_cast<int64_t*>(result->mutable_data()) =
+        BitUtil::ToLittleEndian(internal::kNoCompressionLength);
+    std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(), buffer.size());
+    *out = std::move(result);
+    return Status::OK();
+  }
+
+  // Resolve the codec of each body buffer from the per-field codecs, where
+  // field_buffer_starts[i] is the index of the first buffer of field i
+  Result<std::vector<util::Codec*>> GetBufferCodecs(
+      const std::vector<size_t>& field_buffer_starts) {
+    std::vector<util::Codec*> codecs(out_->body_buffers.size(), options_.codec.get());
+    if (!use_field_codecs_) {
+      return codecs;
+    }
+    const int num_fields = static_cast<int>(field_buffer_starts.size());
+    for (const auto& field_codec : options_.field_codecs) {
+      const int i = field_codec.first;
+      util::Codec* codec = field_codec.second.get();
+      if (i < 0 || i >= num_fields) {
+        return Status::Invalid("Out of bounds field index for codec: ", i);
+      }
+      if (codec != nullptr &&
+          codec->compression_type() != options_.codec->compression_type()) {
+        return Status::Invalid("Codec of field ", i, " (", codec->name(),
+                               ") differs from the message codec (",
+                               options_.codec->name(), ")");
+      }
+      const size_t end =
+          i + 1 < num_fields ? field_buffer_starts[i + 1] : out_->body_buffers.size();
+      std::fill(codecs.begin() + field_buffer_starts[i], codecs.begin() + end, codec);
+    }
+    return codecs;
+  }
+
+  Status CompressBodyBuffers(const std::vector<size_t>& field_buffer_starts) {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
+    if (options_.min_space_savings < 0 || options_.min_space_savings > 1) {
+      return Status::Invalid("min_space_savings must be between 0 and 1, got ",
+                             options_.min_space_savings);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto codecs, GetBufferCodecs(field_buffer_starts));
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
-        RETURN_NOT_OK(CompressBuffer(*out_->body_buffers[i], options_.codec.get(),
-                                     &out_->body_buffers[i]));
+        RETURN_NOT_OK(
+            CompressBuffer(*out_->body_buffers[i], codecs[i], &out_->body_buffers[i]));
       }
       return Status::OK();
     };
@@ -220,12 +276,14 @@ class RecordBatchSerializer {
     }
 
     // Perform depth-first traversal of the row-batch
+    std::vector<size_t> field_buffer_starts(batch.num_columns());
     for (int i = 0; i < batch.num_columns(); ++i) {
+      field_buffer_starts[i] = out_->body_buffers.size();
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
     if (options_.codec != nullptr) {
-      RETURN_NOT_OK(CompressBodyBuffers());
+      RETURN_NOT_OK(CompressBodyBuffers(field_buffer_starts));
     }
 
     // The position for the start of a buffer relative to the passed frame of
@@ -537,6 +595,8 @@ class RecordBatchSerializer {
   const IpcWriteOptions& options_;
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
+  // Whether options_.field_codecs apply to the columns being written
+  bool use_field_codecs_ = true;
 };
 
 class DictionarySerializer : public RecordBatchSerializer {
@@ -545,7 +605,9 @@ class DictionarySerializer : public RecordBatchSerializer {
                        const IpcWriteOptions& options, IpcPayload* out)
       : RecordBatchSerializer(buffer_start_offset, options, out),
         dictionary_id_(dictionary_id),
-        is_delta_(is_delta) {}
+        is_delta_(is_delta) {
+    use_field_codecs_ = false;
+  }
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
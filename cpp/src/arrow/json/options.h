@@ -39,6 +39,16 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+enum class ParserBackend : char {
+  /// Parse with rapidjson's SAX reader
+  RapidJSON,
+  /// Index structural characters with SIMD instructions before parsing
+  ///
+  /// This is generally faster on large blocks, especially those with long
+  /// string values.
+  StructuralIndex
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -53,6 +63,9 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Which JSON parser implementation is used to read blocks
+  ParserBackend parser_backend = ParserBackend::RapidJSON;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/json/structural_internal.h"
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
@@ -639,7 +640,8 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend) {
+    backend_ = backend;
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
@@ -701,9 +703,35 @@ class HandlerBase : public BlockParser,
     return Status::Invalid("Exceeded maximum rows");
   }
 
+  template <typename Handler>
+  Status DoStructuralParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
+    RETURN_NOT_OK(structural_reader_.Index(reinterpret_cast<const char*>(json->data()),
+                                           json->size()));
+
+    for (; num_rows_ < kMaxParserNumRows; ++num_rows_) {
+      switch (structural_reader_.Parse(handler)) {
+        case detail::StructuralReader::kValue:
+          // parse the next object
+          continue;
+        case detail::StructuralReader::kDocumentEmpty:
+          // parsed all objects, finish
+          return Status::OK();
+        case detail::StructuralReader::kTermination:
+          // handler emitted an error
+          return handler.Error();
+        case detail::StructuralReader::kError:
+          return ParseError(structural_reader_.error(), " in row ", num_rows_);
+      }
+    }
+    return Status::Invalid("Exceeded maximum rows");
+  }
+
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (backend_ == ParserBackend::StructuralIndex) {
+      return DoStructuralParse(handler, json);
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -843,6 +871,8 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  ParserBackend backend_ = ParserBackend::RapidJSON;
+  detail::StructuralReader structural_reader_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1086,7 +1116,8 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.parser_backend);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
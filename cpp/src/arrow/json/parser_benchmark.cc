@@ -102,17 +102,28 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.SetBytesProcessed(state.iterations() * json->size());
 }
 
-static void ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkParseJSONBlockWithSchema(
+    benchmark::State& state, ParserBackend backend) {  // NOLINT non-const reference
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = TestSchema();
+  options.parser_backend = backend;
 
   auto json = TestJsonData(num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, ParserBackend::RapidJSON);
+}
+
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONBlockWithSchema(state, ParserBackend::StructuralIndex);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -153,12 +164,51 @@ static void ReadJSONBlockWithSchemaMultiThread(
   BenchmarkReadJSONBlockWithSchema(state, true);
 }
 
+static void BenchmarkStreamJSONBlockWithSchema(
+    benchmark::State& state, bool use_threads) {  // NOLINT non-const reference
+  const int32_t num_rows = 500000;
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  parse_options.explicit_schema = TestSchema();
+
+  auto json = TestJsonData(num_rows);
+  for (auto _ : state) {
+    std::shared_ptr<io::InputStream> input;
+    ABORT_NOT_OK(MakeStream(json, &input));
+
+    ASSERT_OK_AND_ASSIGN(auto reader, StreamingReader::Make(default_memory_pool(), input,
+                                                            read_options, parse_options));
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ABORT_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+
+static void StreamJSONBlockWithSchemaSingleThread(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStreamJSONBlockWithSchema(state, false);
+}
+
+static void StreamJSONBlockWithSchemaMultiThread(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkStreamJSONBlockWithSchema(state, true);
+}
+
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
+BENCHMARK(StreamJSONBlockWithSchemaSingleThread);
+BENCHMARK(StreamJSONBlockWithSchemaMultiThread)->UseRealTime();
 
 }  // namespace json
 }  // namespace arrow
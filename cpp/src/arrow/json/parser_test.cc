@@ -245,5 +245,99 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+class BlockParserBackend : public ::testing::TestWithParam<ParserBackend> {
+ public:
+  ParseOptions Options() {
+    auto options = ParseOptions::Defaults();
+    options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+    options.parser_backend = GetParam();
+    return options;
+  }
+};
+
+TEST_P(BlockParserBackend, Basics) {
+  AssertParseColumns(
+      Options(), scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST_P(BlockParserBackend, Nested) {
+  auto options = Options();
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, {}, {"ps":"78"}, {"ps":"90"}])"});
+
+  options.explicit_schema = schema({field("yo", utf8()), field("arr", list(int32()))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8()))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])"});
+}
+
+TEST_P(BlockParserBackend, Null) {
+  AssertParseColumns(
+      Options(), null_src(),
+      {field("plain", null()), field("list1", list(null())), field("list2", list(null())),
+       field("struct", struct_({field("plain", null())}))},
+      {"[null, null]", "[[], []]", "[[], [null]]",
+       R"([{"plain": null}, {"plain": null}])"});
+}
+
+TEST_P(BlockParserBackend, Escapes) {
+  // Long values span several blocks of the structural index
+  std::string long_value =
+      std::string(70, 'x') + R"(\" ,:[]{} \\)" + std::string(70, 'y');
+  AssertParseColumns(
+      Options(),
+      R"({"a": "\"q\" \\ \/ \b\f\n\r\t", "b\u0041": "\u00e9\u5fcd\ud83d\ude00"})"
+      "\n"
+      R"({"a": "", "bA": ")" +
+          long_value + R"("})",
+      {field("a", utf8()), field("bA", utf8())},
+      {R"(["\"q\" \\ / \b\f\n\r\t", ""])",
+       R"(["\u00e9\u5fcd\ud83d\ude00", ")" + long_value + R"("])"});
+}
+
+TEST_P(BlockParserBackend, NumbersAndLiterals) {
+  AssertParseColumns(
+      Options(), "{\"n\": -0.5e+10, \"b\": true}\n{}\n{\"n\": NaN}\n{\"n\": -Infinity}",
+      {field("n", utf8()), field("b", boolean())},
+      {R"(["-0.5e+10", null, "NaN", "-Infinity"])", "[true, null, null, null]"});
+}
+
+TEST_P(BlockParserBackend, FailOnInvalidJson) {
+  for (auto src : {"{\"a\":0, \"b\"", "{\"a\":0,}", "{\"a\" 0}", "{\"a\":[1 2]}",
+                   "{\"a\":tru}", "{\"a\":01}", "{\"a\":1.}", "{\"a\":\"\\x\"}",
+                   "{\"a\":\"unterminated}", "{\"a\":0}}", "{\"a\":0} 1"}) {
+    SCOPED_TRACE(src);
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(Options(), src, &parsed));
+  }
+}
+
+TEST_P(BlockParserBackend, FailOnInconvertible) {
+  std::shared_ptr<Array> parsed;
+  Status error = ParseFromString(Options(), "{\"a\":0}\n{\"a\":true}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(
+      error.message(),
+      testing::StartsWith(
+          "JSON parse error: Column(/a) changed from number to boolean in row 1"));
+
+  error = ParseFromString(Options(), "{\"a\":0}\n{\"a\":0}\n{\"a\":[1,]}", &parsed);
+  ASSERT_RAISES(Invalid, error);
+  EXPECT_THAT(error.message(), testing::EndsWith(" in row 2"));
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockParserBackend, BlockParserBackend,
+                         ::testing::Values(ParserBackend::RapidJSON,
+                                           ParserBackend::StructuralIndex));
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -30,7 +32,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -45,6 +49,74 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+std::shared_ptr<DataType> InitialType(const ParseOptions& options) {
+  return options.explicit_schema ? struct_(options.explicit_schema->fields())
+                                 : struct_({});
+}
+
+// Parse the whole objects of a block, preceded by the object straddling it
+// and the previous block (if any)
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool, const ParseOptions& options,
+                                          const std::shared_ptr<Buffer>& partial,
+                                          const std::shared_ptr<Buffer>& completion,
+                                          const std::shared_ptr<Buffer>& whole) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, options, &parser));
+  RETURN_NOT_OK(
+      parser->ReserveScalarStorage(partial->size() + completion->size() + whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+// Convert a parsed block to a RecordBatch, starting from the given struct type.
+// If unexpected fields are type-inferred, the result's type may differ from it.
+Result<std::shared_ptr<RecordBatch>> ConvertBlock(MemoryPool* pool,
+                                                  const ParseOptions& options,
+                                                  const std::shared_ptr<DataType>& type,
+                                                  const std::shared_ptr<Array>& parsed) {
+  auto promotion_graph =
+      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+          ? GetPromotionGraph()
+          : nullptr;
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool, promotion_graph,
+                                        type, &builder));
+
+  builder->Insert(0, field("", type), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
+
+  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
+  for (int i = 0; i < converted->num_fields(); ++i) {
+    columns[i] = converted->field(i);
+  }
+  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
+                           std::move(columns));
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -113,9 +185,7 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
+    auto type = InitialType(parse_options_);
 
     auto promotion_graph =
         parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
@@ -128,30 +198,8 @@ class TableReaderImpl : public TableReader,
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    ARROW_ASSIGN_OR_RAISE(auto parsed,
+                          ParseBlock(pool_, parse_options_, partial, completion, whole));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -189,6 +237,204 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool),
+        max_readahead_(thread_pool ? std::max(thread_pool->GetCapacity(), 1) : 1) {}
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    if (thread_pool_ != nullptr) {
+      // The parse tasks already run max_readahead_ blocks ahead of the consumer,
+      // only read one more block from the input
+      ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                            MakeReadaheadIterator(std::move(it), /*readahead=*/1));
+    } else {
+      block_iterator_ = std::move(it);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // Infer the schema from the first block containing any objects
+    auto type = InitialType(parse_options_);
+    do {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, NextBlock());
+      if (!maybe_block.has_value()) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(pending_batch_,
+                            ParseAndConvert(pool_, parse_options_, type, *maybe_block));
+    } while (pending_batch_->num_rows() == 0);
+    schema_ = pending_batch_->schema();
+    type_ = struct_(schema_->fields());
+
+    // The following blocks are parsed and converted with the schema of the
+    // first one, rather than inferring their own types: e.g. integers in a
+    // floating point column are converted to it.  Fields absent from the
+    // first block can't be added to the stream.
+    block_options_ = parse_options_;
+    block_options_.explicit_schema = schema_;
+    if (block_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      block_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+
+    return SubmitBlocks();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (pending_batch_ != nullptr) {
+      *batch = std::move(pending_batch_);
+      return Status::OK();
+    }
+    Status st = DecodeNext(batch);
+    if (!st.ok()) {
+      // Chunking, parse or conversion error => bail out
+      block_.reset();
+      pending_blocks_.clear();
+    }
+    return st;
+  }
+
+ private:
+  // A block split by the chunker
+  struct ChunkedBlock {
+    std::shared_ptr<Buffer> partial, completion, whole;
+    int64_t block_index;
+  };
+
+  struct PendingBlock {
+    int64_t block_index;
+    Future<std::shared_ptr<RecordBatch>> decoded;
+  };
+
+  static Result<std::shared_ptr<RecordBatch>> ParseAndConvert(
+      MemoryPool* pool, const ParseOptions& options,
+      const std::shared_ptr<DataType>& type, const ChunkedBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool, options, block.partial,
+                                                  block.completion, block.whole));
+    return ConvertBlock(pool, options, type, parsed);
+  }
+
+  // Chunk the next block of the input, or return an empty optional at its end
+  Result<util::optional<ChunkedBlock>> NextBlock() {
+    if (block_ == nullptr) {
+      return util::nullopt;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto next_block, block_iterator_.Next());
+
+    ChunkedBlock chunked;
+    std::shared_ptr<Buffer> next_partial;
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &chunked.completion, &chunked.whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &chunked.completion,
+                                                 &starts_with_whole));
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &chunked.whole, &next_partial));
+    }
+    chunked.partial = std::move(partial_);
+    chunked.block_index = next_block_index_++;
+
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return chunked;
+  }
+
+  // Launch parse tasks for the next blocks, keeping at most max_readahead_
+  // blocks in flight between the chunker and the consumer.
+  Status SubmitBlocks() {
+    while (static_cast<int>(pending_blocks_.size()) < max_readahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, NextBlock());
+      if (!maybe_block.has_value()) {
+        break;
+      }
+      auto pool = pool_;
+      auto options = block_options_;
+      auto type = type_;
+      ChunkedBlock block = *std::move(maybe_block);
+      auto task = [pool, options, type, block] {
+        return ParseAndConvert(pool, options, type, block);
+      };
+
+      Future<std::shared_ptr<RecordBatch>> decoded;
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(decoded, thread_pool_->Submit(std::move(task)));
+      } else {
+        decoded = Future<std::shared_ptr<RecordBatch>>::MakeFinished(task());
+      }
+      pending_blocks_.push_back({block.block_index, std::move(decoded)});
+    }
+    return Status::OK();
+  }
+
+  Status DecodeNext(std::shared_ptr<RecordBatch>* batch) {
+    do {
+      RETURN_NOT_OK(SubmitBlocks());
+      if (pending_blocks_.empty()) {
+        *batch = nullptr;
+        return Status::OK();
+      }
+      PendingBlock block = std::move(pending_blocks_.front());
+      pending_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(*batch, block.decoded.result());
+
+      if (!(*batch)->schema()->Equals(*schema_)) {
+        return Status::Invalid("JSON block ", block.block_index,
+                               " does not conform to the schema of the first block.\n",
+                               "Expected:\n", schema_->ToString(), "\nGot:\n",
+                               (*batch)->schema()->ToString());
+      }
+    } while ((*batch)->num_rows() == 0);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  // The options of the blocks following the first one
+  ParseOptions block_options_;
+  std::unique_ptr<Chunker> chunker_;
+  ThreadPool* thread_pool_;
+  // Maximum number of blocks being parsed, converted or waiting for the consumer
+  // (besides the current block and the one read ahead from the input)
+  const int max_readahead_;
+
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  // Current block of the input and the partial object preceding it
+  std::shared_ptr<Buffer> block_, partial_;
+  int64_t next_block_index_ = 0;
+
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<RecordBatch> pending_batch_;
+  std::deque<PendingBlock> pending_blocks_;
+};
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto reader = std::make_shared<StreamingReaderImpl>(pool, read_options, parse_options,
+                                                      thread_pool);
+  RETURN_NOT_OK(reader->Init(std::move(input)));
+  return reader;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -196,29 +442,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
-
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
-                           std::move(columns));
+  return ConvertBlock(default_memory_pool(), options, InitialType(options), parsed);
 }
 
 }  // namespace json
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,37 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// Experimental
+///
+/// A class that reads line-separated JSON objects as a stream of RecordBatches
+///
+/// Each block of the input yields one batch (blocks without any objects are
+/// skipped).  The schema of the stream is that of the first block: later blocks
+/// are parsed and converted with it as their explicit schema, with absent fields
+/// filled with nulls.  An error is returned if they cannot be, e.g. if a field
+/// which only had nulls in the first block (and so has the null type) gets
+/// other values, if an integer field gets fractional values, or if a new field
+/// appears while unexpected_field_behavior is InferType.  Pass an explicit
+/// schema in the ParseOptions to avoid relying on the first block.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// The first block is read and converted immediately to infer the schema.
+  /// If ReadOptions::use_threads is true, the following blocks are parsed and
+  /// converted ahead of the consumer on the global CPU thread pool, still
+  /// yielding batches in file order.  At most as many blocks as the thread
+  /// pool's capacity are parsed, converted or waiting for the consumer, besides
+  /// the block being chunked and one more read from the input: the reader holds
+  /// up to (capacity + 2) blocks of ReadOptions::block_size bytes.  Otherwise,
+  /// blocks are read, parsed and converted one at a time on the calling thread.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
@@ -19,8 +19,10 @@
 #include <utility>
 #include <vector>
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
@@ -284,5 +286,173 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  Result<std::shared_ptr<StreamingReader>> MakeReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> stream;
+    RETURN_NOT_OK(MakeStream(input, &stream));
+    return StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                 parse_options_);
+  }
+
+  void AssertReadAll(util::string_view input, const Table& expected,
+                     int64_t expected_num_batches) {
+    ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(input));
+    AssertSchemaEqual(*expected.schema(), *reader->schema());
+    RecordBatchVector batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    ASSERT_EQ(batches.size(), static_cast<size_t>(expected_num_batches));
+    for (const auto& batch : batches) {
+      ASSERT_OK(batch->ValidateFull());
+      ASSERT_GT(batch->num_rows(), 0);
+    }
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         Table::FromRecordBatches(reader->schema(), batches));
+    AssertTablesEqual(expected, *actual, /*same_chunk_layout=*/false);
+
+    // End of stream is sticky
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_EQ(batch, nullptr);
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, MakeReader(""));
+
+  auto expected_table = Table::Make(schema({}), ArrayVector(), 2);
+  AssertReadAll("{}\n{}\n", *expected_table, 1);
+}
+
+TEST_P(StreamingReaderTest, MultipleBlocks) {
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  // The schema is inferred from the first block, later blocks are converted to it
+  // (even though "yo" is absent from the second one).  The last block of the file
+  // is "  " and doesn't yield a batch.
+  auto expected_table = TableFromJSON(schema, {R"([
+    {"hello": 3.5, "world": false, "yo": "thing"},
+    {"hello": 3.25, "world": null, "yo": null},
+    {"hello": 3.125, "world": null, "yo": "忍"},
+    {"hello": 0.0, "world": true, "yo": null}
+  ])"});
+  AssertReadAll(src, *expected_table, 3);
+}
+
+TEST_P(StreamingReaderTest, ManyBlocksInOrder) {
+  const int64_t count = 1 << 12;
+  read_options_.block_size = 512;
+
+  std::string json;
+  std::string expected = "[";
+  for (int64_t i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + ", \"b\":[\"" + std::to_string(i) + "\"]}\n";
+    expected += (i == 0 ? "" : ",") + std::to_string(i);
+  }
+  expected += "]";
+
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(json));
+  AssertSchemaEqual(*schema({field("a", int64()), field("b", list(utf8()))}),
+                    *reader->schema());
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_GT(table->column(0)->num_chunks(), 50);
+  ASSERT_OK_AND_ASSIGN(auto column, Concatenate(table->column(0)->chunks()));
+  AssertArraysEqual(*ArrayFromJSON(int64(), expected), *column);
+}
+
+TEST_P(StreamingReaderTest, ExplicitSchema) {
+  parse_options_.explicit_schema =
+      schema({field("hello", float32()), field("yo", utf8())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  auto src = nested_src();
+  read_options_.block_size = static_cast<int>(src.length() / 2);
+
+  auto expected_table = TableFromJSON(parse_options_.explicit_schema, {R"([
+    {"hello": 3.5, "yo": "thing"},
+    {"hello": 3.25, "yo": null},
+    {"hello": 3.125, "yo": "忍"},
+    {"hello": 0.0, "yo": null}
+  ])"});
+  AssertReadAll(src, *expected_table, 2);
+}
+
+TEST_P(StreamingReaderTest, SchemaChange) {
+  read_options_.block_size = 16;
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3.5}\n"));
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader->schema());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  Status st;
+  while (st.ok() && batch != nullptr) {
+    st = reader->ReadNext(&batch);
+  }
+  ASSERT_RAISES(Invalid, st);
+  EXPECT_THAT(st.message(), testing::HasSubstr("couldn't parse:3.5"));
+
+  // The reader is exhausted after an error
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, LaterBlocksConvertedToFirstSchema) {
+  read_options_.block_size = 16;
+  // Integers and nulls are converted to the floating point type of the first block
+  auto expected_table = TableFromJSON(schema({field("a", float64())}), {R"([
+    {"a": 1.5}, {"a": 2}, {"a": null}, {"a": 3}
+  ])"});
+  AssertReadAll("{\"a\": 1.5}\n{\"a\": 2}\n{\"a\": null}\n{\"a\": 3}\n", *expected_table,
+                3);
+}
+
+TEST_P(StreamingReaderTest, NullTypedFieldInFirstBlock) {
+  read_options_.block_size = 16;
+  const std::string prefix = "{\"a\": 1, \"b\": null}\n{\"a\": 2}\n";
+
+  // A field with only nulls in the first block has the null type
+  auto expected_table = TableFromJSON(schema({field("a", int64()), field("b", null())}),
+                                      {R"([{"a": 1, "b": null}, {"a": 2, "b": null}])"});
+  AssertReadAll(prefix, *expected_table, 1);
+
+  // ... so that other values for it in later blocks are an error
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(prefix + "{\"a\": 3, \"b\": 4}\n"));
+  AssertSchemaEqual(*expected_table->schema(), *reader->schema());
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+  EXPECT_THAT(st.message(), testing::HasSubstr("changed from null to number"));
+
+  // An explicit schema avoids it
+  parse_options_.explicit_schema = schema({field("b", int64())});
+  expected_table = TableFromJSON(schema({field("b", int64()), field("a", int64())}), {R"([
+    {"a": 1, "b": null}, {"a": 2, "b": null}, {"a": 3, "b": 4}
+  ])"});
+  AssertReadAll(prefix + "{\"a\": 3, \"b\": 4}\n", *expected_table, 2);
+}
+
+TEST_P(StreamingReaderTest, FailOnInvalidJson) {
+  read_options_.block_size = 16;
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("{\"a\": 1}\n{\"a\": 2}\n{\"a\" 3}\n"));
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+}
+
 }  // namespace json
 }  // namespace arrow
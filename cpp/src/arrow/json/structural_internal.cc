@@ -0,0 +1,415 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_internal.h"
+
+#include <initializer_list>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace json {
+namespace detail {
+
+namespace {
+
+constexpr int64_t kBlockSize = 64;
+
+// Positions of characters of interest within a 64-byte block
+struct BlockMasks {
+  uint64_t backslash;
+  uint64_t quote;
+  uint64_t op;
+  uint64_t whitespace;
+};
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+inline BlockMasks ClassifyBlock(const uint8_t* data) {
+  BlockMasks masks = {0, 0, 0, 0};
+  const __m128i lower_case_bit = _mm_set1_epi8(0x20);
+  for (int i = 0; i < kBlockSize; i += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    auto to_mask = [](__m128i matches) {
+      return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)));
+    };
+    // '[' and ']' only differ from '{' and '}' by the 0x20 bit
+    const __m128i folded = _mm_or_si128(v, lower_case_bit);
+    const __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                     _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+    const __m128i whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+    masks.backslash |= to_mask(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))) << i;
+    masks.quote |= to_mask(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))) << i;
+    masks.op |= to_mask(op) << i;
+    masks.whitespace |= to_mask(whitespace) << i;
+  }
+  return masks;
+}
+
+// Return a pointer to the first quote, backslash or control character
+// in [p, end), or end if there is none
+inline const char* FindStringSpecial(const char* p, const char* end) {
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  for (; end - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i matches =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                     _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return p + BitUtil::CountTrailingZeros(mask);
+    }
+  }
+  for (; p < end; ++p) {
+    if (*p == '"' || *p == '\\' || static_cast<uint8_t>(*p) < 0x20) {
+      break;
+    }
+  }
+  return p;
+}
+
+#else
+
+inline BlockMasks ClassifyBlock(const uint8_t* data) {
+  BlockMasks masks = {0, 0, 0, 0};
+  for (int i = 0; i < kBlockSize; ++i) {
+    const uint64_t bit = uint64_t(1) << i;
+    switch (data[i]) {
+      case '\\':
+        masks.backslash |= bit;
+        break;
+      case '"':
+        masks.quote |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        masks.op |= bit;
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        masks.whitespace |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  return masks;
+}
+
+inline const char* FindStringSpecial(const char* p, const char* end) {
+  for (; p < end; ++p) {
+    if (*p == '"' || *p == '\\' || static_cast<uint8_t>(*p) < 0x20) {
+      break;
+    }
+  }
+  return p;
+}
+
+#endif
+
+// Bit i of the result is the XOR of bits 0..i of the input
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+inline bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline int HexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+void AppendUtf8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+}  // namespace
+
+Status StructuralReader::Index(const char* data, int64_t size) {
+  if (size >= std::numeric_limits<uint32_t>::max()) {
+    return Status::Invalid("JSON block too large");
+  }
+  data_ = data;
+  size_ = size;
+  num_structurals_ = 0;
+  next_ = 0;
+  if (structurals_capacity_ < size) {
+    structurals_.reset(new uint32_t[size]);
+    structurals_capacity_ = size;
+  }
+  uint32_t* out = structurals_.get();
+
+  const uint64_t even_bits = 0x5555555555555555ULL;
+  // Whether the first character of the next block is escaped
+  uint64_t prev_escaped = 0;
+  // All ones if the previous block ended inside a string
+  uint64_t prev_in_string = 0;
+  // Whether the previous block ended with a non-quote scalar character
+  uint64_t prev_scalar = 0;
+
+  for (int64_t offset = 0; offset < size; offset += kBlockSize) {
+    BlockMasks masks;
+    if (size - offset >= kBlockSize) {
+      masks = ClassifyBlock(reinterpret_cast<const uint8_t*>(data + offset));
+    } else {
+      // Pad the last block with whitespace
+      uint8_t padded[kBlockSize];
+      std::memset(padded, ' ', kBlockSize);
+      std::memcpy(padded, data + offset, static_cast<size_t>(size - offset));
+      masks = ClassifyBlock(padded);
+    }
+
+    // Find escaped characters: those preceded by an odd-length run of backslashes
+    const uint64_t backslash = masks.backslash & ~prev_escaped;
+    const uint64_t follows_escape = (backslash << 1) | prev_escaped;
+    const uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+    const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+    prev_escaped = sequences_starting_on_even_bits < backslash;
+    const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    const uint64_t escaped = (even_bits ^ invert_mask) & follows_escape;
+
+    // Strings span from an opening quote (included) to a closing quote (excluded)
+    const uint64_t quote = masks.quote & ~escaped;
+    const uint64_t in_string = PrefixXor(quote) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    // Scalars start after an operator or whitespace
+    const uint64_t scalar = ~(masks.op | masks.whitespace);
+    const uint64_t nonquote_scalar = scalar & ~quote;
+    const uint64_t follows_nonquote_scalar = (nonquote_scalar << 1) | prev_scalar;
+    prev_scalar = nonquote_scalar >> 63;
+    const uint64_t scalar_starts = scalar & ~follows_nonquote_scalar;
+
+    // Ignore anything inside strings, except for their opening quotes
+    const uint64_t string_tail = in_string ^ quote;
+    uint64_t structurals = (masks.op | scalar_starts) & ~string_tail;
+
+    while (structurals != 0) {
+      out[num_structurals_++] =
+          static_cast<uint32_t>(offset + BitUtil::CountTrailingZeros(structurals));
+      structurals &= structurals - 1;
+    }
+  }
+  return Status::OK();
+}
+
+bool StructuralReader::ParseString(const char* p, const char** out_data,
+                                   uint32_t* out_size) {
+  const char* const end = data_ + size_;
+  const char* begin = ++p;
+  p = FindStringSpecial(p, end);
+  if (ARROW_PREDICT_TRUE(p < end && *p == '"')) {
+    // Fast path: no escape sequences
+    *out_data = begin;
+    *out_size = static_cast<uint32_t>(p - begin);
+    return true;
+  }
+
+  scratch_.assign(begin, p);
+  while (true) {
+    if (p == end) {
+      Error("Missing a closing quotation mark in string.");
+      return false;
+    }
+    if (*p == '"') {
+      break;
+    }
+    if (*p != '\\') {
+      Error("Invalid encoding in string.");
+      return false;
+    }
+    if (++p == end) {
+      continue;
+    }
+    switch (*p++) {
+      case '"':
+        scratch_.push_back('"');
+        break;
+      case '\\':
+        scratch_.push_back('\\');
+        break;
+      case '/':
+        scratch_.push_back('/');
+        break;
+      case 'b':
+        scratch_.push_back('\b');
+        break;
+      case 'f':
+        scratch_.push_back('\f');
+        break;
+      case 'n':
+        scratch_.push_back('\n');
+        break;
+      case 'r':
+        scratch_.push_back('\r');
+        break;
+      case 't':
+        scratch_.push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint = 0;
+        for (int i = 0; i < 4; ++i, ++p) {
+          const int digit = p < end ? HexValue(*p) : -1;
+          if (digit < 0) {
+            Error("Incorrect hex digit after \\u escape in string.");
+            return false;
+          }
+          codepoint = (codepoint << 4) | static_cast<uint32_t>(digit);
+        }
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+          // Surrogate pair: a low surrogate escape must follow
+          uint32_t low = 0;
+          bool valid = codepoint <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u';
+          for (int i = 2; valid && i < 6; ++i) {
+            const int digit = HexValue(p[i]);
+            valid = digit >= 0;
+            low = (low << 4) | static_cast<uint32_t>(digit);
+          }
+          if (!valid || low < 0xDC00 || low > 0xDFFF) {
+            Error("The surrogate pair in string is invalid.");
+            return false;
+          }
+          p += 6;
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        AppendUtf8(codepoint, &scratch_);
+        break;
+      }
+      default:
+        Error("Invalid escape character in string.");
+        return false;
+    }
+    const char* run_end = FindStringSpecial(p, end);
+    scratch_.append(p, run_end);
+    p = run_end;
+  }
+  *out_data = scratch_.data();
+  *out_size = static_cast<uint32_t>(scratch_.size());
+  return true;
+}
+
+const char* StructuralReader::ParseNumber(const char* p) const {
+  const char* const end = data_ + size_;
+  if (p < end && *p == '-') {
+    ++p;
+  }
+  if (p < end && (*p == 'N' || *p == 'I')) {
+    // NaN and Inf/Infinity, as allowed by rapidjson's kParseNanAndInfFlag
+    for (const char* literal : {"NaN", "Infinity", "Inf"}) {
+      const char* literal_end = ParseLiteral(p, literal);
+      if (literal_end != NULLPTR) {
+        return literal_end;
+      }
+    }
+    return NULLPTR;
+  }
+  if (p == end || !IsDigit(*p)) {
+    return NULLPTR;
+  }
+  if (*p++ != '0') {
+    while (p < end && IsDigit(*p)) {
+      ++p;
+    }
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    if (p == end || !IsDigit(*p)) {
+      return NULLPTR;
+    }
+    while (p < end && IsDigit(*p)) {
+      ++p;
+    }
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p < end && (*p == '+' || *p == '-')) {
+      ++p;
+    }
+    if (p == end || !IsDigit(*p)) {
+      return NULLPTR;
+    }
+    while (p < end && IsDigit(*p)) {
+      ++p;
+    }
+  }
+  return ScalarEndsAt(p) ? p : NULLPTR;
+}
+
+const char* StructuralReader::ParseLiteral(const char* p, const char* literal) const {
+  const auto length = static_cast<int64_t>(std::strlen(literal));
+  if (data_ + size_ - p < length || std::memcmp(p, literal, length) != 0) {
+    return NULLPTR;
+  }
+  return ScalarEndsAt(p + length) ? p + length : NULLPTR;
+}
+
+bool StructuralReader::ScalarEndsAt(const char* end) const {
+  return end == NextPosition() || (end < data_ + size_ && IsWhitespace(*end));
+}
+
+}  // namespace detail
+}  // namespace json
+}  // namespace arrow
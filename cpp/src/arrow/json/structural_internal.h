@@ -0,0 +1,279 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace json {
+namespace detail {
+
+/// \brief A two-stage JSON reader, in the manner of simdjson
+///
+/// Index() locates all structural characters of a block of JSON text ahead of
+/// parsing: brackets, braces, colons, commas and the first character of each
+/// scalar value, ignoring those inside strings.  This classifies 64 bytes at a
+/// time using SIMD instructions and tracks string boundaries with bitwise
+/// arithmetic, without branching on the input.
+///
+/// Parse() then walks the index to emit one top-level value at a time to a
+/// SAX handler, with the same interface and argument conventions as
+/// rapidjson::Reader using kParseNumbersAsStringsFlag and kParseNanAndInfFlag:
+/// numbers are passed verbatim through RawNumber().
+class StructuralReader {
+ public:
+  enum ParseResult {
+    /// A top-level value was parsed
+    kValue,
+    /// No more values in the block
+    kDocumentEmpty,
+    /// The handler returned false
+    kTermination,
+    /// The JSON text is invalid, see error()
+    kError
+  };
+
+  /// \brief Build the structural index of a block of JSON text
+  ///
+  /// The data must outlive any subsequent calls to Parse().
+  Status Index(const char* data, int64_t size);
+
+  /// \brief Parse the next top-level value of the indexed block
+  template <typename Handler>
+  ParseResult Parse(Handler& handler);
+
+  /// \brief Description of the last parse error
+  const char* error() const { return error_; }
+
+ protected:
+  enum ContainerKind : uint8_t { kObject, kArray };
+
+  struct Container {
+    ContainerKind kind;
+    uint32_t count;
+  };
+
+  // Position of the next structural character, or the end of data if none remains
+  const char* NextPosition() const {
+    return data_ + (next_ < num_structurals_ ? structurals_[next_] : size_);
+  }
+
+  // Consume and return the next structural character position
+  const char* Advance() {
+    const char* p = NextPosition();
+    if (next_ < num_structurals_) {
+      ++next_;
+    }
+    return p;
+  }
+
+  char CharAt(const char* p) const { return p < data_ + size_ ? *p : '\0'; }
+
+  ParseResult Error(const char* message) {
+    error_ = message;
+    return kError;
+  }
+
+  template <typename Handler>
+  ParseResult ParseScalar(Handler& handler, const char* p);
+
+  // Parse the string starting with the opening quote at `p`.  Escape sequences,
+  // if any, are decoded into scratch storage.
+  bool ParseString(const char* p, const char** out_data, uint32_t* out_size);
+
+  // Parse a number or literal (true, false, null) starting at `p`,
+  // return its end or nullptr if invalid.
+  const char* ParseNumber(const char* p) const;
+  const char* ParseLiteral(const char* p, const char* literal) const;
+
+  // Check that a scalar ending at `end` is followed by whitespace or
+  // the next structural character
+  bool ScalarEndsAt(const char* end) const;
+
+  const char* data_ = NULLPTR;
+  int64_t size_ = 0;
+  std::unique_ptr<uint32_t[]> structurals_;
+  int64_t structurals_capacity_ = 0;
+  int64_t num_structurals_ = 0;
+  int64_t next_ = 0;
+  std::vector<Container> stack_;
+  std::string scratch_;
+  const char* error_ = "";
+};
+
+template <typename Handler>
+StructuralReader::ParseResult StructuralReader::Parse(Handler& handler) {
+  if (next_ == num_structurals_) {
+    return kDocumentEmpty;
+  }
+  stack_.clear();
+
+  const char* p = Advance();
+  const char* string_data;
+  uint32_t string_size;
+
+Value:
+  if (ARROW_PREDICT_FALSE(p == data_ + size_)) {
+    return Error("Invalid value.");
+  }
+  switch (*p) {
+    case '{':
+      if (!handler.StartObject()) {
+        return kTermination;
+      }
+      p = Advance();
+      if (CharAt(p) == '}') {
+        if (!handler.EndObject(0)) {
+          return kTermination;
+        }
+        goto ValueEnd;
+      }
+      stack_.push_back({kObject, 0});
+      goto ObjectKey;
+
+    case '[':
+      if (!handler.StartArray()) {
+        return kTermination;
+      }
+      p = Advance();
+      if (CharAt(p) == ']') {
+        if (!handler.EndArray(0)) {
+          return kTermination;
+        }
+        goto ValueEnd;
+      }
+      stack_.push_back({kArray, 0});
+      goto Value;
+
+    case '"':
+      if (!ParseString(p, &string_data, &string_size)) {
+        return kError;
+      }
+      if (!handler.String(string_data, string_size, true)) {
+        return kTermination;
+      }
+      goto ValueEnd;
+
+    default: {
+      auto result = ParseScalar(handler, p);
+      if (result != kValue) {
+        return result;
+      }
+      goto ValueEnd;
+    }
+  }
+
+ObjectKey:
+  if (CharAt(p) != '"') {
+    return Error("Missing a name for object member.");
+  }
+  if (!ParseString(p, &string_data, &string_size)) {
+    return kError;
+  }
+  if (!handler.Key(string_data, string_size, true)) {
+    return kTermination;
+  }
+  p = Advance();
+  if (CharAt(p) != ':') {
+    return Error("Missing a colon after a name of object member.");
+  }
+  p = Advance();
+  goto Value;
+
+ValueEnd:
+  // A value was completed, continue with the enclosing container if any
+  if (stack_.empty()) {
+    return kValue;
+  }
+  ++stack_.back().count;
+  p = Advance();
+  if (stack_.back().kind == kObject) {
+    switch (CharAt(p)) {
+      case ',':
+        p = Advance();
+        goto ObjectKey;
+      case '}':
+        if (!handler.EndObject(stack_.back().count)) {
+          return kTermination;
+        }
+        stack_.pop_back();
+        goto ValueEnd;
+      default:
+        return Error("Missing a comma or '}' after an object member.");
+    }
+  } else {
+    switch (CharAt(p)) {
+      case ',':
+        p = Advance();
+        goto Value;
+      case ']':
+        if (!handler.EndArray(stack_.back().count)) {
+          return kTermination;
+        }
+        stack_.pop_back();
+        goto ValueEnd;
+      default:
+        return Error("Missing a comma or ']' after an array element.");
+    }
+  }
+}
+
+template <typename Handler>
+StructuralReader::ParseResult StructuralReader::ParseScalar(Handler& handler,
+                                                            const char* p) {
+  const char* end;
+  switch (*p) {
+    case 't':
+      end = ParseLiteral(p, "true");
+      if (end == NULLPTR) {
+        break;
+      }
+      return handler.Bool(true) ? kValue : kTermination;
+    case 'f':
+      end = ParseLiteral(p, "false");
+      if (end == NULLPTR) {
+        break;
+      }
+      return handler.Bool(false) ? kValue : kTermination;
+    case 'n':
+      end = ParseLiteral(p, "null");
+      if (end == NULLPTR) {
+        break;
+      }
+      return handler.Null() ? kValue : kTermination;
+    default:
+      end = ParseNumber(p);
+      if (end == NULLPTR) {
+        break;
+      }
+      return handler.RawNumber(p, static_cast<uint32_t>(end - p), true) ? kValue
+                                                                         : kTermination;
+  }
+  return Error("Invalid value.");
+}
+
+}  // namespace detail
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,293 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief A function yielding the elements of a sequence asynchronously
+///
+/// Each invocation returns a Future of the next element; the end of the
+/// sequence is signalled by IterationTraits<T>::End().
+///
+/// Unless documented otherwise, the generators produced by the factories in this
+/// file may be invoked again before the previously returned Futures are
+/// finished; elements are then delivered in invocation order.
+///
+/// EXPERIMENTAL
+template <typename T>
+using AsyncGenerator = std::function<Future<T>()>;
+
+template <typename T>
+bool IsIterationEnd(const T& value) {
+  return value == IterationTraits<T>::End();
+}
+
+/// An empty generator terminates a sequence of generators
+template <typename T>
+bool IsIterationEnd(const AsyncGenerator<T>& value) {
+  return !value;
+}
+
+template <typename T>
+Future<T> AsyncGeneratorEnd() {
+  return Future<T>::MakeFinished(IterationTraits<T>::End());
+}
+
+/// \brief Make a generator yielding the elements of a vector
+template <typename T>
+AsyncGenerator<T> MakeVectorGenerator(std::vector<T> vec) {
+  struct State {
+    explicit State(std::vector<T> vec) : vec(std::move(vec)) {}
+
+    std::mutex mutex;
+    std::vector<T> vec;
+    size_t index = 0;
+  };
+  auto state = std::make_shared<State>(std::move(vec));
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->index >= state->vec.size()) {
+      return AsyncGeneratorEnd<T>();
+    }
+    return Future<T>::MakeFinished(std::move(state->vec[state->index++]));
+  };
+}
+
+/// \brief Make a generator which only invokes `source` once the element
+/// previously requested from it is available
+///
+/// This is useful to make a generator which doesn't support overlapping
+/// invocations safe for reentrant use.
+template <typename T>
+AsyncGenerator<T> MakeSerialGenerator(AsyncGenerator<T> source) {
+  struct State {
+    explicit State(AsyncGenerator<T> source)
+        : source(std::move(source)), last(AsyncGeneratorEnd<T>()) {}
+
+    std::mutex mutex;
+    AsyncGenerator<T> source;
+    Future<T> last;
+  };
+  auto state = std::make_shared<State>(std::move(source));
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    // Errors don't stop the sequence: it's up to the consumer to give up
+    state->last = state->last.Then([state](const T&) { return state->source(); },
+                                   [state](const Status&) { return state->source(); });
+    return state->last;
+  };
+}
+
+/// \brief Make a generator applying `map` to each element of `source`
+template <typename T, typename V>
+AsyncGenerator<V> MakeMappedGenerator(AsyncGenerator<T> source,
+                                      std::function<Future<V>(const T&)> map) {
+  return [source, map]() {
+    return source().Then([map](const T& value) -> Future<V> {
+      if (IsIterationEnd(value)) {
+        return AsyncGeneratorEnd<V>();
+      }
+      return map(value);
+    });
+  };
+}
+
+/// \brief Make a generator yielding the elements of each generator of
+/// `source`, in order
+template <typename T>
+AsyncGenerator<T> MakeConcatenatedGenerator(AsyncGenerator<AsyncGenerator<T>> source) {
+  // Not reentrant by itself: `current` is only touched by one pending request
+  struct State {
+    explicit State(AsyncGenerator<AsyncGenerator<T>> source) : source(std::move(source)) {}
+
+    static Future<T> Next(const std::shared_ptr<State>& state) {
+      if (!state->current) {
+        return state->source().Then(
+            [state](const AsyncGenerator<T>& generator) -> Future<T> {
+              if (IsIterationEnd(generator)) {
+                return AsyncGeneratorEnd<T>();
+              }
+              state->current = generator;
+              return Next(state);
+            });
+      }
+      return state->current().Then([state](const T& value) -> Future<T> {
+        if (IsIterationEnd(value)) {
+          state->current = AsyncGenerator<T>();
+          return Next(state);
+        }
+        return Future<T>::MakeFinished(value);
+      });
+    }
+
+    AsyncGenerator<AsyncGenerator<T>> source;
+    AsyncGenerator<T> current;
+  };
+  auto state = std::make_shared<State>(std::move(source));
+  return MakeSerialGenerator<T>([state]() { return State::Next(state); });
+}
+
+/// \brief Make a generator keeping up to `max_readahead` requests to `source`
+/// in flight ahead of the consumer
+///
+/// `source` must support overlapping invocations.
+template <typename T>
+AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source, int max_readahead) {
+  struct State {
+    State(AsyncGenerator<T> source, int max_readahead)
+        : source(std::move(source)), max_readahead(max_readahead) {}
+
+    std::mutex mutex;
+    AsyncGenerator<T> source;
+    const int max_readahead;
+    std::deque<Future<T>> readahead;
+  };
+  auto state = std::make_shared<State>(std::move(source), std::max(max_readahead, 0));
+  return [state]() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    while (static_cast<int>(state->readahead.size()) <= state->max_readahead) {
+      state->readahead.push_back(state->source());
+    }
+    auto next = std::move(state->readahead.front());
+    state->readahead.pop_front();
+    return next;
+  };
+}
+
+/// \brief Make a generator pulling the elements of a (possibly blocking)
+/// iterator on `executor`
+///
+/// The iterator is only advanced by one task at a time; once it is exhausted
+/// or has failed, it is released and the generator yields the end.
+template <typename T>
+AsyncGenerator<T> MakeBackgroundGenerator(Iterator<T> iterator,
+                                          internal::Executor* executor) {
+  struct State {
+    explicit State(Iterator<T> iterator) : iterator(std::move(iterator)) {}
+
+    Result<T> Next() {
+      if (finished) {
+        return IterationTraits<T>::End();
+      }
+      auto next = iterator.Next();
+      if (!next.ok() || IsIterationEnd(*next)) {
+        finished = true;
+        iterator = Iterator<T>();
+      }
+      return next;
+    }
+
+    Iterator<T> iterator;
+    bool finished = false;
+  };
+  auto state = std::make_shared<State>(std::move(iterator));
+  return MakeSerialGenerator<T>([state, executor]() {
+    return DeferNotOk(executor->Submit([state]() { return state->Next(); }));
+  });
+}
+
+/// \brief Pass each element of `generator` to `visitor`, one at a time
+///
+/// The returned Future completes once the generator is exhausted, or with the
+/// first error returned by either the generator or the visitor.
+template <typename T>
+Future<> VisitAsyncGenerator(AsyncGenerator<T> generator,
+                             std::function<Status(T)> visitor) {
+  struct State {
+    State(AsyncGenerator<T> generator, std::function<Status(T)> visitor)
+        : generator(std::move(generator)),
+          visitor(std::move(visitor)),
+          done(Future<>::Make()) {}
+
+    // Return whether to keep going
+    static bool Handle(const std::shared_ptr<State>& state, const Result<T>& next) {
+      if (!next.ok()) {
+        state->done.MarkFinished(next.status());
+        return false;
+      }
+      if (IsIterationEnd(*next)) {
+        state->done.MarkFinished();
+        return false;
+      }
+      Status st = state->visitor(*next);
+      if (!st.ok()) {
+        state->done.MarkFinished(std::move(st));
+        return false;
+      }
+      return true;
+    }
+
+    static void Loop(const std::shared_ptr<State>& state) {
+      // Iterate rather than recurse while elements are readily available
+      while (true) {
+        Future<T> next = state->generator();
+        if (!next.is_finished()) {
+          next.AddCallback([state](const Result<T>& result) {
+            if (Handle(state, result)) {
+              Loop(state);
+            }
+          });
+          return;
+        }
+        if (!Handle(state, next.result())) {
+          return;
+        }
+      }
+    }
+
+    AsyncGenerator<T> generator;
+    std::function<Status(T)> visitor;
+    Future<> done;
+  };
+  auto state = std::make_shared<State>(std::move(generator), std::move(visitor));
+  State::Loop(state);
+  return state->done;
+}
+
+/// \brief Collect all elements of `generator` into a vector
+template <typename T>
+Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
+  auto vec = std::make_shared<std::vector<T>>();
+  auto visited = VisitAsyncGenerator<T>(std::move(generator), [vec](T value) {
+    vec->push_back(std::move(value));
+    return Status::OK();
+  });
+  return visited.Then([vec](const detail::Empty&) { return std::move(*vec); });
+}
+
+/// \brief Make a blocking iterator over the elements of `generator`
+template <typename T>
+Iterator<T> MakeGeneratorIterator(AsyncGenerator<T> generator) {
+  return MakeFunctionIterator(
+      [generator]() -> Result<T> { return generator().result(); });
+}
+
+}  // namespace arrow
@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/async_generator.h"
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+struct GenInt {
+  GenInt() = default;
+  explicit GenInt(int value) : value(value) {}
+
+  int value = -1;
+
+  bool operator==(const GenInt& other) const { return value == other.value; }
+  friend std::ostream& operator<<(std::ostream& os, const GenInt& v) {
+    return os << "GenInt(" << v.value << ")";
+  }
+};
+
+template <>
+struct IterationTraits<GenInt> {
+  static GenInt End() { return GenInt(); }
+};
+
+std::vector<GenInt> MakeInts(std::vector<int> values) {
+  std::vector<GenInt> out;
+  for (int value : values) {
+    out.emplace_back(value);
+  }
+  return out;
+}
+
+template <typename T>
+std::vector<T> Collect(AsyncGenerator<T> gen) {
+  auto fut = CollectAsyncGenerator(std::move(gen));
+  EXPECT_TRUE(fut.Wait(10));
+  EXPECT_OK_AND_ASSIGN(auto values, fut.result());
+  return values;
+}
+
+// A generator whose elements complete on a thread pool, after a delay
+// inversely related to their index, to shake out ordering issues
+AsyncGenerator<GenInt> MakeSlowGenerator(ThreadPool* pool, int num_values) {
+  auto index = std::make_shared<std::atomic<int>>(0);
+  return [pool, index, num_values]() {
+    const int i = (*index)++;
+    return DeferNotOk(pool->Submit([i, num_values]() {
+      if (i >= num_values) {
+        return IterationTraits<GenInt>::End();
+      }
+      SleepFor(1e-3 * ((num_values - i) % 3));
+      return GenInt(i);
+    }));
+  };
+}
+
+TEST(AsyncGenerator, Vector) {
+  auto gen = MakeVectorGenerator(MakeInts({1, 2, 3}));
+  ASSERT_EQ(Collect(gen), MakeInts({1, 2, 3}));
+  // Exhausted generators keep yielding the end
+  ASSERT_EQ(Collect(gen), MakeInts({}));
+}
+
+TEST(AsyncGenerator, Mapped) {
+  std::function<Future<GenInt>(const GenInt&)> twice = [](const GenInt& v) {
+    return Future<GenInt>::MakeFinished(GenInt(v.value * 2));
+  };
+  auto gen = MakeMappedGenerator(MakeVectorGenerator(MakeInts({1, 2, 3})), twice);
+  ASSERT_EQ(Collect(gen), MakeInts({2, 4, 6}));
+}
+
+TEST(AsyncGenerator, Concatenated) {
+  std::vector<AsyncGenerator<GenInt>> gens = {
+      MakeVectorGenerator(MakeInts({1, 2})), MakeVectorGenerator(MakeInts({})),
+      MakeVectorGenerator(MakeInts({3})), MakeVectorGenerator(MakeInts({4, 5}))};
+  auto gen = MakeConcatenatedGenerator(MakeVectorGenerator(std::move(gens)));
+  ASSERT_EQ(Collect(gen), MakeInts({1, 2, 3, 4, 5}));
+}
+
+TEST(AsyncGenerator, ReadaheadPreservesOrder) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  for (int readahead : {0, 1, 8}) {
+    auto gen = MakeReadaheadGenerator(MakeSlowGenerator(pool.get(), 20), readahead);
+    std::vector<int> expected(20);
+    std::iota(expected.begin(), expected.end(), 0);
+    ASSERT_EQ(Collect(gen), MakeInts(expected));
+  }
+}
+
+TEST(AsyncGenerator, Background) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  auto gen = MakeBackgroundGenerator(MakeVectorIterator(MakeInts({1, 2, 3, 4})),
+                                     pool.get());
+  // Overlapping requests are served in order
+  auto gen_with_readahead = MakeReadaheadGenerator(gen, 3);
+  ASSERT_EQ(Collect(gen_with_readahead), MakeInts({1, 2, 3, 4}));
+}
+
+TEST(AsyncGenerator, BackgroundError) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(2));
+  int count = 0;
+  auto it = MakeFunctionIterator([&count]() -> Result<GenInt> {
+    if (count == 2) {
+      return Status::IOError("xxx");
+    }
+    return GenInt(count++);
+  });
+  auto gen = MakeBackgroundGenerator(std::move(it), pool.get());
+  auto fut = CollectAsyncGenerator(gen);
+  ASSERT_RAISES(IOError, fut.result());
+  // The failed iterator was released
+  ASSERT_OK_AND_ASSIGN(auto next, gen().result());
+  ASSERT_EQ(next, IterationTraits<GenInt>::End());
+}
+
+TEST(AsyncGenerator, VisitError) {
+  auto gen = MakeVectorGenerator(MakeInts({1, 2, 3}));
+  std::vector<GenInt> seen;
+  auto fut = VisitAsyncGenerator<GenInt>(gen, [&seen](GenInt v) {
+    if (v.value == 2) {
+      return Status::Invalid("stop");
+    }
+    seen.push_back(v);
+    return Status::OK();
+  });
+  ASSERT_RAISES(Invalid, fut.status());
+  ASSERT_EQ(seen, MakeInts({1}));
+}
+
+TEST(AsyncGenerator, GeneratorIterator) {
+  auto it = MakeGeneratorIterator(MakeVectorGenerator(MakeInts({1, 2})));
+  ASSERT_OK_AND_ASSIGN(auto values, it.ToVector());
+  ASSERT_EQ(values, MakeInts({1, 2}));
+}
+
+}  // namespace arrow
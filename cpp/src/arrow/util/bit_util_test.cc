@@ -1906,6 +1906,55 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-1234);
   TestZigZag(std::numeric_limits<int32_t>::max());
   TestZigZag(-std::numeric_limits<int32_t>::max());
+  TestZigZag(std::numeric_limits<int32_t>::min());
+}
+
+TEST(BitStreamUtil, ZigZagEncoding) {
+  // Small magnitudes, positive or negative, take a single byte
+  const int32_t values[] = {0, -1, 1, -2, 2, -64, 63};
+  const uint8_t expected[] = {0, 1, 2, 3, 4, 127, 126};
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLength] = {};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    BitUtil::BitWriter writer(buffer, sizeof(buffer));
+    writer.PutZigZagVlqInt(values[i]);
+    writer.Flush();
+    EXPECT_EQ(writer.bytes_written(), 1);
+    EXPECT_EQ(buffer[0], expected[i]);
+  }
+}
+
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(-std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, Advance) {
+  uint8_t buffer[4] = {0xFF, 0x0F, 0xAB, 0x01};
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  uint32_t value;
+  ASSERT_TRUE(reader.Advance(12));
+  ASSERT_TRUE(reader.GetValue(4, &value));
+  ASSERT_EQ(value, 0);
+  ASSERT_TRUE(reader.Advance(8));
+  ASSERT_TRUE(reader.GetValue(8, &value));
+  ASSERT_EQ(value, 1);
+  ASSERT_FALSE(reader.Advance(1));
 }
 
 TEST(BitUtil, RoundTripLittleEndianTest) {
@@ -535,6 +535,43 @@ static Future<T> DeferNotOk(Result<Future<T>> maybe_future) {
   return std::move(maybe_future).MoveValueUnsafe();
 }
 
+/// \brief Create a Future which completes when all of `futures` complete.
+///
+/// The future's result is a vector of the results of `futures`.
+/// Note that this future will never be marked "failed"; failed results
+/// will be stored in the result vector alongside successful results.
+template <typename T>
+Future<std::vector<Result<T>>> All(std::vector<Future<T>> futures) {
+  struct State {
+    explicit State(std::vector<Future<T>> f)
+        : futures(std::move(f)), n_remaining(futures.size()) {}
+
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> n_remaining;
+  };
+
+  if (futures.empty()) {
+    return Future<std::vector<Result<T>>>::MakeFinished(std::vector<Result<T>>{});
+  }
+
+  auto state = std::make_shared<State>(std::move(futures));
+  auto out = Future<std::vector<Result<T>>>::Make();
+  for (const Future<T>& future : state->futures) {
+    future.AddCallback([state, out](const Result<T>&) mutable {
+      if (state->n_remaining.fetch_sub(1) != 1) {
+        return;
+      }
+      std::vector<Result<T>> results;
+      results.reserve(state->futures.size());
+      for (const Future<T>& future : state->futures) {
+        results.push_back(future.result());
+      }
+      out.MarkFinished(std::move(results));
+    });
+  }
+  return out;
+}
+
 /// \brief Wait for all the futures to end, or for the given timeout to expire.
 ///
 /// `true` is returned if all the futures completed before the timeout was reached,
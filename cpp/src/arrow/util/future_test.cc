@@ -971,6 +971,31 @@ TEST(FutureSyncTest, GetStatusFuture) {
   }
 }
 
+TEST(FutureAllTest, Simple) {
+  auto f1 = Future<int>::Make();
+  auto f2 = Future<int>::Make();
+  std::vector<Future<int>> futures = {f1, f2};
+  auto combined = All(futures);
+
+  AssertNotFinished(combined);
+  f2.MarkFinished(2);
+  AssertNotFinished(combined);
+  f1.MarkFinished(Status::IOError("xxx"));
+  AssertSuccessful(combined);
+
+  ASSERT_OK_AND_ASSIGN(auto results, combined.result());
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_RAISES(IOError, results[0]);
+  ASSERT_OK_AND_EQ(2, results[1]);
+}
+
+TEST(FutureAllTest, Empty) {
+  auto combined = All(std::vector<Future<int>>{});
+  AssertSuccessful(combined);
+  ASSERT_OK_AND_ASSIGN(auto results, combined.result());
+  ASSERT_EQ(results.size(), 0);
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
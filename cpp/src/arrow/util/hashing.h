@@ -41,6 +41,7 @@
 #include "arrow/util/bitmap_builders.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 
 #define XXH_INLINE_ALL
@@ -363,6 +364,237 @@ class HashTable {
   TypedBufferBuilder<Entry> entries_builder_;
 };
 
+// ----------------------------------------------------------------------
+// An insert-only hash table with SIMD-probed metadata (no deletes)
+//
+// This follows the "Swiss table" layout: besides the entries, the table keeps
+// one control byte per slot, holding either kEmpty or 7 bits of the slot's hash.
+// Slots are arranged in groups of 16 whose control bytes are compared against
+// the looked up hash in a single SIMD operation, so that entries (and payloads)
+// are only compared on a 7-bit match.  This allows a higher load factor than
+// HashTable while keeping probe sequences cheap.
+//
+// It has the same interface as HashTable, so either can be used as the
+// HashTableTemplateType of a memo table.
+
+template <typename Payload>
+class SwissHashTable {
+ public:
+  static constexpr hash_t kSentinel = 0ULL;
+  static constexpr int64_t kGroupSize = 16;
+
+  struct Entry {
+    hash_t h;
+    Payload payload;
+
+    // An entry is valid if the hash is different from the sentinel value
+    operator bool() const { return h != kSentinel; }
+  };
+
+  SwissHashTable(MemoryPool* pool, uint64_t capacity)
+      : entries_builder_(pool), control_builder_(pool) {
+    DCHECK_NE(pool, nullptr);
+    // Minimum of 32 elements, leaving room for the maximum load factor
+    capacity = std::max<uint64_t>(capacity + capacity / 4, 32UL);
+    capacity_ = BitUtil::NextPower2(capacity);
+    group_mask_ = capacity_ / kGroupSize - 1;
+    size_ = 0;
+
+    DCHECK_OK(UpsizeBuffer(capacity_));
+  }
+
+  // Lookup with quadratic probing over groups
+  // cmp_func should have signature bool(const Payload*).
+  // Return a (Entry*, found) pair.
+  template <typename CmpFunc>
+  std::pair<Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, control_, group_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  template <typename CmpFunc>
+  std::pair<const Entry*, bool> Lookup(hash_t h, CmpFunc&& cmp_func) const {
+    auto p = Lookup<DoCompare, CmpFunc>(h, entries_, control_, group_mask_,
+                                        std::forward<CmpFunc>(cmp_func));
+    return {&entries_[p.first], p.second};
+  }
+
+  Status Insert(Entry* entry, hash_t h, const Payload& payload) {
+    // Ensure entry is empty before inserting
+    assert(!*entry);
+    h = FixHash(h);
+    control_[entry - entries_] = Tag(h);
+    entry->h = h;
+    entry->payload = payload;
+    ++size_;
+
+    if (ARROW_PREDICT_FALSE(NeedUpsizing())) {
+      return Upsize(capacity_ * 2);
+    }
+    return Status::OK();
+  }
+
+  uint64_t size() const { return size_; }
+
+  // Visit all non-empty entries in the table
+  // The visit_func should have signature void(const Entry*)
+  template <typename VisitFunc>
+  void VisitEntries(VisitFunc&& visit_func) const {
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (control_[i] != kEmpty) {
+        visit_func(&entries_[i]);
+      }
+    }
+  }
+
+ protected:
+  static constexpr uint8_t kEmpty = 0x80;
+
+  // NoCompare is for when the value is known not to exist in the table
+  enum CompareKind { DoCompare, NoCompare };
+
+  // The workhorse lookup function
+  template <CompareKind CKind, typename CmpFunc>
+  std::pair<uint64_t, bool> Lookup(hash_t h, const Entry* entries,
+                                   const uint8_t* control, uint64_t group_mask,
+                                   CmpFunc&& cmp_func) const {
+    h = FixHash(h);
+    const uint8_t tag = Tag(h);
+    uint64_t group = (h >> 7) & group_mask;
+
+    for (uint64_t step = 1;; ++step) {
+      const uint64_t group_start = group * kGroupSize;
+      const Group group_control(control + group_start);
+      if (CKind == DoCompare) {
+        for (uint32_t matches = group_control.Match(tag); matches != 0;
+             matches &= matches - 1) {
+          const uint64_t index = group_start + BitUtil::CountTrailingZeros(matches);
+          const Entry* entry = &entries[index];
+          if (entry->h == h && cmp_func(&entry->payload)) {
+            // Found
+            return {index, true};
+          }
+        }
+      }
+      // Since nothing is ever deleted, the first empty slot on the probe sequence
+      // means the value isn't in the table and is the slot to insert it into
+      const uint32_t empty = group_control.MatchEmpty();
+      if (empty != 0) {
+        return {group_start + BitUtil::CountTrailingZeros(empty), false};
+      }
+      // Triangular steps visit all groups, since their number is a power of two
+      group = (group + step) & group_mask;
+    }
+  }
+
+  // The control bytes of a group of slots
+  class Group {
+   public:
+#if defined(ARROW_HAVE_SSE4_2)
+    explicit Group(const uint8_t* control)
+        : control_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+    // Bitmask of the control bytes equal to `tag`
+    uint32_t Match(uint8_t tag) const {
+      return static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(control_, _mm_set1_epi8(tag))));
+    }
+
+    // Bitmask of the empty slots (kEmpty is the only value with its high bit set)
+    uint32_t MatchEmpty() const {
+      return static_cast<uint32_t>(_mm_movemask_epi8(control_));
+    }
+
+   private:
+    __m128i control_;
+#else
+    explicit Group(const uint8_t* control) : control_(control) {}
+
+    // Bitmask of the control bytes equal to `tag`
+    uint32_t Match(uint8_t tag) const {
+      uint32_t mask = 0;
+      for (int64_t i = 0; i < kGroupSize; ++i) {
+        mask |= static_cast<uint32_t>(control_[i] == tag) << i;
+      }
+      return mask;
+    }
+
+    // Bitmask of the empty slots
+    uint32_t MatchEmpty() const { return Match(kEmpty); }
+
+   private:
+    const uint8_t* control_;
+#endif
+  };
+
+  bool NeedUpsizing() const {
+    // Keep the load factor <= 7/8
+    return size_ * 8 >= capacity_ * 7;
+  }
+
+  Status UpsizeBuffer(uint64_t capacity) {
+    RETURN_NOT_OK(entries_builder_.Resize(capacity));
+    entries_ = entries_builder_.mutable_data();
+    memset(static_cast<void*>(entries_), 0, capacity * sizeof(Entry));
+    RETURN_NOT_OK(control_builder_.Resize(capacity));
+    control_ = control_builder_.mutable_data();
+    memset(control_, kEmpty, capacity);
+
+    return Status::OK();
+  }
+
+  Status Upsize(uint64_t new_capacity) {
+    assert(new_capacity > capacity_);
+    const uint64_t new_group_mask = new_capacity / kGroupSize - 1;
+
+    // Stash old entries and seal builders, effectively resetting the Buffers
+    const Entry* old_entries = entries_;
+    const uint8_t* old_control = control_;
+    std::shared_ptr<Buffer> previous_entries, previous_control;
+    RETURN_NOT_OK(entries_builder_.Finish(&previous_entries));
+    RETURN_NOT_OK(control_builder_.Finish(&previous_control));
+    // Allocate new buffers
+    RETURN_NOT_OK(UpsizeBuffer(new_capacity));
+
+    for (uint64_t i = 0; i < capacity_; i++) {
+      if (old_control[i] != kEmpty) {
+        const auto& entry = old_entries[i];
+        // Dummy compare function will not be called
+        auto p = Lookup<NoCompare>(entry.h, entries_, control_, new_group_mask,
+                                   [](const Payload*) { return false; });
+        assert(!p.second);
+        entries_[p.first] = entry;
+        control_[p.first] = old_control[i];
+      }
+    }
+    capacity_ = new_capacity;
+    group_mask_ = new_group_mask;
+
+    return Status::OK();
+  }
+
+  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
+
+  // The 7 low bits of the hash make the tag, the bits above select the group.
+  // Both come from the same end of the hash, as only one end is well mixed for
+  // some hash functions (integer hashes are byte-swapped products, whose high
+  // bytes end up low): tags taken from the other end would all collide for
+  // e.g. multiples of a power of two.
+  static uint8_t Tag(hash_t h) { return static_cast<uint8_t>(h & 0x7F); }
+
+  // The number of slots available in the hash table array.
+  uint64_t capacity_;
+  uint64_t group_mask_;
+  // The number of used slots in the hash table array.
+  uint64_t size_;
+
+  Entry* entries_;
+  uint8_t* control_;
+  TypedBufferBuilder<Entry> entries_builder_;
+  TypedBufferBuilder<uint8_t> control_builder_;
+};
+
 // XXX typedef memo_index_t int32_t ?
 
 constexpr int32_t kKeyNotFound = -1;
@@ -589,7 +821,8 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
-template <typename BinaryBuilderT>
+template <typename BinaryBuilderT,
+          template <class> class HashTableTemplateType = HashTable>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
@@ -799,8 +1032,8 @@ class BinaryMemoTable : public MemoTable {
     int32_t memo_index;
   };
 
-  using HashTableType = HashTable<Payload>;
-  using HashTableEntry = typename HashTable<Payload>::Entry;
+  using HashTableType = HashTableTemplateType<Payload>;
+  using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
   BinaryBuilderT binary_builder_;
 
@@ -111,6 +111,73 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// ----------------------------------------------------------------------
+// Memo table benchmarks, comparing hash table implementations
+
+static constexpr int32_t kMemoTableValues = 1 << 20;
+
+template <typename T>
+static std::vector<T> DrawValues(const std::vector<T>& uniques) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> index_dist(0, uniques.size() - 1);
+  std::vector<T> values(kMemoTableValues);
+  std::generate(values.begin(), values.end(), [&]() { return uniques[index_dist(gen)]; });
+  return values;
+}
+
+template <template <class> class HashTableTemplateType>
+static void BenchmarkMemoTable(benchmark::State& state,  // NOLINT non-const reference
+                               const std::vector<int64_t>& values) {
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t, HashTableTemplateType> table(default_memory_pool());
+    for (const int64_t v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableInt64(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values =
+      DrawValues(MakeIntegers<int64_t>(static_cast<int32_t>(state.range(0))));
+  BenchmarkMemoTable<HashTableTemplateType>(state, values);
+}
+
+// Distinct values which only differ in their high bits
+template <template <class> class HashTableTemplateType>
+static void MemoTableStridedInt64(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<int64_t> uniques(static_cast<size_t>(state.range(0)));
+  for (size_t i = 0; i < uniques.size(); ++i) {
+    uniques[i] = static_cast<int64_t>(i) << 10;
+  }
+  BenchmarkMemoTable<HashTableTemplateType>(state, DrawValues(uniques));
+}
+
+template <template <class> class HashTableTemplateType>
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  const auto values =
+      DrawValues(MakeStrings(static_cast<int32_t>(state.range(0)), 2, 20));
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable<BinaryBuilder, HashTableTemplateType> table(default_memory_pool());
+    for (const std::string& v : values) {
+      int32_t memo_index;
+      ABORT_NOT_OK(table.GetOrInsert(v, &memo_index));
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void MemoTableArgs(benchmark::internal::Benchmark* bench) {
+  // Number of distinct values
+  bench->Arg(100)->Arg(10000)->Arg(1000000);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +186,12 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+BENCHMARK_TEMPLATE(MemoTableInt64, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableInt64, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStridedInt64, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStridedInt64, SwissHashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStrings, HashTable)->Apply(MemoTableArgs);
+BENCHMARK_TEMPLATE(MemoTableStrings, SwissHashTable)->Apply(MemoTableArgs);
+
 }  // namespace internal
 }  // namespace arrow
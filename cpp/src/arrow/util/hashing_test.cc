@@ -486,5 +486,96 @@ TEST(BinaryMemoTable, Empty) {
   EXPECT_EQ(offsets[0], 0);
 }
 
+template <typename MemoTableType, typename Value>
+void CheckMemoTableInsertAndLookup(MemoTableType* table, const std::vector<Value>& values,
+                                   const std::vector<Value>& absent_values) {
+  // Insert all values, then look them up again
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    for (size_t i = 0; i < values.size(); ++i) {
+      int32_t memo_index;
+      ASSERT_OK(table->GetOrInsert(values[i], &memo_index));
+      ASSERT_EQ(memo_index, static_cast<int32_t>(i));
+    }
+  }
+  ASSERT_EQ(table->size(), static_cast<int32_t>(values.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(table->Get(values[i]), static_cast<int32_t>(i));
+  }
+  for (const auto& value : absent_values) {
+    ASSERT_EQ(table->Get(value), kKeyNotFound);
+  }
+  AssertGetOrInsertNull(*table, static_cast<int32_t>(values.size()));
+}
+
+TEST(SwissHashTable, ScalarMemoTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 500;
+#else
+  const int32_t n_values = 100000;
+#endif
+  std::vector<std::vector<int64_t>> value_sets(3);
+  for (const auto v : MakeDistinctIntegers<int64_t>(2 * n_values)) {
+    value_sets[0].push_back(v);
+  }
+  for (int64_t i = 0; i < 2 * n_values; ++i) {
+    value_sets[1].push_back(i);
+    value_sets[2].push_back(i * 128);
+  }
+
+  for (const auto& value_set : value_sets) {
+    ScalarMemoTable<int64_t, SwissHashTable> table(default_memory_pool(), 0);
+    std::vector<int64_t> values(value_set.begin(), value_set.begin() + n_values);
+    std::vector<int64_t> absent_values(value_set.begin() + n_values, value_set.end());
+    CheckMemoTableInsertAndLookup(&table, values, absent_values);
+
+    std::vector<int64_t> copied(n_values + 1);
+    table.CopyValues(copied.data());
+    copied.pop_back();
+    ASSERT_EQ(copied, values);
+  }
+}
+
+// Exposes the tag computation of SwissHashTable
+struct SwissHashTableInternals : public SwissHashTable<int32_t> {
+  using SwissHashTable<int32_t>::Tag;
+};
+
+TEST(SwissHashTable, TagsOfStridedIntegers) {
+  // Keys differing only in their high bits must still get different tags,
+  // otherwise every control byte of a probed group matches
+  for (const int64_t stride : {1, 128, 1 << 10, 1 << 20}) {
+    SCOPED_TRACE("stride = " + std::to_string(stride));
+    std::unordered_set<uint8_t> tags;
+    for (int64_t i = 0; i < 1000; ++i) {
+      const hash_t h = ScalarHelper<int64_t>::ComputeHash(i * stride);
+      tags.insert(SwissHashTableInternals::Tag(h));
+    }
+    ASSERT_GE(tags.size(), 120);
+  }
+}
+
+TEST(SwissHashTable, BinaryMemoTable) {
+#ifdef ARROW_VALGRIND
+  const int32_t n_values = 200;
+#else
+  const int32_t n_values = 10000;
+#endif
+  const auto distinct_values = MakeDistinctStrings(2 * n_values);
+  std::vector<std::string> values(distinct_values.begin(), distinct_values.end());
+  std::vector<std::string> absent_values(values.begin() + n_values, values.end());
+  values.resize(n_values);
+
+  // Start with a presized table this time
+  BinaryMemoTable<BinaryBuilder, SwissHashTable> table(default_memory_pool(), n_values);
+  CheckMemoTableInsertAndLookup(&table, values, absent_values);
+
+  std::vector<std::string> actual;
+  table.VisitValues(0, [&](const util::string_view& v) {
+    actual.emplace_back(v.data(), v.length());
+  });
+  actual.pop_back();
+  ASSERT_EQ(actual, values);
+}
+
 }  // namespace internal
 }  // namespace arrow
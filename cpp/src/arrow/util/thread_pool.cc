@@ -18,10 +18,13 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <cstdlib>
 #include <deque>
 #include <list>
 #include <mutex>
+#include <new>
 #include <string>
 #include <thread>
 #include <vector>
@@ -279,6 +282,374 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   return pool;
 }
 
+// ----------------------------------------------------------------------
+// WorkStealingThreadPool implementation
+
+namespace {
+
+// A dynamically-sized work-stealing deque of tasks, after "Dynamic Circular
+// Work-Stealing Deque" (Chase and Lev, 2005) with the memory orderings of
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013).
+//
+// Only the owning worker may call Push() and Pop(), at the bottom end of the
+// deque.  Other threads may call Steal() concurrently, at the top end.
+class WorkStealingDeque {
+ public:
+  using Task = FnOnce<void()>;
+
+  WorkStealingDeque() : top_(0), bottom_(0) {
+    buffers_.emplace_back(new Buffer(kInitialCapacity));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  // Owner only
+  void Push(Task* task) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (b - t >= buffer->capacity()) {
+      buffer = Grow(buffer, t, b);
+    }
+    buffer->Put(b, task);
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  // Owner only: take the most recently pushed task, or null if empty
+  Task* Pop() {
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Task* task = buffer->Get(b);
+    if (t == b) {
+      // Last task: race against thieves for it
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Take the least recently pushed task.  Returns null if the deque is empty
+  // or if another thread won the race for that task.
+  Task* Steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    Task* task = buffer->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return task;
+  }
+
+  // Approximate, as the deque can be concurrently modified
+  bool Empty() const {
+    const int64_t t = top_.load(std::memory_order_acquire);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    return b <= t;
+  }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 256;
+
+  class Buffer {
+   public:
+    explicit Buffer(int64_t capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<Task*>[capacity]) {}
+
+    int64_t capacity() const { return mask_ + 1; }
+
+    Task* Get(int64_t i) const {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+
+    void Put(int64_t i, Task* task) {
+      slots_[i & mask_].store(task, std::memory_order_relaxed);
+    }
+
+   private:
+    const int64_t mask_;
+    std::unique_ptr<std::atomic<Task*>[]> slots_;
+  };
+
+  Buffer* Grow(Buffer* old_buffer, int64_t t, int64_t b) {
+    // Thieves may still be reading from the old buffer, so keep it alive
+    // until the deque is destroyed
+    buffers_.emplace_back(new Buffer(old_buffer->capacity() * 2));
+    Buffer* buffer = buffers_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      buffer->Put(i, old_buffer->Get(i));
+    }
+    buffer_.store(buffer, std::memory_order_release);
+    return buffer;
+  }
+
+  // Keep the ends modified by thieves and by the owner on separate cache lines
+  alignas(64) std::atomic<int64_t> top_;
+  alignas(64) std::atomic<int64_t> bottom_;
+  std::atomic<Buffer*> buffer_;
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace
+
+struct WorkStealingThreadPool::State {
+  using Task = FnOnce<void()>;
+
+  struct Worker {
+    WorkStealingDeque deque;
+    std::thread thread;
+
+    // Before C++17, new doesn't honour the extended alignment of the deque
+    static void* operator new(size_t size) {
+      void* ptr = nullptr;
+#ifdef _WIN32
+      ptr = _aligned_malloc(size, alignof(Worker));
+#else
+      if (posix_memalign(&ptr, alignof(Worker), size) != 0) {
+        ptr = nullptr;
+      }
+#endif
+      if (ptr == nullptr) {
+        throw std::bad_alloc();
+      }
+      return ptr;
+    }
+
+    static void operator delete(void* ptr) {
+#ifdef _WIN32
+      _aligned_free(ptr);
+#else
+      std::free(ptr);
+#endif
+    }
+  };
+
+  explicit State(int capacity)
+      : num_injected_tasks_(0),
+        num_sleeping_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false) {
+    for (int i = 0; i < capacity; ++i) {
+      workers_.emplace_back(new Worker());
+    }
+  }
+
+  // Find a task for worker `index`: first in its own deque, then in the
+  // queue of external tasks, then in the other workers' deques.
+  Task* FindTask(int index, uint64_t* rng_state) {
+    Task* task = workers_[index]->deque.Pop();
+    if (task != nullptr) {
+      return task;
+    }
+    if (num_injected_tasks_.load() > 0) {
+      std::lock_guard<std::mutex> lock(injection_mutex_);
+      if (!injected_tasks_.empty()) {
+        task = injected_tasks_.front();
+        injected_tasks_.pop_front();
+        num_injected_tasks_.fetch_sub(1);
+        return task;
+      }
+    }
+    // Start from a random victim (xorshift64), so that thieves don't all
+    // contend on the same deque
+    *rng_state ^= *rng_state << 13;
+    *rng_state ^= *rng_state >> 7;
+    *rng_state ^= *rng_state << 17;
+    const int num_workers = static_cast<int>(workers_.size());
+    const int start = static_cast<int>(*rng_state % num_workers);
+    for (int i = 0; i < num_workers; ++i) {
+      const int victim = (start + i) % num_workers;
+      if (victim != index) {
+        task = workers_[victim]->deque.Steal();
+        if (task != nullptr) {
+          return task;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  bool HasPendingTasks() const {
+    if (num_injected_tasks_.load() > 0) {
+      return true;
+    }
+    for (const auto& worker : workers_) {
+      if (!worker->deque.Empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Block an idle worker until tasks may be available.  Return false if
+  // the worker should exit.
+  bool WaitForTasks() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Announce ourselves before checking for tasks one last time: a spawner
+    // either sees us sleeping, or we see its task (see WakeUpOne())
+    num_sleeping_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!please_shutdown_.load() && !HasPendingTasks()) {
+      cv_.wait(lock);
+    }
+    num_sleeping_.fetch_sub(1);
+    if (quick_shutdown_.load()) {
+      return false;
+    }
+    return !please_shutdown_.load() || HasPendingTasks();
+  }
+
+  // Called after pushing a task
+  void WakeUpOne() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_sleeping_.load() > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cv_.notify_one();
+    }
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Tasks spawned from outside the pool's workers
+  std::mutex injection_mutex_;
+  std::deque<Task*> injected_tasks_;
+  std::atomic<int64_t> num_injected_tasks_;
+
+  // For idle workers
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<int> num_sleeping_;
+
+  // Are we shutting down?
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+};
+
+namespace {
+
+// The worker executing on the current thread, if any
+struct CurrentWorker {
+  const WorkStealingThreadPool::State* state;
+  int index;
+};
+
+thread_local CurrentWorker current_worker = {nullptr, -1};
+
+void WorkStealingWorkerLoop(std::shared_ptr<WorkStealingThreadPool::State> state,
+                            int index) {
+  current_worker.state = state.get();
+  current_worker.index = index;
+  uint64_t rng_state = 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(index + 1);
+
+  while (!state->quick_shutdown_.load()) {
+    std::unique_ptr<FnOnce<void()>> task(state->FindTask(index, &rng_state));
+    if (task != nullptr) {
+      std::move(*task)();
+    } else if (!state->WaitForTasks()) {
+      break;
+    }
+  }
+  current_worker.state = nullptr;
+  current_worker.index = -1;
+}
+
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(int threads)
+    : sp_state_(std::make_shared<State>(threads)), state_(sp_state_.get()) {}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  if (!state_->please_shutdown_.load()) {
+    ARROW_UNUSED(Shutdown(false /* wait */));
+  }
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads) {
+  if (threads <= 0) {
+    return Status::Invalid("WorkStealingThreadPool capacity must be > 0");
+  }
+  auto pool =
+      std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool(threads));
+  for (int i = 0; i < threads; ++i) {
+    pool->state_->workers_[i]->thread =
+        std::thread(WorkStealingWorkerLoop, pool->sp_state_, i);
+  }
+  return pool;
+}
+
+int WorkStealingThreadPool::GetCapacity() {
+  return static_cast<int>(state_->workers_.size());
+}
+
+Status WorkStealingThreadPool::Shutdown(bool wait) {
+  DCHECK_NE(current_worker.state, state_) << "cannot shut down a pool from its own task";
+  {
+    // Take both locks, so that no external task is pushed after this, and no
+    // idle worker misses the notification
+    std::lock_guard<std::mutex> injection_lock(state_->injection_mutex_);
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("Shutdown() already called");
+    }
+    state_->quick_shutdown_.store(!wait);
+    state_->please_shutdown_.store(true);
+    state_->cv_.notify_all();
+  }
+  for (auto& worker : state_->workers_) {
+    worker->thread.join();
+  }
+  // All workers have exited, discard the tasks left over by a quick shutdown
+  for (auto& worker : state_->workers_) {
+    while (auto task = worker->deque.Pop()) {
+      DCHECK(!wait);
+      delete task;
+    }
+  }
+  for (auto task : state_->injected_tasks_) {
+    DCHECK(!wait);
+    delete task;
+  }
+  state_->injected_tasks_.clear();
+  state_->num_injected_tasks_.store(0);
+  return Status::OK();
+}
+
+Status WorkStealingThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task) {
+  if (current_worker.state == state_) {
+    // Spawned from one of our tasks: push to the worker's own deque
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    state_->workers_[current_worker.index]->deque.Push(
+        new FnOnce<void()>(std::move(task)));
+  } else {
+    std::lock_guard<std::mutex> lock(state_->injection_mutex_);
+    if (state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    state_->injected_tasks_.push_back(new FnOnce<void()>(std::move(task)));
+    state_->num_injected_tasks_.fetch_add(1);
+  }
+  state_->WakeUpOne();
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
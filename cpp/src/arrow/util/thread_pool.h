@@ -191,6 +191,48 @@ class ARROW_EXPORT ThreadPool : public Executor {
 #endif
 };
 
+// An Executor implementation with a fixed-size pool of worker threads, each
+// owning a double-ended queue of tasks.
+//
+// Tasks spawned from a worker thread, e.g. by the tasks of a TaskGroup, are
+// pushed to the bottom of that worker's deque, and the worker executes them in
+// LIFO order.  Idle workers steal tasks from the top of other workers' deques
+// without taking any lock.  Tasks spawned from other threads go through a
+// shared FIFO queue.  This avoids the global lock of ThreadPool, which becomes a
+// bottleneck with many cores and fine-grained tasks, but tasks are not executed
+// in FIFO order.
+//
+// Unlike ThreadPool, the number of worker threads can't be changed after
+// construction, and the pool is not usable in the child of a fork().
+class ARROW_EXPORT WorkStealingThreadPool : public Executor {
+ public:
+  // Construct a thread pool with the given number of worker threads
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(int threads);
+
+  // Destroy thread pool; the pool will first be shut down
+  ~WorkStealingThreadPool() override;
+
+  // Return the number of worker threads.
+  int GetCapacity() override;
+
+  // Shutdown the pool.  Once the pool starts shutting down, new tasks
+  // cannot be submitted anymore.
+  // If "wait" is true, shutdown waits for all pending tasks to be finished.
+  // If "wait" is false, workers are stopped as soon as currently executing
+  // tasks are finished.
+  Status Shutdown(bool wait = true);
+
+  struct State;
+
+ protected:
+  explicit WorkStealingThreadPool(int threads);
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task) override;
+
+  std::shared_ptr<State> sp_state_;
+  State* state_;
+};
+
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
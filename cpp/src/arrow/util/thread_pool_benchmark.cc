@@ -73,8 +73,8 @@ struct Task {
   Workload workload_;
 };
 
-// Benchmark ThreadPool::Spawn
-static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const reference
+template <typename PoolType>
+static void SpawnBenchmark(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
@@ -85,8 +85,8 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
 
   for (auto _ : state) {
     state.PauseTiming();
-    std::shared_ptr<ThreadPool> pool;
-    pool = *ThreadPool::Make(nthreads);
+    std::shared_ptr<PoolType> pool;
+    pool = *PoolType::Make(nthreads);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -103,6 +103,17 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn
+static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const reference
+  SpawnBenchmark<ThreadPool>(state);
+}
+
+// Benchmark WorkStealingThreadPool::Spawn
+static void WorkStealingThreadPoolSpawn(
+    benchmark::State& state) {  // NOLINT non-const reference
+  SpawnBenchmark<WorkStealingThreadPool>(state);
+}
+
 // Benchmark ThreadPool::Submit
 static void ThreadPoolSubmit(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
@@ -154,13 +165,16 @@ static void SerialTaskGroup(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
-// Benchmark threaded TaskGroup
-static void ThreadedTaskGroup(benchmark::State& state) {  // NOLINT non-const reference
+// Benchmark threaded TaskGroup.  All tasks are spawned from within the pool,
+// which WorkStealingThreadPool pushes to the spawning worker's local deque.
+template <typename PoolType>
+static void ThreadedTaskGroupBenchmark(
+    benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
-  std::shared_ptr<ThreadPool> pool;
-  pool = *ThreadPool::Make(nthreads);
+  std::shared_ptr<PoolType> pool;
+  pool = *PoolType::Make(nthreads);
 
   Task task(workload_size);
 
@@ -182,6 +196,15 @@ static void ThreadedTaskGroup(benchmark::State& state) {  // NOLINT non-const re
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+static void ThreadedTaskGroup(benchmark::State& state) {  // NOLINT non-const reference
+  ThreadedTaskGroupBenchmark<ThreadPool>(state);
+}
+
+static void WorkStealingThreadedTaskGroup(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ThreadedTaskGroupBenchmark<WorkStealingThreadPool>(state);
+}
+
 static const std::vector<int32_t> kWorkloadSizes = {1000, 10000, 100000};
 
 static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
@@ -194,7 +217,7 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
 
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
-    for (const int nthreads : {1, 2, 4, 8}) {
+    for (const int nthreads : {1, 2, 4, 8, 16}) {
       b->Args({nthreads, w});
     }
   }
@@ -224,7 +247,9 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(WorkStealingThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(WorkStealingThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
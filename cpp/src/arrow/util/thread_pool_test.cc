@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
@@ -94,7 +95,7 @@ class AddTester {
 
   AddTester(AddTester&&) = default;
 
-  void SpawnTasks(ThreadPool* pool, AddTaskFunc add_func) {
+  void SpawnTasks(Executor* pool, AddTaskFunc add_func) {
     for (int i = 0; i < nadds; ++i) {
       ASSERT_OK(pool->Spawn([=] { add_func(xs[i], ys[i], &outs[i]); }));
     }
@@ -367,6 +368,112 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+// Tests for WorkStealingThreadPool
+
+class TestWorkStealingThreadPool : public ::testing::Test {
+ public:
+  std::shared_ptr<WorkStealingThreadPool> MakeThreadPool(int threads) {
+    return *WorkStealingThreadPool::Make(threads);
+  }
+
+  // Spawn a binary tree of tasks of the given depth, each task spawning its
+  // children from within the pool
+  static void SpawnTree(WorkStealingThreadPool* pool, int depth,
+                        std::atomic<int>* counter) {
+    counter->fetch_add(1);
+    if (depth > 0) {
+      for (int i = 0; i < 2; ++i) {
+        ASSERT_OK(pool->Spawn([=] { SpawnTree(pool, depth - 1, counter); }));
+      }
+    }
+  }
+};
+
+TEST_F(TestWorkStealingThreadPool, ConstructDestruct) {
+  for (int threads : {1, 2, 3, 8, 32}) {
+    auto pool = this->MakeThreadPool(threads);
+    ASSERT_EQ(pool->GetCapacity(), threads);
+  }
+  ASSERT_RAISES(Invalid, WorkStealingThreadPool::Make(0));
+}
+
+TEST_F(TestWorkStealingThreadPool, Spawn) {
+  auto pool = this->MakeThreadPool(3);
+  AddTester add_tester(1000);
+  add_tester.SpawnTasks(pool.get(), task_add<int>);
+  ASSERT_OK(pool->Shutdown());
+  add_tester.CheckResults();
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnThreaded) {
+  auto pool = this->MakeThreadPool(30);
+  std::vector<AddTester> add_testers;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 20; ++i) {
+    add_testers.emplace_back(1000);
+  }
+  for (auto& add_tester : add_testers) {
+    threads.emplace_back([&] { add_tester.SpawnTasks(pool.get(), task_add<int>); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_OK(pool->Shutdown());
+  for (auto& add_tester : add_testers) {
+    add_tester.CheckResults();
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSpawn) {
+  // Tasks spawned from workers go to their local deques and must be stolen
+  // by the other workers
+  for (int threads : {1, 4, 16}) {
+    auto pool = this->MakeThreadPool(threads);
+    std::atomic<int> counter(0);
+    ASSERT_OK(pool->Spawn([&] { SpawnTree(pool.get(), 12, &counter); }));
+    // Spawning is forbidden during shutdown, so wait for the tree to complete
+    busy_wait(5.0, [&] { return counter.load() == (1 << 13) - 1; });
+    ASSERT_OK(pool->Shutdown());
+    ASSERT_EQ(counter.load(), (1 << 13) - 1);
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    auto pool = this->MakeThreadPool(3);
+    add_tester.SpawnTasks(pool.get(), [](int x, int y, int* out) {
+      return task_slow_add(0.02 /* seconds */, x, y, out);
+    });
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST_F(TestWorkStealingThreadPool, SpawnAfterShutdown) {
+  auto pool = this->MakeThreadPool(2);
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_RAISES(Invalid, pool->Spawn([] {}));
+  ASSERT_RAISES(Invalid, pool->Shutdown());
+}
+
+TEST_F(TestWorkStealingThreadPool, Submit) {
+  auto pool = this->MakeThreadPool(3);
+  {
+    ASSERT_OK_AND_ASSIGN(Future<int> fut, pool->Submit(add<int>, 4, 5));
+    ASSERT_OK_AND_EQ(9, fut.result());
+  }
+  {
+    // Submitted from within the pool
+    ASSERT_OK_AND_ASSIGN(auto outer, pool->Submit([&]() -> int {
+      auto inner = pool->Submit(slow_add<int>, 0.01 /* seconds */, 4, 5);
+      return inner.ok() ? *(*inner).result() : -1;
+    }));
+    ASSERT_OK_AND_EQ(9, outer.result());
+  }
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -35,8 +35,8 @@ class GANDIVA_EXPORT Configuration {
  public:
   friend class ConfigurationBuilder;
 
-  Configuration() : optimize_(true) {}
-  explicit Configuration(bool optimize) : optimize_(optimize) {}
+  Configuration() : optimize_(true), use_threads_(false) {}
+  explicit Configuration(bool optimize) : optimize_(optimize), use_threads_(false) {}
 
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
@@ -45,8 +45,14 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   void set_optimize(bool optimize) { optimize_ = optimize; }
 
+  /// Whether Projector::Evaluate may split large batches into row ranges
+  /// evaluated in parallel on the CPU thread pool.
+  bool use_threads() const { return use_threads_; }
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   bool optimize_;
+  bool use_threads_;
 };
 
 /// \brief configuration builder for gandiva
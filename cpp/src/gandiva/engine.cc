@@ -24,6 +24,7 @@
 #include "gandiva/engine.h"
 
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -43,6 +44,7 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
 #include <llvm/IR/DataLayout.h>
@@ -73,6 +75,8 @@
 #include "gandiva/decimal_ir.h"
 #include "gandiva/exported_funcs_registry.h"
 
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/make_unique.h"
 
 namespace gandiva {
@@ -250,8 +254,7 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
-// Optimise and compile the module.
-Status Engine::FinalizeModule() {
+Status Engine::OptimizeModule() {
   ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
   if (optimize_) {
@@ -281,6 +284,48 @@ Status Engine::FinalizeModule() {
 
   ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
                   Status::CodeGenError("Module verification failed after optimizer"));
+  return Status::OK();
+}
+
+std::string Engine::FullObjectCacheKey() const {
+  // The precompiled functions change with the Gandiva sources, not only
+  // with the release
+  static const uint64_t bitcode_hash = arrow::internal::ComputeStringHash<0>(
+      kPrecompiledBitcode, static_cast<int64_t>(kPrecompiledBitcodeSize));
+
+  std::stringstream ss;
+  ss << "Gandiva " << ARROW_VERSION_STRING << ", bitcode " << bitcode_hash << ", LLVM "
+     << LLVM_VERSION_STRING << ", CPU " << llvm::sys::getHostCPUName().str();
+  llvm::StringMap<bool> host_features;
+  if (llvm::sys::getHostCPUFeatures(host_features)) {
+    // StringMap iteration order is unspecified
+    std::map<std::string, bool> sorted_features;
+    for (auto& f : host_features) {
+      sorted_features.emplace(f.first().str(), f.second);
+    }
+    for (auto& f : sorted_features) {
+      ss << (f.second ? " +" : " -") << f.first;
+    }
+  }
+  ss << ", optimize " << optimize_ << "\n" << object_cache_key_;
+  return ss.str();
+}
+
+// Optimise and compile the module.
+Status Engine::FinalizeModule() {
+  bool object_cached = false;
+  const std::string cache_dir = GetObjectCacheDirectory();
+  if (!object_cache_key_.empty() && !object_cache_disabled_ && !cache_dir.empty()) {
+    object_cache_.reset(new DiskObjectCache(cache_dir, FullObjectCacheKey()));
+    object_cached = object_cache_->Load();
+    // MCJIT loads the cached object code instead of compiling the module, or
+    // hands it the compiled object code to store.
+    execution_engine_->setObjectCache(object_cache_.get());
+  }
+
+  if (!object_cached) {
+    ARROW_RETURN_NOT_OK(OptimizeModule());
+  }
 
   // do the compilation
   execution_engine_->finalizeObject();
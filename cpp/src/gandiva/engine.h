@@ -28,6 +28,7 @@
 #include "gandiva/configuration.h"
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -54,7 +55,18 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Look up the object code of the module in the on-disk object cache, if
+  /// enabled, and store it there once compiled. The key must describe the
+  /// expressions the module is generated from; the engine configuration, the
+  /// host CPU and the LLVM and Gandiva versions are added to it.
+  void SetObjectCacheKey(std::string key) { object_cache_key_ = std::move(key); }
+
+  /// Never persist the module, because its code embeds addresses of objects
+  /// of this process (e.g. function holders).
+  void DisableObjectCache() { object_cache_disabled_ = true; }
+
+  /// Optimise and compile the module, or load its object code from the
+  /// on-disk object cache.
   Status FinalizeModule();
 
   /// Get the compiled function corresponding to the irfunction.
@@ -89,6 +101,12 @@ class GANDIVA_EXPORT Engine {
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Optimise and verify the module before it is compiled.
+  Status OptimizeModule();
+
+  // The complete key of the module in the on-disk object cache.
+  std::string FullObjectCacheKey() const;
+
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -97,6 +115,10 @@ class GANDIVA_EXPORT Engine {
 
   std::vector<std::string> functions_to_compile_;
 
+  std::string object_cache_key_;
+  bool object_cache_disabled_ = false;
+  std::unique_ptr<DiskObjectCache> object_cache_;
+
   bool optimize_ = true;
   bool module_finalized_ = false;
 };
@@ -27,6 +27,10 @@ namespace gandiva {
 class GANDIVA_EXPORT FunctionHolder {
  public:
   virtual ~FunctionHolder() = default;
+
+  /// \brief Whether invoking the function mutates the holder, so that it can't
+  /// be invoked from several threads at once.
+  virtual bool is_stateful() const { return false; }
 };
 
 using FunctionHolderPtr = std::shared_ptr<FunctionHolder>;
@@ -29,6 +29,7 @@
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
 #include "gandiva/expression.h"
+#include "gandiva/function_holder.h"
 #include "gandiva/lvalue.h"
 
 namespace gandiva {
@@ -38,7 +39,8 @@ namespace gandiva {
     AddTrace(__VA_ARGS__); \
   }
 
-LLVMGenerator::LLVMGenerator() : enable_ir_traces_(false) {}
+LLVMGenerator::LLVMGenerator()
+    : has_stateful_holders_(false), enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
@@ -677,8 +679,9 @@ void LLVMGenerator::Visitor::Visit(const LiteralDex& dex) {
     case arrow::Type::BINARY: {
       const std::string& str = arrow::util::get<std::string>(dex.holder());
 
-      llvm::Constant* str_int_cast = types->i64_constant((int64_t)str.c_str());
-      value = llvm::ConstantExpr::getIntToPtr(str_int_cast, types->i8_ptr_type());
+      // A global constant, rather than the address of the string, so that the
+      // object code can be reused by other processes.
+      value = ir_builder()->CreateGlobalStringPtr(str);
       len = types->i32_constant(static_cast<int32_t>(str.length()));
       break;
     }
@@ -1017,6 +1020,7 @@ void LLVMGenerator::Visitor::VisitInExpression(const InExprDexBase<Type>& dex) {
 
   const InExprDex<Type>& dex_instance = dynamic_cast<const InExprDex<Type>&>(dex);
   /* add the holder at the beginning */
+  generator_->engine_->DisableObjectCache();
   llvm::Constant* ptr_int_cast =
       types->i64_constant((int64_t)(dex_instance.in_holder().get()));
   params.push_back(ptr_int_cast);
@@ -1184,6 +1188,10 @@ std::vector<llvm::Value*> LLVMGenerator::Visitor::BuildParams(
 
   // if the function has holder, add the holder pointer.
   if (holder != nullptr) {
+    generator_->engine_->DisableObjectCache();
+    if (holder->is_stateful()) {
+      generator_->has_stateful_holders_ = true;
+    }
     auto ptr = types->i64_constant((int64_t)holder);
     params.push_back(ptr);
   }
@@ -1329,6 +1337,7 @@ void LLVMGenerator::AddTrace(const std::string& msg, llvm::Value* value) {
   trace_strings_.push_back(dmsg);
 
   // cast this to an llvm pointer.
+  engine_->DisableObjectCache();
   const char* str = trace_strings_.back().c_str();
   llvm::Constant* str_int_cast = types()->i64_constant((int64_t)str);
   llvm::Constant* str_ptr_cast =
@@ -49,6 +49,10 @@ class GANDIVA_EXPORT LLVMGenerator {
   static Status Make(std::shared_ptr<Configuration> config,
                      std::unique_ptr<LLVMGenerator>* llvm_generator);
 
+  /// \brief Look up and store the compiled module in the on-disk object cache,
+  /// if enabled, under the given key. Must be called before Build().
+  void SetObjectCacheKey(std::string key) { engine_->SetObjectCacheKey(std::move(key)); }
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
@@ -71,6 +75,10 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const ArrayDataVector& output_vector);
 
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
+
+  /// \brief Whether the built code invokes a stateful function holder, and so
+  /// must not be executed concurrently.
+  bool has_stateful_holders() const { return has_stateful_holders_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
   std::string DumpIR() { return engine_->DumpIR(); }
@@ -241,6 +249,7 @@ class GANDIVA_EXPORT LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  bool has_stateful_holders_;
 
   // used for debug
   bool enable_ir_traces_;
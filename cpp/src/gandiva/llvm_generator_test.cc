@@ -22,12 +22,15 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "arrow/util/io_util.h"
 #include "gandiva/configuration.h"
 #include "gandiva/dex.h"
 #include "gandiva/expression.h"
 #include "gandiva/func_descriptor.h"
 #include "gandiva/function_registry.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
 
 namespace gandiva {
 
@@ -113,4 +116,82 @@ TEST_F(TestLLVMGenerator, TestAdd) {
   EXPECT_EQ(out_bitmap, 0ULL);
 }
 
+TEST_F(TestLLVMGenerator, ObjectCache) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       arrow::internal::TemporaryDir::Make("gandiva-object-cache-"));
+  ASSERT_OK(arrow::internal::SetEnvVar("GANDIVA_OBJECT_CACHE_DIR",
+                                       temp_dir->path().ToString()));
+
+  auto field0 = arrow::field("f0", arrow::int32());
+  auto field1 = arrow::field("f1", arrow::int32());
+  auto field2 = arrow::field("f2", arrow::utf8());
+  auto schema = arrow::schema({field0, field1, field2});
+  auto sum = TreeExprBuilder::MakeExpression("add", {field0, field1},
+                                             arrow::field("sum", arrow::int32()));
+  // String literals are module constants, so they don't prevent caching
+  auto is_foo = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("equal",
+                                    {TreeExprBuilder::MakeField(field2),
+                                     TreeExprBuilder::MakeStringLiteral("foo")},
+                                    arrow::boolean()),
+      arrow::field("is_foo", arrow::boolean()));
+
+  const int64_t num_records = 4;
+  auto batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, false, true}),
+       MakeArrowArrayInt32({5, 6, 7, 8}, {true, true, true, true}),
+       MakeArrowArrayUtf8({"foo", "bar", "foo", ""}, {true, true, true, false})});
+
+  for (int i = 0; i < 2; ++i) {
+    auto stats_before = GetObjectCacheStats();
+    std::unique_ptr<LLVMGenerator> generator;
+    ASSERT_OK(LLVMGenerator::Make(TestConfiguration(), &generator));
+    generator->SetObjectCacheKey("TestLLVMGenerator.ObjectCache");
+    ASSERT_OK(generator->Build({sum, is_foo}));
+    auto stats_after = GetObjectCacheStats();
+    // Compiled the first time, loaded from the cache directory the second
+    ASSERT_EQ(i == 0 ? 1 : 0, stats_after.misses - stats_before.misses);
+    ASSERT_EQ(i == 0 ? 0 : 1, stats_after.hits - stats_before.hits);
+
+    ArrayDataVector outputs;
+    for (const auto& type : {arrow::int32(), arrow::boolean()}) {
+      ASSERT_OK_AND_ASSIGN(auto validity, arrow::AllocateEmptyBitmap(num_records));
+      std::shared_ptr<arrow::Buffer> values;
+      if (type->id() == arrow::Type::BOOL) {
+        ASSERT_OK_AND_ASSIGN(values, arrow::AllocateEmptyBitmap(num_records));
+      } else {
+        ASSERT_OK_AND_ASSIGN(values, arrow::AllocateBuffer(num_records * 4));
+      }
+      outputs.push_back(arrow::ArrayData::Make(type, num_records, {validity, values}));
+    }
+    ASSERT_OK(generator->Execute(*batch, outputs));
+
+    EXPECT_ARROW_ARRAY_EQUALS(
+        MakeArrowArrayInt32({6, 8, 0, 12}, {true, true, false, true}),
+        arrow::MakeArray(outputs[0]));
+    EXPECT_ARROW_ARRAY_EQUALS(
+        MakeArrowArrayBool({true, false, true, false}, {true, true, true, false}),
+        arrow::MakeArray(outputs[1]));
+  }
+
+  // Modules embedding addresses of this process are never persisted
+  auto stats_before = GetObjectCacheStats();
+  auto is_like = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("like",
+                                    {TreeExprBuilder::MakeField(field2),
+                                     TreeExprBuilder::MakeStringLiteral("f%")},
+                                    arrow::boolean()),
+      arrow::field("is_like", arrow::boolean()));
+  std::unique_ptr<LLVMGenerator> generator;
+  ASSERT_OK(LLVMGenerator::Make(TestConfiguration(), &generator));
+  generator->SetObjectCacheKey("TestLLVMGenerator.ObjectCache like");
+  ASSERT_OK(generator->Build({is_like}));
+  auto stats_after = GetObjectCacheStats();
+  ASSERT_EQ(stats_before.misses, stats_after.misses);
+  ASSERT_EQ(stats_before.hits, stats_after.hits);
+
+  ASSERT_OK(arrow::internal::DelEnvVar("GANDIVA_OBJECT_CACHE_DIR"));
+}
+
 }  // namespace gandiva
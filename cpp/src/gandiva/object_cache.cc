@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace gandiva {
+
+using arrow::internal::PlatformFilename;
+
+namespace {
+
+std::atomic<int64_t> g_object_cache_hits(0);
+std::atomic<int64_t> g_object_cache_misses(0);
+
+// A cache file holds the length of the key, the key and the object code.
+using KeyLengthType = uint64_t;
+
+arrow::Result<std::string> CacheFilePath(const std::string& directory,
+                                         const std::string& key) {
+  std::stringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16)
+     << arrow::internal::ComputeStringHash<0>(key.data(),
+                                              static_cast<int64_t>(key.size()))
+     << ".o";
+  ARROW_ASSIGN_OR_RAISE(auto dir, PlatformFilename::FromString(directory));
+  ARROW_ASSIGN_OR_RAISE(auto path, dir.Join(ss.str()));
+  return path.ToString();
+}
+
+// Return null if the file holds the object code of another key.
+arrow::Result<std::shared_ptr<arrow::Buffer>> ReadCacheFile(const std::string& path,
+                                                            const std::string& key) {
+  ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::ReadableFile::Open(path));
+  ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+  ARROW_ASSIGN_OR_RAISE(auto contents, file->Read(size));
+  RETURN_NOT_OK(file->Close());
+
+  const auto header_size = static_cast<int64_t>(sizeof(KeyLengthType) + key.size());
+  if (contents->size() < header_size) {
+    return nullptr;
+  }
+  KeyLengthType key_length;
+  std::memcpy(&key_length, contents->data(), sizeof(KeyLengthType));
+  if (arrow::BitUtil::FromLittleEndian(key_length) != key.size() ||
+      std::memcmp(contents->data() + sizeof(KeyLengthType), key.data(), key.size()) !=
+          0) {
+    return nullptr;
+  }
+  return arrow::SliceBuffer(contents, header_size);
+}
+
+// Write to a temporary file which is then renamed, so that concurrent
+// processes never read a partially written file.
+arrow::Status WriteCacheFile(const std::string& path, const std::string& key,
+                             llvm::MemoryBufferRef object) {
+  std::random_device rd;
+  const std::string temp_path = path + ".tmp" + std::to_string(rd());
+  {
+    ARROW_ASSIGN_OR_RAISE(auto file, arrow::io::FileOutputStream::Open(temp_path));
+    const KeyLengthType key_length = arrow::BitUtil::ToLittleEndian(
+        static_cast<KeyLengthType>(key.size()));
+    RETURN_NOT_OK(file->Write(&key_length, sizeof(key_length)));
+    RETURN_NOT_OK(file->Write(key.data(), static_cast<int64_t>(key.size())));
+    RETURN_NOT_OK(file->Write(object.getBufferStart(),
+                              static_cast<int64_t>(object.getBufferSize())));
+    RETURN_NOT_OK(file->Close());
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    ARROW_ASSIGN_OR_RAISE(auto temp_file, PlatformFilename::FromString(temp_path));
+    ARROW_UNUSED(arrow::internal::DeleteFile(temp_file));
+    return arrow::Status::IOError("Could not rename '", temp_path, "' to '", path, "'");
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace
+
+ObjectCacheStats GetObjectCacheStats() {
+  ObjectCacheStats stats;
+  stats.hits = g_object_cache_hits.load();
+  stats.misses = g_object_cache_misses.load();
+  return stats;
+}
+
+std::string GetObjectCacheDirectory() {
+  const char* env_cache_dir = std::getenv("GANDIVA_OBJECT_CACHE_DIR");
+  return env_cache_dir != nullptr ? env_cache_dir : "";
+}
+
+DiskObjectCache::DiskObjectCache(const std::string& directory, std::string key)
+    : key_(std::move(key)) {
+  auto maybe_path = CacheFilePath(directory, key_);
+  if (maybe_path.ok()) {
+    path_ = std::move(maybe_path).ValueOrDie();
+  } else {
+    ARROW_LOG(WARNING) << "Invalid gandiva object cache directory '" << directory
+                       << "': " << maybe_path.status().ToString();
+  }
+}
+
+bool DiskObjectCache::Load() {
+  if (path_.empty()) {
+    return false;
+  }
+  auto maybe_object = ReadCacheFile(path_, key_);
+  if (maybe_object.ok() && *maybe_object != nullptr) {
+    object_ = std::move(maybe_object).ValueOrDie();
+    ++g_object_cache_hits;
+    return true;
+  }
+  ++g_object_cache_misses;
+  return false;
+}
+
+void DiskObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                           llvm::MemoryBufferRef object) {
+  if (path_.empty()) {
+    return;
+  }
+  // The cache is best effort: failing to fill it must not fail the build
+  auto status = WriteCacheFile(path_, key_, object);
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Could not write gandiva object cache file: "
+                       << status.ToString();
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> DiskObjectCache::getObject(
+    const llvm::Module* module) {
+  if (object_ == nullptr) {
+    return nullptr;
+  }
+  return llvm::MemoryBuffer::getMemBufferCopy(
+      llvm::StringRef(reinterpret_cast<const char*>(object_->data()),
+                      static_cast<size_t>(object_->size())));
+}
+
+}  // namespace gandiva
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/buffer.h"
+
+#include "gandiva/llvm_includes.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Counters of the on-disk object code cache, for this process.
+struct ObjectCacheStats {
+  /// Number of modules whose object code was loaded from the cache directory.
+  int64_t hits = 0;
+  /// Number of cacheable modules which had to be compiled.
+  int64_t misses = 0;
+};
+
+GANDIVA_EXPORT
+ObjectCacheStats GetObjectCacheStats();
+
+/// \brief Return the directory of the on-disk object code cache, set by the
+/// GANDIVA_OBJECT_CACHE_DIR environment variable. Empty if the cache is disabled.
+GANDIVA_EXPORT
+std::string GetObjectCacheDirectory();
+
+/// \brief An llvm::ObjectCache keeping the object code of one module in a file.
+///
+/// The file is named after a hash of the key, which must describe everything
+/// the machine code depends on. The whole key is stored in the file and
+/// compared when loading, so that hash collisions only cause cache misses.
+class GANDIVA_EXPORT DiskObjectCache : public llvm::ObjectCache {
+ public:
+  DiskObjectCache(const std::string& directory, std::string key);
+
+  /// Load the object code of the module from the cache directory, and return
+  /// whether it was found. Updates the hit and miss counters.
+  bool Load();
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  std::string path_;
+  std::string key_;
+  std::shared_ptr<arrow::Buffer> object_;
+};
+
+}  // namespace gandiva
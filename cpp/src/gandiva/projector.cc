@@ -17,17 +17,21 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/selection_vector_impl.h"
 
 namespace gandiva {
 
@@ -174,6 +178,8 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
   }
 
+  llvm_gen->SetObjectCacheKey(cache_key.ToString() + " Mode: " +
+                              std::to_string(static_cast<int>(selection_vector_mode)));
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
 
   // save the output field types. Used for validation at Evaluate() time.
@@ -223,7 +229,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -250,8 +256,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  ARROW_RETURN_NOT_OK(Execute(batch, selection_vector, output_data_vecs));
 
   // Create and return array arrays.
   output->clear();
@@ -261,6 +266,99 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+// A view of the slots [offset, offset + length) of a selection vector
+template <typename C_TYPE, typename SelectionVectorType>
+static std::shared_ptr<SelectionVector> SliceSelectionVector(
+    const SelectionVector& selection_vector, int64_t offset, int64_t length) {
+  auto buffer = std::make_shared<arrow::Buffer>(
+      selection_vector.GetBuffer().data() + offset * sizeof(C_TYPE),
+      length * sizeof(C_TYPE));
+  return std::make_shared<SelectionVectorType>(length, length, std::move(buffer));
+}
+
+// The number of output rows below which a batch isn't split. Ranges are also
+// multiples of 64 rows, so that no word of an output bitmap is written by two
+// tasks.
+static constexpr int64_t kMinRowsPerTask = int64_t(1) << 16;
+
+Status Projector::Execute(const arrow::RecordBatch& batch,
+                          const SelectionVector* selection_vector,
+                          const ArrayDataVector& output_data_vecs) {
+  const int64_t num_rows =
+      selection_vector == nullptr ? batch.num_rows() : selection_vector->GetNumSlots();
+  int64_t num_tasks = 1;
+  if (configuration_->use_threads()) {
+    num_tasks = std::min<int64_t>(arrow::internal::GetCpuThreadPool()->GetCapacity(),
+                                  num_rows / kMinRowsPerTask);
+  }
+  // Stateful holders (e.g. random) are shared by all the tasks
+  if (llvm_generator_->has_stateful_holders()) {
+    num_tasks = 1;
+  }
+  // Varlen outputs are appended to a single resizable buffer
+  for (const auto& field : output_fields_) {
+    if (arrow::is_binary_like(field->type()->id())) {
+      num_tasks = 1;
+    }
+  }
+  if (num_tasks <= 1) {
+    return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  }
+
+  const int64_t rows_per_task =
+      arrow::BitUtil::RoundUpToMultipleOf64(arrow::BitUtil::CeilDiv(num_rows, num_tasks));
+  num_tasks = arrow::BitUtil::CeilDiv(num_rows, rows_per_task);
+  return arrow::internal::ParallelFor(static_cast<int>(num_tasks), [&](int i) {
+    const int64_t offset = i * rows_per_task;
+    return ExecuteRange(batch, selection_vector, output_data_vecs, offset,
+                        std::min(rows_per_task, num_rows - offset));
+  });
+}
+
+Status Projector::ExecuteRange(const arrow::RecordBatch& batch,
+                               const SelectionVector* selection_vector,
+                               const ArrayDataVector& output_data_vecs, int64_t offset,
+                               int64_t length) {
+  // The outputs of the range start on a byte boundary, as offset is a multiple
+  // of 64: slice their buffers rather than setting an offset, which the
+  // generated code ignores for outputs.
+  ArrayDataVector range_outputs;
+  for (const auto& array_data : output_data_vecs) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data->type);
+    const auto& validity = array_data->buffers[0];
+    const auto& data = array_data->buffers[1];
+    const int64_t validity_offset = offset / 8;
+    const int64_t data_offset = offset * fw_type.bit_width() / 8;
+    range_outputs.push_back(arrow::ArrayData::Make(
+        array_data->type, length,
+        {arrow::SliceMutableBuffer(validity, validity_offset,
+                                   validity->capacity() - validity_offset),
+         arrow::SliceMutableBuffer(data, data_offset, data->capacity() - data_offset)}));
+  }
+
+  if (selection_vector == nullptr) {
+    return llvm_generator_->Execute(*batch.Slice(offset, length), range_outputs);
+  }
+
+  // Select the slots of the range, from the whole batch
+  std::shared_ptr<SelectionVector> range_selection;
+  switch (selection_vector->GetMode()) {
+    case SelectionVector::MODE_UINT16:
+      range_selection = SliceSelectionVector<uint16_t, SelectionVectorInt16>(
+          *selection_vector, offset, length);
+      break;
+    case SelectionVector::MODE_UINT32:
+      range_selection = SliceSelectionVector<uint32_t, SelectionVectorInt32>(
+          *selection_vector, offset, length);
+      break;
+    default:
+      range_selection = SliceSelectionVector<uint64_t, SelectionVectorInt64>(
+          *selection_vector, offset, length);
+      break;
+  }
+  return llvm_generator_->Execute(batch, range_selection.get(), range_outputs);
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
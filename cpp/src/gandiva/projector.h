@@ -38,6 +38,11 @@ class LLVMGenerator;
 ///
 /// A projector is built for a specific schema and vector of expressions.
 /// Once the projector is built, it can be used to evaluate many row batches.
+///
+/// If the configuration sets use_threads, large batches are evaluated in
+/// parallel on the CPU thread pool, each task computing a range of the output
+/// rows. Projections with string or binary outputs are always evaluated on
+/// the calling thread.
 class GANDIVA_EXPORT Projector {
  public:
   // Inline dtor will attempt to resolve the destructor for
@@ -134,6 +139,19 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
+  /// Run the compiled expressions, on row ranges in parallel if the configuration
+  /// allows it.
+  Status Execute(const arrow::RecordBatch& batch,
+                 const SelectionVector* selection_vector,
+                 const ArrayDataVector& output_data_vecs);
+
+  /// Run the compiled expressions on the rows (or selection vector slots)
+  /// [offset, offset + length), writing into the same range of the outputs.
+  Status ExecuteRange(const arrow::RecordBatch& batch,
+                      const SelectionVector* selection_vector,
+                      const ArrayDataVector& output_data_vecs, int64_t offset,
+                      int64_t length);
+
   std::unique_ptr<LLVMGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
@@ -39,6 +39,8 @@ class GANDIVA_EXPORT RandomGeneratorHolder : public FunctionHolder {
 
   double operator()() { return distribution_(generator_); }
 
+  bool is_stateful() const override { return true; }
+
  private:
   explicit RandomGeneratorHolder(int seed) : distribution_(0, 1) {
     int64_t seed64 = static_cast<int64_t>(seed);
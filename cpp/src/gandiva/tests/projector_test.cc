@@ -22,6 +22,7 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "arrow/testing/random.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
 #include "gandiva/tests/test_util.h"
@@ -862,4 +863,92 @@ TEST_F(TestProjector, TestToDate) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestProjectUseThreads) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // A boolean output checks that the tasks don't overlap in output bitmaps
+  auto sum_expr =
+      TreeExprBuilder::MakeExpression("add", {field0, field1}, field("add", int32()));
+  auto greater_expr = TreeExprBuilder::MakeExpression("greater_than", {field0, field1},
+                                                      field("greater", boolean()));
+
+  // Several tasks, with a last range which isn't a multiple of 64 rows
+  const int64_t num_records = 8 * 65536 + 100;
+  arrow::random::RandomArrayGenerator rand(0x5EED);
+  auto batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {rand.Int32(num_records, -1000, 1000, /*null_probability=*/0.1),
+       rand.Int32(num_records, -1000, 1000, /*null_probability=*/0.1)});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt32(num_records, pool_, &selection_vector));
+  int64_t num_slots = 0;
+  for (int64_t i = 0; i < num_records; i += 2) {
+    selection_vector->SetIndex(num_slots++, i);
+  }
+  selection_vector->SetNumSlots(num_slots);
+  // Enough selected slots for the selection to be split as well
+  ASSERT_GE(num_slots, 4 * 65536);
+
+  for (auto mode : {SelectionVector::MODE_NONE, SelectionVector::MODE_UINT32}) {
+    auto serial_config = ConfigurationBuilder().build();
+    auto threaded_config = ConfigurationBuilder().build();
+    threaded_config->set_use_threads(true);
+
+    std::shared_ptr<Projector> serial_projector;
+    ASSERT_OK(Projector::Make(schema, {sum_expr, greater_expr}, mode, serial_config,
+                              &serial_projector));
+    std::shared_ptr<Projector> threaded_projector;
+    ASSERT_OK(Projector::Make(schema, {sum_expr, greater_expr}, mode, threaded_config,
+                              &threaded_projector));
+    EXPECT_NE(serial_projector, threaded_projector);
+
+    const SelectionVector* selection =
+        mode == SelectionVector::MODE_NONE ? nullptr : selection_vector.get();
+    arrow::ArrayVector expected;
+    ASSERT_OK(serial_projector->Evaluate(*batch, selection, pool_, &expected));
+    arrow::ArrayVector actual;
+    ASSERT_OK(threaded_projector->Evaluate(*batch, selection, pool_, &actual));
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_OK(actual[i]->ValidateFull());
+      EXPECT_ARROW_ARRAY_EQUALS(expected[i], actual[i]);
+    }
+  }
+}
+
+TEST_F(TestProjector, TestProjectUseThreadsStatefulHolder) {
+  auto field0 = field("f0", int32());
+  auto schema = arrow::schema({field0});
+
+  // The generator of a seeded random is shared by the whole projector, so its
+  // output only matches a serial projection if the batch isn't split
+  auto seed = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(12));
+  auto rand_node = TreeExprBuilder::MakeFunction("random", {seed}, arrow::float64());
+  auto rand_expr =
+      TreeExprBuilder::MakeExpression(rand_node, field("rand", arrow::float64()));
+
+  const int64_t num_records = 4 * 65536;
+  arrow::random::RandomArrayGenerator rand(0x5EED);
+  auto batch = arrow::RecordBatch::Make(schema, num_records,
+                                        {rand.Int32(num_records, -1000, 1000)});
+
+  auto serial_config = ConfigurationBuilder().build();
+  auto threaded_config = ConfigurationBuilder().build();
+  threaded_config->set_use_threads(true);
+
+  std::shared_ptr<Projector> serial_projector;
+  ASSERT_OK(Projector::Make(schema, {rand_expr}, serial_config, &serial_projector));
+  std::shared_ptr<Projector> threaded_projector;
+  ASSERT_OK(Projector::Make(schema, {rand_expr}, threaded_config, &threaded_projector));
+
+  arrow::ArrayVector expected;
+  ASSERT_OK(serial_projector->Evaluate(*batch, pool_, &expected));
+  arrow::ArrayVector actual;
+  ASSERT_OK(threaded_projector->Evaluate(*batch, pool_, &actual));
+  EXPECT_ARROW_ARRAY_EQUALS(expected.at(0), actual.at(0));
+}
+
 }  // namespace gandiva
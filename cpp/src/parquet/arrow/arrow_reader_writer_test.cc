@@ -2251,6 +2251,45 @@ TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ASSERT_EQ(actual_batch->num_rows(), num_rows);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderRowRanges) {
+  const int num_columns = 2;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Pages of 100 rows, with page indexes
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->data_pagesize(1)
+                         ->disable_dictionary()
+                         ->enable_write_page_index()
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.Build(&reader));
+
+  // The ranges are widened to whole pages
+  std::unique_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(
+      reader->GetRecordBatchReader(0, {0, 1}, {{150, 160}, {700, 705}}, &rb_reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(rb_reader->ReadAll(&actual));
+  ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::ConcatenateTables(
+                                          {table->Slice(100, 100), table->Slice(700, 100)}));
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(0, {1}, {}, &rb_reader));
+  ASSERT_OK(rb_reader->ReadAll(&actual));
+  ASSERT_EQ(actual->num_rows(), 0);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
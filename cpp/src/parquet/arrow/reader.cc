@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -195,12 +196,12 @@ class FileReaderImpl : public FileReader {
 
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
-                        const std::vector<int>& row_groups,
+                        FileColumnIteratorFactory iterator_factory,
                         std::unique_ptr<ColumnReaderImpl>* out) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = std::move(iterator_factory);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     return GetReader(manifest_.schema_fields[i], ctx, out);
@@ -210,6 +211,14 @@ class FileReaderImpl : public FileReader {
                          const std::vector<int>& row_groups,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
                          std::shared_ptr<::arrow::Schema>* out_schema) {
+    return GetFieldReaders(column_indices, SomeRowGroupsFactory(row_groups), out,
+                           out_schema);
+  }
+
+  Status GetFieldReaders(const std::vector<int>& column_indices,
+                         const FileColumnIteratorFactory& iterator_factory,
+                         std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
+                         std::shared_ptr<::arrow::Schema>* out_schema) {
     // We only need to read schema fields which have columns indicated
     // in the indices vector
     ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
@@ -222,7 +231,7 @@ class FileReaderImpl : public FileReader {
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
       RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+          GetFieldReader(field_indices[i], included_leaves, iterator_factory, &reader));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -249,7 +258,8 @@ class FileReaderImpl : public FileReader {
     std::vector<int> row_groups = Iota(reader_->metadata()->num_row_groups());
 
     std::unique_ptr<ColumnReaderImpl> reader;
-    RETURN_NOT_OK(GetFieldReader(i, included_leaves, row_groups, &reader));
+    RETURN_NOT_OK(
+        GetFieldReader(i, included_leaves, SomeRowGroupsFactory(row_groups), &reader));
 
     return ReadColumn(i, row_groups, reader.get(), out);
   }
@@ -312,6 +322,16 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Status GetRecordBatchReader(int row_group_index, const std::vector<int>& column_indices,
+                              const RowRanges& row_ranges,
+                              std::unique_ptr<RecordBatchReader>* out) override;
+
+  // Make a RecordBatchReader yielding num_rows rows from the given readers
+  Status MakeRecordBatchReader(std::vector<std::shared_ptr<ColumnReaderImpl>> readers,
+                               std::shared_ptr<::arrow::Schema> batch_schema,
+                               int64_t num_rows,
+                               std::unique_ptr<RecordBatchReader>* out);
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -925,6 +945,82 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
     num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
   }
 
+  return MakeRecordBatchReader(std::move(readers), std::move(batch_schema), num_rows,
+                               out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(int row_group,
+                                            const std::vector<int>& column_indices,
+                                            const RowRanges& row_ranges,
+                                            std::unique_ptr<RecordBatchReader>* out) {
+  RETURN_NOT_OK(BoundsCheck({row_group}, column_indices));
+
+  std::vector<std::shared_ptr<OffsetIndex>> offset_indexes;
+  int64_t row_group_rows = 0;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto row_group_reader = reader_->RowGroup(row_group);
+  row_group_rows = row_group_reader->metadata()->num_rows();
+  for (int i : column_indices) {
+    // Pages of repeated columns may not start at row boundaries
+    if (reader_->metadata()->schema()->Column(i)->max_repetition_level() > 0) break;
+    auto offset_index = row_group_reader->GetOffsetIndex(i);
+    if (offset_index == nullptr) break;
+    offset_indexes.push_back(std::move(offset_index));
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (column_indices.empty() || offset_indexes.size() != column_indices.size()) {
+    return GetRecordBatchReader({row_group}, column_indices, out);
+  }
+
+  std::vector<const OffsetIndex*> offset_index_ptrs;
+  for (const auto& offset_index : offset_indexes) {
+    offset_index_ptrs.push_back(offset_index.get());
+  }
+  RowRanges aligned_ranges =
+      AlignRowRangesToPages(row_ranges, offset_index_ptrs, row_group_rows);
+
+  int64_t num_rows = 0;
+  for (const RowRange& range : aligned_ranges) {
+    num_rows += range.length();
+  }
+
+  // One filter per leaf column, skipping the pages outside of aligned_ranges
+  auto page_filters = std::make_shared<std::unordered_map<int, DataPageFilter>>();
+  for (size_t i = 0; i < column_indices.size(); ++i) {
+    auto selected = std::make_shared<std::vector<bool>>(
+        SelectPages(aligned_ranges, *offset_indexes[i], row_group_rows));
+    (*page_filters)[column_indices[i]] = [selected](int32_t page) {
+      return page < static_cast<int32_t>(selected->size()) && !(*selected)[page];
+    };
+  }
+  FileColumnIteratorFactory iterator_factory = [row_group, page_filters](
+                                                   int i, ParquetFileReader* reader) {
+    auto it = page_filters->find(i);
+    return new FileColumnIterator(i, reader, {row_group},
+                                  it != page_filters->end() ? it->second : nullptr);
+  };
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer({row_group}, column_indices, reader_properties_.async_context(),
+                       reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> batch_schema;
+  RETURN_NOT_OK(
+      GetFieldReaders(column_indices, iterator_factory, &readers, &batch_schema));
+
+  return MakeRecordBatchReader(std::move(readers), std::move(batch_schema), num_rows,
+                               out);
+}
+
+Status FileReaderImpl::MakeRecordBatchReader(
+    std::vector<std::shared_ptr<ColumnReaderImpl>> readers,
+    std::shared_ptr<::arrow::Schema> batch_schema, int64_t num_rows,
+    std::unique_ptr<RecordBatchReader>* out) {
   using ::arrow::RecordBatchIterator;
 
   // NB: This lambda will be invoked outside the scope of this call to
@@ -179,6 +179,22 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a RecordBatchReader over the given rows of a row group,
+  /// whose columns are selected by column_indices.
+  ///
+  /// Only the data pages overlapping row_ranges are read, as located by the
+  /// OffsetIndex of each column chunk. Since pages of different columns don't
+  /// line up, the ranges are first widened to page boundaries common to all
+  /// selected columns (see AlignRowRangesToPages), so the batches may hold
+  /// more rows than requested. If any selected column has no OffsetIndex or
+  /// is repeated, the whole row group is read.
+  ///
+  /// \returns error Status if row_group_index or column_indices contains an
+  ///     invalid index
+  virtual ::arrow::Status GetRecordBatchReader(
+      int row_group_index, const std::vector<int>& column_indices,
+      const RowRanges& row_ranges, std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -62,11 +62,13 @@ class ColumnReaderImpl;
 class FileColumnIterator {
  public:
   explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+                              std::vector<int> row_groups,
+                              DataPageFilter data_page_filter = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        data_page_filter_(std::move(data_page_filter)) {}
 
   virtual ~FileColumnIterator() {}
 
@@ -77,7 +79,11 @@ class FileColumnIterator {
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
-    return row_group_reader->GetColumnPageReader(column_index_);
+    auto page_reader = row_group_reader->GetColumnPageReader(column_index_);
+    if (data_page_filter_) {
+      page_reader->set_data_page_filter(data_page_filter_);
+    }
+    return page_reader;
   }
 
   const SchemaDescriptor* schema() const { return schema_; }
@@ -93,6 +99,8 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  // Applied to the pages of every row group
+  DataPageFilter data_page_filter_;
 };
 
 using FileColumnIteratorFactory =
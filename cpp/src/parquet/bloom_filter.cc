@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
@@ -22,15 +23,41 @@
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
+#include "parquet/thrift_internal.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 constexpr uint32_t BlockSplitBloomFilter::SALT[kBitsSetPerBlock];
 
+namespace {
+
+// Number of bytes read ahead of a Bloom filter in a file in the hope that they
+// hold the whole BloomFilterHeader, which is usually much smaller.
+constexpr int64_t kBloomFilterHeaderSizeGuess = 256;
+
+}  // namespace
+
 BlockSplitBloomFilter::BlockSplitBloomFilter()
+    : BlockSplitBloomFilter(HashStrategy::MURMUR3_X64_128) {}
+
+BlockSplitBloomFilter::BlockSplitBloomFilter(HashStrategy hash_strategy)
     : pool_(::arrow::default_memory_pool()),
-      hash_strategy_(HashStrategy::MURMUR3_X64_128),
+      hash_strategy_(hash_strategy),
       algorithm_(Algorithm::BLOCK) {}
 
+void BlockSplitBloomFilter::InitHasher() {
+  switch (hash_strategy_) {
+    case HashStrategy::MURMUR3_X64_128:
+      hasher_.reset(new MurmurHash3());
+      break;
+    case HashStrategy::XXHASH:
+      hasher_.reset(new XxHasher());
+      break;
+    default:
+      throw ParquetException("Unsupported hash strategy");
+  }
+}
+
 void BlockSplitBloomFilter::Init(uint32_t num_bytes) {
   if (num_bytes < kMinimumBloomFilterBytes) {
     num_bytes = kMinimumBloomFilterBytes;
@@ -49,7 +76,7 @@ void BlockSplitBloomFilter::Init(uint32_t num_bytes) {
   PARQUET_ASSIGN_OR_THROW(data_, ::arrow::AllocateBuffer(num_bytes_, pool_));
   memset(data_->mutable_data(), 0, num_bytes_);
 
-  this->hasher_.reset(new MurmurHash3());
+  InitHasher();
 }
 
 void BlockSplitBloomFilter::Init(const uint8_t* bitset, uint32_t num_bytes) {
@@ -64,7 +91,7 @@ void BlockSplitBloomFilter::Init(const uint8_t* bitset, uint32_t num_bytes) {
   PARQUET_ASSIGN_OR_THROW(data_, ::arrow::AllocateBuffer(num_bytes_, pool_));
   memcpy(data_->mutable_data(), bitset, num_bytes_);
 
-  this->hasher_.reset(new MurmurHash3());
+  InitHasher();
 }
 
 BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input) {
@@ -111,6 +138,65 @@ void BlockSplitBloomFilter::WriteTo(ArrowOutputStream* sink) const {
   PARQUET_THROW_NOT_OK(sink->Write(data_->mutable_data(), num_bytes_));
 }
 
+void BlockSplitBloomFilter::WriteWithHeader(ArrowOutputStream* sink) const {
+  DCHECK(sink != nullptr);
+  if (hash_strategy_ != HashStrategy::XXHASH) {
+    throw ParquetException("Only xxHash Bloom filters can be written to Parquet files");
+  }
+
+  format::BloomFilterHeader header;
+  header.__set_numBytes(static_cast<int32_t>(num_bytes_));
+  header.algorithm.__set_BLOCK(format::SplitBlockAlgorithm());
+  header.hash.__set_XXHASH(format::XxHash());
+  header.compression.__set_UNCOMPRESSED(format::Uncompressed());
+
+  ThriftSerializer serializer;
+  serializer.Serialize(&header, sink);
+  PARQUET_THROW_NOT_OK(sink->Write(data_->data(), num_bytes_));
+}
+
+std::unique_ptr<BlockSplitBloomFilter> BlockSplitBloomFilter::ReadWithHeader(
+    ArrowInputFile* input, int64_t offset) {
+  PARQUET_ASSIGN_OR_THROW(int64_t file_size, input->GetSize());
+  if (offset < 0 || offset >= file_size) {
+    throw ParquetException("Bloom filter offset ", offset, " out of bounds of file of ",
+                           file_size, " bytes");
+  }
+  const int64_t prefix_size = std::min(kBloomFilterHeaderSizeGuess, file_size - offset);
+  PARQUET_ASSIGN_OR_THROW(auto prefix, input->ReadAt(offset, prefix_size));
+
+  format::BloomFilterHeader header;
+  uint32_t header_size = static_cast<uint32_t>(prefix->size());
+  DeserializeThriftMsg(prefix->data(), &header_size, &header);
+  if (!header.algorithm.__isset.BLOCK) {
+    throw ParquetException("Unsupported Bloom filter algorithm");
+  }
+  if (!header.hash.__isset.XXHASH) {
+    throw ParquetException("Unsupported hash strategy");
+  }
+  if (!header.compression.__isset.UNCOMPRESSED) {
+    throw ParquetException("Unsupported Bloom filter compression");
+  }
+  const int64_t num_bytes = header.numBytes;
+  if (num_bytes < 0 || offset + header_size + num_bytes > file_size) {
+    throw ParquetException("Bloom filter bitset of ", num_bytes,
+                           " bytes out of bounds of file of ", file_size, " bytes");
+  }
+
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter(
+      new BlockSplitBloomFilter(HashStrategy::XXHASH));
+  if (header_size + num_bytes <= prefix->size()) {
+    bloom_filter->Init(prefix->data() + header_size, static_cast<uint32_t>(num_bytes));
+  } else {
+    PARQUET_ASSIGN_OR_THROW(auto bitset, input->ReadAt(offset + header_size, num_bytes));
+    if (bitset->size() != num_bytes) {
+      throw ParquetException("Failed to read Bloom filter bitset");
+    }
+    bloom_filter->Init(bitset->data(), static_cast<uint32_t>(num_bytes));
+  }
+  return bloom_filter;
+}
+
 void BlockSplitBloomFilter::SetMask(uint32_t key, BlockMask& block_mask) const {
   for (int i = 0; i < kBitsSetPerBlock; ++i) {
     block_mask.item[i] = key * SALT[i];
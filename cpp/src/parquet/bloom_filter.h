@@ -33,6 +33,12 @@ namespace parquet {
 // set of elements, a hash strategy and a Bloom filter algorithm.
 class PARQUET_EXPORT BloomFilter {
  public:
+  // Hash strategy available for Bloom filter.
+  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0, XXHASH = 1 };
+
+  // Bloom filter algorithm.
+  enum class Algorithm : uint32_t { BLOCK = 0 };
+
   // Maximum Bloom filter size, it sets to HDFS default block size 128MB
   // This value will be reconsidered when implementing Bloom filter producer.
   static constexpr uint32_t kMaximumBloomFilterBytes = 128 * 1024 * 1024;
@@ -101,13 +107,6 @@ class PARQUET_EXPORT BloomFilter {
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
   virtual ~BloomFilter() {}
-
- protected:
-  // Hash strategy available for Bloom filter.
-  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0 };
-
-  // Bloom filter algorithm.
-  enum class Algorithm : uint32_t { BLOCK = 0 };
 };
 
 // The BlockSplitBloomFilter is implemented using block-based Bloom filters from
@@ -121,6 +120,10 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// The constructor of BlockSplitBloomFilter. It uses murmur3_x64_128 as hash function.
   BlockSplitBloomFilter();
 
+  /// The constructor of BlockSplitBloomFilter using the given hash function.
+  /// Bloom filters written to Parquet files must use HashStrategy::XXHASH.
+  explicit BlockSplitBloomFilter(HashStrategy hash_strategy);
+
   /// Initialize the BlockSplitBloomFilter. The range of num_bytes should be within
   /// [kMinimumBloomFilterBytes, kMaximumBloomFilterBytes], it will be
   /// rounded up/down to lower/upper bound if num_bytes is out of range and also
@@ -183,6 +186,7 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   void InsertHash(uint64_t hash) override;
   void WriteTo(ArrowOutputStream* sink) const override;
   uint32_t GetBitsetSize() const override { return num_bytes_; }
+  HashStrategy hash_strategy() const { return hash_strategy_; }
 
   uint64_t Hash(int64_t value) const override { return hasher_->Hash(value); }
   uint64_t Hash(float value) const override { return hasher_->Hash(value); }
@@ -201,6 +205,22 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @return The BlockSplitBloomFilter.
   static BlockSplitBloomFilter Deserialize(ArrowInputStream* input_stream);
 
+  /// Write this Bloom filter as laid out in a Parquet file by the format
+  /// specification: a thrift BloomFilterHeader followed by the bitset. Only
+  /// filters using HashStrategy::XXHASH can be written this way.
+  ///
+  /// @param sink the output stream to write
+  void WriteWithHeader(ArrowOutputStream* sink) const;
+
+  /// Read a Bloom filter written by WriteWithHeader, e.g. from the
+  /// bloom_filter_offset of a column chunk.
+  ///
+  /// @param input The file holding the Bloom filter
+  /// @param offset The position of the BloomFilterHeader in the file
+  /// @return The BlockSplitBloomFilter.
+  static std::unique_ptr<BlockSplitBloomFilter> ReadWithHeader(ArrowInputFile* input,
+                                                               int64_t offset);
+
  private:
   // Bytes in a tiny Bloom filter block.
   static constexpr int kBytesPerFilterBlock = 32;
@@ -224,6 +244,9 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @param mask the mask array is used to set inside a block
   void SetMask(uint32_t key, BlockMask& mask) const;
 
+  /// Create the hasher of hash_strategy_.
+  void InitHasher();
+
   // Memory pool to allocate aligned buffer for bitset
   ::arrow::MemoryPool* pool_;
 
@@ -26,15 +26,21 @@
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 
 #include "parquet/bloom_filter.h"
+#include "parquet/column_writer.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/murmur3.h"
 #include "parquet/platform.h"
+#include "parquet/schema.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 namespace test {
@@ -48,6 +54,15 @@ TEST(Murmur3Test, TestBloomFilter) {
   EXPECT_EQ(result, UINT64_C(913737700387071329));
 }
 
+TEST(XxHasherTest, TestBloomFilter) {
+  const std::string hello = "hello";
+  ByteArray byte_array(static_cast<uint32_t>(hello.size()),
+                       reinterpret_cast<const uint8_t*>(hello.data()));
+  XxHasher hasher;
+  EXPECT_EQ(hasher.Hash(&byte_array), UINT64_C(2794345569481354659));
+  EXPECT_EQ(hasher.Hash(static_cast<int32_t>(42)), UINT64_C(15516826743637085169));
+}
+
 TEST(ConstructorTest, TestBloomFilter) {
   BlockSplitBloomFilter bloom_filter;
   EXPECT_NO_THROW(bloom_filter.Init(1000));
@@ -203,6 +218,128 @@ TEST(CompatibilityTest, TestBloomFilter) {
   EXPECT_TRUE((*buffer1).Equals(*buffer2));
 }
 
+TEST(WriteWithHeaderTest, TestBloomFilter) {
+  BlockSplitBloomFilter bloom_filter(BloomFilter::HashStrategy::XXHASH);
+  bloom_filter.Init(1024);
+  for (int64_t i = 0; i < 100; i++) {
+    bloom_filter.InsertHash(bloom_filter.Hash(i));
+  }
+
+  // Place the filter after some unrelated bytes, as in a Parquet file
+  auto sink = CreateOutputStream();
+  const std::string padding = "PAR1";
+  PARQUET_THROW_NOT_OK(sink->Write(padding.data(), padding.size()));
+  bloom_filter.WriteWithHeader(sink.get());
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  ::arrow::io::BufferReader source(buffer);
+  auto de_bloom = BlockSplitBloomFilter::ReadWithHeader(&source, padding.size());
+  EXPECT_EQ(de_bloom->hash_strategy(), BloomFilter::HashStrategy::XXHASH);
+  EXPECT_EQ(de_bloom->GetBitsetSize(), bloom_filter.GetBitsetSize());
+  for (int64_t i = 0; i < 100; i++) {
+    EXPECT_TRUE(de_bloom->FindHash(de_bloom->Hash(i)));
+  }
+
+  // Truncated bitset
+  ::arrow::io::BufferReader truncated(SliceBuffer(buffer, 0, buffer->size() - 1));
+  EXPECT_THROW(BlockSplitBloomFilter::ReadWithHeader(&truncated, padding.size()),
+               ParquetException);
+
+  // Only xxHash filters can be written in the Parquet format
+  BlockSplitBloomFilter murmur3_bloom_filter;
+  murmur3_bloom_filter.Init(1024);
+  EXPECT_THROW(murmur3_bloom_filter.WriteWithHeader(sink.get()), ParquetException);
+}
+
+// Write Bloom filters for some of the columns of a file and read them back,
+// through both the serialized and the buffered row group writers
+TEST(ColumnChunkBloomFilterTest, TestBloomFilter) {
+  constexpr int kNumValues = 1000;
+  auto schema = std::static_pointer_cast<schema::GroupNode>(schema::GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {schema::PrimitiveNode::Make("x", Repetition::REQUIRED, Type::INT64),
+       schema::PrimitiveNode::Make("s", Repetition::OPTIONAL, Type::BYTE_ARRAY),
+       schema::PrimitiveNode::Make("y", Repetition::REQUIRED, Type::INT64)}));
+
+  BloomFilterOptions bloom_filter_options;
+  bloom_filter_options.ndv = kNumValues;
+  bloom_filter_options.fpp = 0.01;
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("x", bloom_filter_options)
+                        ->enable_bloom_filter("s", bloom_filter_options)
+                        ->build();
+
+  // Even values only, every other string being null
+  std::vector<int64_t> values(kNumValues);
+  std::vector<std::string> strings;
+  std::vector<ByteArray> byte_arrays;
+  std::vector<int16_t> def_levels(kNumValues);
+  for (int i = 0; i < kNumValues; ++i) {
+    values[i] = 2 * i;
+    def_levels[i] = i % 2;
+    if (i % 2) strings.push_back("s" + std::to_string(i));
+  }
+  for (const auto& string : strings) {
+    byte_arrays.emplace_back(static_cast<uint32_t>(string.size()),
+                             reinterpret_cast<const uint8_t*>(string.data()));
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  for (bool buffered : {false, true}) {
+    auto row_group_writer =
+        buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+    for (int i = 0; i < 3; ++i) {
+      auto column_writer = buffered ? row_group_writer->column(i)
+                                    : row_group_writer->NextColumn();
+      if (i == 1) {
+        static_cast<ByteArrayWriter*>(column_writer)
+            ->WriteBatch(kNumValues, def_levels.data(), nullptr, byte_arrays.data());
+      } else {
+        static_cast<Int64Writer*>(column_writer)
+            ->WriteBatch(kNumValues, nullptr, nullptr, values.data());
+      }
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  ASSERT_EQ(file_reader->metadata()->num_row_groups(), 2);
+  for (int r = 0; r < 2; ++r) {
+    auto row_group = file_reader->RowGroup(r);
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_bloom_filter());
+    ASSERT_EQ(row_group->GetBloomFilter(2), nullptr);
+
+    auto x_filter = row_group->GetBloomFilter(0);
+    ASSERT_NE(x_filter, nullptr);
+    int false_positives = 0;
+    for (int i = 0; i < kNumValues; ++i) {
+      EXPECT_TRUE(x_filter->FindHash(x_filter->Hash(values[i])));
+      if (x_filter->FindHash(x_filter->Hash(values[i] + 1))) ++false_positives;
+    }
+    EXPECT_LT(false_positives, kNumValues / 20);
+
+    auto s_filter = row_group->GetBloomFilter(1);
+    ASSERT_NE(s_filter, nullptr);
+    for (const auto& byte_array : byte_arrays) {
+      EXPECT_TRUE(s_filter->FindHash(s_filter->Hash(&byte_array)));
+    }
+
+    // The column chunks are still readable
+    auto x_reader = std::static_pointer_cast<Int64Reader>(row_group->Column(0));
+    std::vector<int64_t> read_values(kNumValues);
+    int64_t values_read = 0;
+    x_reader->ReadBatch(kNumValues, nullptr, nullptr, read_values.data(), &values_read);
+    ASSERT_EQ(values_read, kNumValues);
+    ASSERT_EQ(read_values, values);
+  }
+}
+
 // OptimalValueTest is used to test whether OptimalNumOfBits returns expected
 // numbers according to formula:
 //     num_of_bits = -8.0 * ndv / log(1 - pow(fpp, 1.0 / 8.0))
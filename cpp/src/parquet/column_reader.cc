@@ -361,6 +361,23 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       throw ParquetException("Invalid page header");
     }
 
+    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+
+    if (data_page_filter_ &&
+        (page_type == PageType::DATA_PAGE || page_type == PageType::DATA_PAGE_V2) &&
+        data_page_filter_(page_ordinal_)) {
+      const int32_t num_values = page_type == PageType::DATA_PAGE
+                                     ? current_page_header_.data_page_header.num_values
+                                     : current_page_header_.data_page_header_v2.num_values;
+      if (num_values < 0) {
+        throw ParquetException("Invalid page header (negative number of values)");
+      }
+      PARQUET_THROW_NOT_OK(stream_->Advance(compressed_len));
+      ++page_ordinal_;
+      seen_num_rows_ += num_values;
+      continue;
+    }
+
     if (crypto_ctx_.data_decryptor != nullptr) {
       UpdateDecryption(crypto_ctx_.data_decryptor, encryption::kDictionaryPage,
                        data_page_aad_);
@@ -385,8 +402,6 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       page_buffer = decryption_buffer_;
     }
 
-    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
-
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
       const format::DictionaryPageHeader& dict_header =
@@ -762,8 +777,11 @@ class ColumnReaderImplBase {
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
         }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -771,11 +789,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -96,6 +97,9 @@ struct CryptoContext {
   std::shared_ptr<Decryptor> data_decryptor;
 };
 
+/// \brief Predicate over the ordinal of a data page within its column chunk
+using DataPageFilter = std::function<bool(int32_t data_page_ordinal)>;
+
 // Abstract page iterator interface. This way, we can feed column pages to the
 // ColumnReader through whatever mechanism we choose
 class PARQUET_EXPORT PageReader {
@@ -112,6 +116,19 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  /// \brief Skip the data pages for which `filter` returns true
+  ///
+  /// The filter is passed the ordinal of each data page within the column
+  /// chunk (dictionary pages are not counted). Skipped pages are neither
+  /// decrypted nor decompressed; consumers of the remaining pages must
+  /// account for the skipped rows themselves.
+  void set_data_page_filter(DataPageFilter filter) {
+    data_page_filter_ = std::move(filter);
+  }
+
+ protected:
+  DataPageFilter data_page_filter_;
 };
 
 class PARQUET_EXPORT ColumnReader {
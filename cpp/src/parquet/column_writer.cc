@@ -32,6 +32,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -39,6 +40,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/visitor_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
@@ -156,6 +158,70 @@ inline const T* AddIfNotNull(const T* base, int64_t offset) {
   return nullptr;
 }
 
+// Bloom filter hash of a value of the physical type of a column
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         int32_t value) {
+  return bloom_filter.Hash(value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         int64_t value) {
+  return bloom_filter.Hash(value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         float value) {
+  return bloom_filter.Hash(value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         double value) {
+  return bloom_filter.Hash(value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         const Int96& value) {
+  return bloom_filter.Hash(&value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor*,
+                         const ByteArray& value) {
+  return bloom_filter.Hash(&value);
+}
+
+uint64_t BloomFilterHash(const BloomFilter& bloom_filter, const ColumnDescriptor* descr,
+                         const FLBA& value) {
+  return bloom_filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
+// Bloom filters are not written for BOOLEAN columns
+uint64_t BloomFilterHash(const BloomFilter&, const ColumnDescriptor*, bool) {
+  DCHECK(false) << "Bloom filters are not supported for BOOLEAN columns";
+  return 0;
+}
+
+template <typename ArrayType>
+void InsertBinaryValues(const ArrayType& values, BloomFilter* bloom_filter) {
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsNull(i)) continue;
+    const auto view = values.GetView(i);
+    const ByteArray value(static_cast<uint32_t>(view.size()),
+                          reinterpret_cast<const uint8_t*>(view.data()));
+    bloom_filter->InsertHash(bloom_filter->Hash(&value));
+  }
+}
+
+// Insert the non-null values of a (large) binary or string array into a Bloom filter
+void InsertBinaryValues(const ::arrow::Array& values, BloomFilter* bloom_filter) {
+  if (::arrow::is_binary_like(values.type_id())) {
+    InsertBinaryValues(checked_cast<const ::arrow::BinaryArray&>(values), bloom_filter);
+  } else {
+    InsertBinaryValues(checked_cast<const ::arrow::LargeBinaryArray&>(values),
+                       bloom_filter);
+  }
+}
+
 }  // namespace
 
 LevelEncoder::LevelEncoder() {}
@@ -244,7 +310,8 @@ class SerializedPageWriter : public PageWriter {
                        int16_t row_group_ordinal, int16_t column_chunk_ordinal,
                        MemoryPool* pool = ::arrow::default_memory_pool(),
                        std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                       std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                       std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                       bool write_page_index = false)
       : sink_(std::move(sink)),
         metadata_(metadata),
         pool_(pool),
@@ -258,7 +325,8 @@ class SerializedPageWriter : public PageWriter {
         column_ordinal_(column_chunk_ordinal),
         meta_encryptor_(std::move(meta_encryptor)),
         data_encryptor_(std::move(data_encryptor)),
-        encryption_buffer_(AllocateBuffer(pool, 0)) {
+        encryption_buffer_(AllocateBuffer(pool, 0)),
+        write_page_index_(write_page_index) {
     if (data_encryptor_ != nullptr || meta_encryptor_ != nullptr) {
       InitEncryption();
     }
@@ -328,12 +396,20 @@ class SerializedPageWriter : public PageWriter {
       UpdateEncryption(encryption::kColumnMetaData);
     }
     // index_page_offset = -1 since they are not supported
+    // The Bloom filter is written before the metadata so that the latter
+    // records its location
+    WriteBloomFilter(sink_.get(), /*base_offset=*/0);
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
                       fallback, dict_encoding_stats_, data_encoding_stats_,
                       meta_encryptor_);
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
+    WritePageIndex(sink_.get(), /*base_offset=*/0);
+  }
+
+  void SetBloomFilter(const BlockSplitBloomFilter* bloom_filter) override {
+    bloom_filter_ = bloom_filter;
   }
 
   /**
@@ -399,6 +475,10 @@ class SerializedPageWriter : public PageWriter {
         thrift_serializer_->Serialize(&page_header, sink_.get(), meta_encryptor_);
     PARQUET_THROW_NOT_OK(sink_->Write(output_data_buffer, output_data_len));
 
+    if (write_page_index_) {
+      AddPageToIndex(page, start_pos, static_cast<int32_t>(header_size + output_data_len));
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += output_data_len + header_size;
     num_values_ += page.num_values();
@@ -453,10 +533,79 @@ class SerializedPageWriter : public PageWriter {
 
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
 
+  // Write the ColumnIndex and OffsetIndex of the pages written so far, if
+  // enabled. `base_offset` is the position in the file of the start of `sink`.
+  void WritePageIndex(ArrowOutputStream* sink, int64_t base_offset) {
+    if (!write_page_index_ || offset_index_.page_locations.empty()) {
+      return;
+    }
+    if (column_index_valid_) {
+      column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+      if (column_index_has_null_counts_) {
+        column_index_.__isset.null_counts = true;
+      } else {
+        column_index_.__isset.null_counts = false;
+        column_index_.null_counts.clear();
+      }
+      PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+      int64_t length = thrift_serializer_->Serialize(&column_index_, sink);
+      metadata_->SetColumnIndexLocation(base_offset + position,
+                                        static_cast<int32_t>(length));
+    }
+    for (auto& location : offset_index_.page_locations) {
+      location.offset += base_offset;
+    }
+    PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+    int64_t length = thrift_serializer_->Serialize(&offset_index_, sink);
+    metadata_->SetOffsetIndexLocation(base_offset + position,
+                                      static_cast<int32_t>(length));
+  }
+
+  // Write the Bloom filter, if any. `base_offset` is the position in the file
+  // of the start of `sink`.
+  void WriteBloomFilter(ArrowOutputStream* sink, int64_t base_offset) {
+    // Encryption of Bloom filters is not supported
+    if (bloom_filter_ == nullptr || meta_encryptor_ != nullptr ||
+        data_encryptor_ != nullptr) {
+      return;
+    }
+    PARQUET_ASSIGN_OR_THROW(int64_t position, sink->Tell());
+    bloom_filter_->WriteWithHeader(sink);
+    metadata_->SetBloomFilterOffset(base_offset + position);
+  }
+
  private:
   // To allow UpdateEncryption on Close
   friend class BufferedPageWriter;
 
+  void AddPageToIndex(const DataPage& page, int64_t offset, int32_t size) {
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(size);
+    // Page indexes are only written for flat columns, for which a value is a row
+    location.__set_first_row_index(num_values_);
+    offset_index_.page_locations.push_back(location);
+
+    const EncodedStatistics& stats = page.statistics();
+    if (stats.has_min && stats.has_max) {
+      column_index_.null_pages.push_back(false);
+      column_index_.min_values.push_back(stats.min());
+      column_index_.max_values.push_back(stats.max());
+    } else if (stats.has_null_count && stats.null_count == page.num_values()) {
+      column_index_.null_pages.push_back(true);
+      column_index_.min_values.emplace_back();
+      column_index_.max_values.emplace_back();
+    } else {
+      // Statistics are disabled, or were dropped for exceeding the size limit
+      column_index_valid_ = false;
+    }
+    if (stats.has_null_count) {
+      column_index_.null_counts.push_back(stats.null_count);
+    } else {
+      column_index_has_null_counts_ = false;
+    }
+  }
+
   void InitEncryption() {
     // Prepare the AAD for quick update later.
     if (data_encryptor_ != nullptr) {
@@ -533,6 +682,14 @@ class SerializedPageWriter : public PageWriter {
 
   std::map<Encoding::type, int32_t> dict_encoding_stats_;
   std::map<Encoding::type, int32_t> data_encoding_stats_;
+
+  bool write_page_index_;
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+  bool column_index_valid_ = true;
+  bool column_index_has_null_counts_ = true;
+
+  const BlockSplitBloomFilter* bloom_filter_ = nullptr;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -543,13 +700,14 @@ class BufferedPageWriter : public PageWriter {
                      int16_t row_group_ordinal, int16_t current_column_ordinal,
                      MemoryPool* pool = ::arrow::default_memory_pool(),
                      std::shared_ptr<Encryptor> meta_encryptor = nullptr,
-                     std::shared_ptr<Encryptor> data_encryptor = nullptr)
+                     std::shared_ptr<Encryptor> data_encryptor = nullptr,
+                     bool write_page_index = false)
       : final_sink_(std::move(sink)), metadata_(metadata), has_dictionary_pages_(false) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(
-        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
-                                 row_group_ordinal, current_column_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
+        in_memory_sink_, codec, compression_level, metadata, row_group_ordinal,
+        current_column_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), write_page_index));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -566,6 +724,7 @@ class BufferedPageWriter : public PageWriter {
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
         has_dictionary_pages_ ? pager_->dictionary_page_offset() + final_position : 0;
+    pager_->WriteBloomFilter(in_memory_sink_.get(), final_position);
     metadata_->Finish(pager_->num_values(), dictionary_page_offset, -1,
                       pager_->data_page_offset() + final_position,
                       pager_->total_compressed_size(), pager_->total_uncompressed_size(),
@@ -574,6 +733,7 @@ class BufferedPageWriter : public PageWriter {
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
+    pager_->WritePageIndex(in_memory_sink_.get(), final_position);
 
     // flush everything to the serialized sink
     PARQUET_ASSIGN_OR_THROW(auto buffer, in_memory_sink_->Finish());
@@ -584,6 +744,10 @@ class BufferedPageWriter : public PageWriter {
     return pager_->WriteDataPage(page);
   }
 
+  void SetBloomFilter(const BlockSplitBloomFilter* bloom_filter) override {
+    pager_->SetBloomFilter(bloom_filter);
+  }
+
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
     pager_->Compress(src_buffer, dest_buffer);
   }
@@ -603,17 +767,17 @@ std::unique_ptr<PageWriter> PageWriter::Open(
     int compression_level, ColumnChunkMetaDataBuilder* metadata,
     int16_t row_group_ordinal, int16_t column_chunk_ordinal, MemoryPool* pool,
     bool buffered_row_group, std::shared_ptr<Encryptor> meta_encryptor,
-    std::shared_ptr<Encryptor> data_encryptor) {
+    std::shared_ptr<Encryptor> data_encryptor, bool write_page_index) {
   if (buffered_row_group) {
-    return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(std::move(sink), codec, compression_level, metadata,
-                               row_group_ordinal, column_chunk_ordinal, pool,
-                               std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), write_page_index));
   } else {
-    return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(std::move(sink), codec, compression_level, metadata,
-                                 row_group_ordinal, column_chunk_ordinal, pool,
-                                 std::move(meta_encryptor), std::move(data_encryptor)));
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        std::move(sink), codec, compression_level, metadata, row_group_ordinal,
+        column_chunk_ordinal, pool, std::move(meta_encryptor),
+        std::move(data_encryptor), write_page_index));
   }
 }
 
@@ -937,13 +1101,14 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor()));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(),
+        page_stats));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
                     def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
-                    pager_->has_compressor());
+                    pager_->has_compressor(), page_stats);
     WriteDataPage(page);
   }
 }
@@ -1041,6 +1206,22 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN) {
+      const BloomFilterOptions& options =
+          properties->bloom_filter_options(descr_->path());
+      if (options.ndv <= 0 || !(options.fpp > 0.0 && options.fpp < 1.0)) {
+        throw ParquetException("Invalid Bloom filter options for column ",
+                               descr_->path()->ToDotString(), ": ndv=", options.ndv,
+                               ", fpp=", options.fpp);
+      }
+      bloom_filter_.reset(new BlockSplitBloomFilter(BloomFilter::HashStrategy::XXHASH));
+      bloom_filter_->Init(BlockSplitBloomFilter::OptimalNumOfBits(
+                              static_cast<uint32_t>(options.ndv), options.fpp) /
+                          8);
+      pager_->SetBloomFilter(bloom_filter_.get());
+    }
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -1208,6 +1389,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
 
+  // Holds the hashes of all non-null values written, if enabled
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter_;
+
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
   // subsequent array chunks to see either if materialization is required (in
@@ -1387,6 +1571,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(values, num_values);
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1404,6 +1591,23 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (num_values != num_spaced_values) {
+        ::arrow::internal::VisitSetBitRunsVoid(
+            valid_bits, valid_bits_offset, num_spaced_values,
+            [&](int64_t position, int64_t length) {
+              UpdateBloomFilter(values + position, length);
+            });
+      } else {
+        UpdateBloomFilter(values, num_values);
+      }
+    }
+  }
+
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    for (int64_t i = 0; i < num_values; ++i) {
+      bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, descr_, values[i]));
+    }
   }
 };
 
@@ -1435,13 +1639,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || bloom_filter_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
     // without a problem. Any dense data will be hashed to indices until the
     // dictionary page limit is reached, at which everything (dictionary and
-    // dense) will fall back to plain encoding
+    // dense) will fall back to plain encoding. The Bloom filter, if any, is
+    // also fed from dense data only.
     return WriteDense();
   }
 
@@ -1899,6 +2104,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      InsertBinaryValues(*data_slice, bloom_filter_.get());
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -42,6 +42,7 @@ class RleEncoder;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BlockSplitBloomFilter;
 class ColumnDescriptor;
 class DataPage;
 class DictionaryPage;
@@ -90,13 +91,17 @@ class PARQUET_EXPORT PageWriter {
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       bool buffered_row_group = false,
       std::shared_ptr<Encryptor> header_encryptor = NULLPTR,
-      std::shared_ptr<Encryptor> data_encryptor = NULLPTR);
+      std::shared_ptr<Encryptor> data_encryptor = NULLPTR, bool write_page_index = false);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
   // page limit
   virtual void Close(bool has_dictionary, bool fallback) = 0;
 
+  // Set the Bloom filter to write along with the column chunk on Close. It must
+  // outlive the PageWriter. Bloom filters of encrypted columns are not written.
+  virtual void SetBloomFilter(const BlockSplitBloomFilter*) {}
+
   virtual int64_t WriteDataPage(const DataPage& page) = 0;
 
   virtual int64_t WriteDictionaryPage(const DictionaryPage& page) = 0;
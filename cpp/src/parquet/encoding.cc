@@ -924,6 +924,372 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+/// Values are written in blocks of kValuesPerBlock deltas, each block being split
+/// in kMiniBlocksPerBlock miniblocks with their own bit width.  This is the
+/// layout used by parquet-mr.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  static constexpr uint32_t kValuesPerBlock = 128;
+  static constexpr uint32_t kMiniBlocksPerBlock = 4;
+  static constexpr uint32_t kValuesPerMiniBlock = kValuesPerBlock / kMiniBlocksPerBlock;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kMaxHeaderLength + sink_.length() +
+           static_cast<int64_t>(values_current_block_) * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* buffer, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  // Block size, number of miniblocks, total number of values and first value
+  static constexpr int kMaxHeaderLength =
+      2 * ::arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      2 * ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+
+  void FlushBlock();
+
+  int64_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  // The deltas of the current block, computed with wrap-around arithmetic
+  T deltas_[kValuesPerBlock];
+  uint32_t values_current_block_ = 0;
+  // The encoded blocks
+  ::arrow::BufferBuilder sink_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+
+  while (idx < num_values) {
+    const T value = src[idx];
+    deltas_[values_current_block_] =
+        static_cast<T>(static_cast<UT>(value) - static_cast<UT>(current_value_));
+    current_value_ = value;
+    ++idx;
+    if (++values_current_block_ == kValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) {
+    return;
+  }
+  const T min_delta = *std::min_element(deltas_, deltas_ + values_current_block_);
+
+  // Deltas relative to the minimum are stored as unsigned integers of at most
+  // 8 * sizeof(T) bits.  Slots past the last value pad the last miniblock.
+  UT packed[kValuesPerBlock] = {};
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      ::arrow::BitUtil::CeilDiv(values_current_block_, kValuesPerMiniBlock));
+  uint8_t bit_widths[kMiniBlocksPerBlock] = {};
+  int64_t packed_length = 0;
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    const uint32_t start = i * kValuesPerMiniBlock;
+    const uint32_t end = std::min(start + kValuesPerMiniBlock, values_current_block_);
+    UT max_delta = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      packed[j] = static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta);
+      max_delta = std::max(max_delta, packed[j]);
+    }
+    bit_widths[i] = static_cast<uint8_t>(::arrow::BitUtil::NumRequiredBits(max_delta));
+    packed_length += bit_widths[i] * kValuesPerMiniBlock / 8;
+  }
+
+  const int64_t max_block_length =
+      ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kMiniBlocksPerBlock +
+      packed_length;
+  PARQUET_THROW_NOT_OK(sink_.Reserve(max_block_length));
+  ::arrow::BitUtil::BitWriter writer(sink_.mutable_data() + sink_.length(),
+                                     static_cast<int>(max_block_length));
+
+  writer.PutZigZagVlqInt(static_cast<int64_t>(min_delta));
+  // The bit widths of unused miniblocks are left to zero
+  for (uint32_t i = 0; i < kMiniBlocksPerBlock; ++i) {
+    writer.PutAligned<uint8_t>(bit_widths[i], 1);
+  }
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    const int bit_width = bit_widths[i];
+    const uint32_t start = i * kValuesPerMiniBlock;
+    for (uint32_t j = start; j < start + kValuesPerMiniBlock; ++j) {
+      const uint64_t value = static_cast<uint64_t>(packed[j]);
+      if (bit_width <= 32) {
+        writer.PutValue(value, bit_width);
+      } else {
+        // BitWriter is limited to 32 bits per value: values are laid out from
+        // the least significant bit, so the low half goes first
+        writer.PutValue(value & 0xFFFFFFFFULL, 32);
+        writer.PutValue(value >> 32, bit_width - 32);
+      }
+    }
+  }
+  writer.Flush();
+  DCHECK_LE(writer.bytes_written(), max_block_length);
+  sink_.UnsafeAdvance(writer.bytes_written());
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderLength];
+  ::arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderLength);
+  header_writer.PutVlqInt(kValuesPerBlock);
+  header_writer.PutVlqInt(kMiniBlocksPerBlock);
+  header_writer.PutVlqInt(static_cast<uint64_t>(total_value_count_));
+  header_writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_));
+  header_writer.Flush();
+  const int header_length = header_writer.bytes_written();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_length + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_length);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_length, sink_.data(), sink_.length());
+  }
+
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  using ArrowType = typename EncodingTraits<DType>::ArrowType;
+  using ArrayType = typename ::arrow::TypeTraits<ArrowType>::ArrayType;
+  if (values.type_id() != ArrowType::type_id) {
+    throw ParquetException("direct put to ", ArrowType::type_name(), " from ",
+                           values.type()->ToString(), " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (values.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()),
+              data.null_bitmap_data(), data.offset());
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  if (valid_bits != NULLPTR) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                                 this->memory_pool()));
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    int num_valid_values = ::arrow::util::internal::SpacedCompress<T>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  } else {
+    Put(src, num_values);
+  }
+}
+
+// Calls `put_value` with each non-null value of a binary-like Arrow array
+template <typename PutValue>
+void VisitBinaryValues(const ::arrow::Array& values, PutValue&& put_value) {
+  AssertBaseBinary(values);
+  auto visit_value = [&](::arrow::util::string_view view) {
+    if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+      return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+    }
+    put_value(ByteArray(view));
+    return Status::OK();
+  };
+  auto visit_null = []() { return Status::OK(); };
+  if (::arrow::is_binary_like(values.type_id())) {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<::arrow::BinaryType>(
+        *values.data(), visit_value, visit_null));
+  } else {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<::arrow::LargeBinaryType>(
+        *values.data(), visit_value, visit_null));
+  }
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using T = ByteArray;
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    }
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i]);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitBinaryValues(values, [this](const ByteArray& value) { Put(value); });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer,
+          ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+      ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+  void Put(const ByteArray& value) {
+    const int32_t length = static_cast<int32_t>(value.len);
+    length_encoder_.Put(&length, 1);
+    if (value.len > 0) {
+      PARQUET_THROW_NOT_OK(sink_.Append(value.ptr, value.len));
+    }
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  ::arrow::BufferBuilder sink_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using T = ByteArray;
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(
+        this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Each page starts over from an empty previous value
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i]);
+    }
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    VisitBinaryValues(values, [this](const ByteArray& value) { Put(value); });
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer,
+          ::arrow::AllocateBuffer(num_values * sizeof(ByteArray), this->memory_pool()));
+      ByteArray* data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+  void Put(const ByteArray& value) {
+    const char* data = reinterpret_cast<const char*>(value.ptr);
+    const uint32_t max_prefix_length =
+        std::min(value.len, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix_length = 0;
+    while (prefix_length < max_prefix_length &&
+           last_value_[prefix_length] == data[prefix_length]) {
+      ++prefix_length;
+    }
+    const int32_t encoded_prefix_length = static_cast<int32_t>(prefix_length);
+    prefix_length_encoder_.Put(&encoded_prefix_length, 1);
+    suffix_encoder_.Put(ByteArray(value.len - prefix_length, value.ptr + prefix_length));
+    last_value_.assign(data, value.len);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -2035,6 +2401,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -2047,10 +2414,16 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   void SetData(int num_values, const uint8_t* data, int len) override {
     this->num_values_ = num_values;
     decoder_ = ::arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
+  /// The number of values encoded in the page, i.e. not counting nulls
+  int ValidValuesCount() const { return static_cast<int>(total_value_count_); }
+
+  /// The number of bytes following the values decoded so far.  Once all values
+  /// are decoded, these are the bytes following the encoded data.
+  int bytes_left() { return decoder_.bytes_left(); }
+
   int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
@@ -2083,55 +2456,129 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void InitHeader() {
+    uint32_t values_per_block;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&values_per_block) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count_) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (values_per_block == 0 || values_per_block % 128 != 0) {
+      throw ParquetException("the number of values in a block must be multiple of 128, ",
+                             "but it's ", values_per_block);
+    }
+    if (mini_blocks_per_block_ == 0 || values_per_block % mini_blocks_per_block_ != 0 ||
+        (values_per_block / mini_blocks_per_block_) % 32 != 0) {
+      throw ParquetException(
+          "the number of values in a miniblock must be multiple of 32, but it's ",
+          mini_blocks_per_block_ == 0 ? 0 : values_per_block / mini_blocks_per_block_);
+    }
+    values_per_mini_block_ = values_per_block / mini_blocks_per_block_;
+    delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    total_values_remaining_ = total_value_count_;
+    last_value_ = static_cast<T>(first_value);
+    first_value_pending_ = total_value_count_ > 0;
+    block_initialized_ = false;
+    delta_bit_width_ = 0;
+    values_remaining_current_mini_block_ = 0;
+  }
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
+
+    // Bit widths of the miniblocks unused by the last block may hold anything
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
+    block_initialized_ = true;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    constexpr int kMaxDeltaBitWidth = static_cast<int>(sizeof(T) * 8);
+    if (ARROW_PREDICT_FALSE(bit_width > kMaxDeltaBitWidth)) {
+      throw ParquetException("delta bit width ", bit_width,
+                             " larger than integer bit width ", kMaxDeltaBitWidth);
+    }
+    delta_bit_width_ = bit_width;
+    values_remaining_current_mini_block_ = values_per_mini_block_;
+  }
+
+  // Read `num_values` packed deltas of the current miniblock
+  void UnpackDeltas(T* out, int num_values) {
+    if (delta_bit_width_ == 0) {
+      std::fill(out, out + num_values, static_cast<T>(0));
+    } else if (delta_bit_width_ <= 32) {
+      // Whole runs of deltas go through the (SIMD) unpack32 routines
+      if (decoder_.GetBatch(delta_bit_width_, out, num_values) != num_values) {
+        ParquetException::EofException();
+      }
+    } else {
+      for (int i = 0; i < num_values; ++i) {
+        uint64_t low_bits, high_bits;
+        if (!decoder_.GetValue(32, &low_bits) ||
+            !decoder_.GetValue(delta_bit_width_ - 32, &high_bits)) {
+          ParquetException::EofException();
+        }
+        out[i] = static_cast<T>(low_bits | (high_bits << 32));
+      }
+    }
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
+    max_values = static_cast<int>(std::min<uint64_t>(
+        std::max(0, std::min(max_values, this->num_values_)), total_values_remaining_));
+    if (max_values == 0) {
+      return 0;
+    }
+
+    int i = 0;
+    if (ARROW_PREDICT_FALSE(first_value_pending_)) {
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
     const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
+    while (i < max_values) {
+      if (ARROW_PREDICT_FALSE(values_remaining_current_mini_block_ == 0)) {
+        if (!block_initialized_ || mini_block_idx_ + 1 == mini_blocks_per_block_) {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
+        } else {
+          ++mini_block_idx_;
+          InitMiniBlock(bit_width_data[mini_block_idx_]);
         }
       }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int num_deltas = static_cast<int>(std::min<uint32_t>(
+          max_values - i, values_remaining_current_mini_block_));
+      UnpackDeltas(buffer + i, num_deltas);
+      UT value = static_cast<UT>(last_value_);
+      for (int j = i; j < i + num_deltas; ++j) {
+        value += min_delta_ + static_cast<UT>(buffer[j]);
+        buffer[j] = static_cast<T>(value);
+      }
+      last_value_ = static_cast<T>(value);
+      i += num_deltas;
+      values_remaining_current_mini_block_ -= num_deltas;
+    }
+
+    total_values_remaining_ -= max_values;
+    if (total_values_remaining_ == 0) {
+      // Skip the padding of the last miniblock, so that bytes_left() gives the
+      // size of the data following the encoded values
+      if (!decoder_.Advance(static_cast<int64_t>(delta_bit_width_) *
+                            values_remaining_current_mini_block_)) {
+        ParquetException::EofException();
+      }
+      values_remaining_current_mini_block_ = 0;
     }
     this->num_values_ -= max_values;
     return max_values;
@@ -2139,19 +2586,80 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   MemoryPool* pool_;
   ::arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t mini_blocks_per_block_;
+  uint32_t values_per_mini_block_;
+  uint64_t total_value_count_;
+
+  uint64_t total_values_remaining_;
+  bool first_value_pending_;
+  bool block_initialized_;
+  UT min_delta_;
+  uint32_t mini_block_idx_;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
   int delta_bit_width_;
+  uint32_t values_remaining_current_mini_block_;
 
-  int32_t last_value_;
+  T last_value_;
 };
 
+// Decode the non-null values of a BYTE_ARRAY page with `decoder`, then append
+// them along with the null slots to `out`
+int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_valid_values = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(num_valid_values != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  int i = 0;
+  int value_index = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_index++];
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value.len))) {
+          // This element would exceed the capacity of a chunk
+          RETURN_NOT_OK(helper.PushChunk());
+          RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+        }
+        ++i;
+        return helper.Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() {
+        helper.UnsafeAppendNull();
+        ++i;
+        return Status::OK();
+      }));
+  return num_valid_values;
+}
+
+int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_valid_values = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(num_valid_values != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  int value_index = 0;
+  PARQUET_THROW_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        const ByteArray& value = values[value_index++];
+        return out->Append(value.ptr, static_cast<int32_t>(value.len));
+      },
+      [&]() { return out->AppendNull(); }));
+  return num_valid_values;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2162,29 +2670,36 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The lengths come first, then the concatenated values
+    len_decoder_.SetData(num_values, data, len);
+    lengths_.resize(len_decoder_.ValidValuesCount());
+    if (len_decoder_.Decode(lengths_.data(), static_cast<int>(lengths_.size())) !=
+        static_cast<int>(lengths_.size())) {
+      ParquetException::EofException();
+    }
+    length_idx_ = 0;
+    len_ = len_decoder_.bytes_left();
+    data_ = data + (len - len_);
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    max_values = std::min(max_values, static_cast<int>(lengths_.size()) - length_idx_);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_idx_ + i];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len_)) {
+        throw ParquetException("Invalid or corrupted length in DELTA_LENGTH_BYTE_ARRAY");
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      this->data_ += length;
+      this->len_ -= length;
     }
+    length_idx_ += max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
@@ -2192,18 +2707,21 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2217,46 +2735,93 @@ class DeltaByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        values_(::arrow::stl::allocator<ByteArray>(pool)),
+        pool_(pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
+  void SetData(int num_values, const uint8_t* data, int len) override {
     num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
-
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    // The prefix lengths come first, then the suffixes as DELTA_LENGTH_BYTE_ARRAY
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_valid_values = prefix_len_decoder_.ValidValuesCount();
+    ArrowPoolVector<int32_t> prefix_lengths(num_valid_values, 0,
+                                            ::arrow::stl::allocator<int32_t>(pool_));
+    if (prefix_len_decoder_.Decode(prefix_lengths.data(), num_valid_values) !=
+        num_valid_values) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = len - prefix_len_decoder_.bytes_left();
+    suffix_decoder_.SetData(num_valid_values, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+
+    // Each value depends on the previous one, so all values of the page are
+    // materialized at once; they remain valid until the next page
+    values_.resize(num_valid_values);
+    if (suffix_decoder_.Decode(values_.data(), num_valid_values) != num_valid_values) {
+      ParquetException::EofException();
+    }
+    int64_t total_length = 0;
+    for (int i = 0; i < num_valid_values; ++i) {
+      total_length += prefix_lengths[i] + static_cast<int64_t>(values_[i].len);
+    }
+    if (buffered_data_ == nullptr) {
+      buffered_data_ = AllocateBuffer(pool_, total_length);
+    } else {
+      PARQUET_THROW_NOT_OK(buffered_data_->Resize(total_length, /*shrink_to_fit=*/false));
+    }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    uint8_t* out = buffered_data_->mutable_data();
+    ByteArray last_value;
+    for (int i = 0; i < num_valid_values; ++i) {
+      const int32_t prefix_length = prefix_lengths[i];
+      if (ARROW_PREDICT_FALSE(prefix_length < 0 ||
+                              static_cast<uint32_t>(prefix_length) > last_value.len)) {
+        throw ParquetException("Invalid or corrupted prefix length in DELTA_BYTE_ARRAY");
+      }
+      const ByteArray suffix = values_[i];
+      if (prefix_length > 0) {
+        memcpy(out, last_value.ptr, prefix_length);
+      }
+      if (suffix.len > 0) {
+        memcpy(out + prefix_length, suffix.ptr, suffix.len);
+      }
+      values_[i] = ByteArray(prefix_length + suffix.len, out);
+      last_value = values_[i];
+      out += values_[i].len;
     }
+    value_idx_ = 0;
+  }
+
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    max_values = std::min(max_values, static_cast<int>(values_.size()) - value_idx_);
+    std::copy(values_.begin() + value_idx_, values_.begin() + value_idx_ + max_values,
+              buffer);
+    value_idx_ += max_values;
     this->num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  ArrowPoolVector<ByteArray> values_;
+  int value_idx_ = 0;
+  std::shared_ptr<ResizableBuffer> buffered_data_;
+  ::arrow::MemoryPool* pool_;
 };
 
 // ----------------------------------------------------------------------
@@ -2444,6 +3009,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2484,6 +3069,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
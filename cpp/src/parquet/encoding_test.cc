@@ -21,6 +21,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1239,5 +1241,273 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  using c_type = typename Type::c_type;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+    }
+
+    {
+      // Try again with a step crossing miniblock and block boundaries
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 37;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(
+            VerifyResults<c_type>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+      ASSERT_EQ(0, decoder->Decode(decode_buf_, step));
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<c_type>(decode_buf_, draws_, num_values_,
+                                                        valid_bits, valid_bits_offset));
+  }
+
+  void ExecuteValues(const std::vector<c_type>& values) {
+    num_values_ = static_cast<int>(values.size());
+    input_bytes_.resize(num_values_ * sizeof(c_type));
+    output_bytes_.resize(num_values_ * sizeof(c_type));
+    draws_ = reinterpret_cast<c_type*>(input_bytes_.data());
+    decode_buf_ = reinterpret_cast<c_type*>(output_bytes_.data());
+    std::copy(values.begin(), values.end(), draws_);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+  using TestEncodingBase<Type>::input_bytes_;
+  using TestEncodingBase<Type>::output_bytes_;
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Empty and single value pages have no block
+  ASSERT_NO_FATAL_FAILURE(this->Execute(0, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1, 1));
+  // Partial miniblocks, and full or partial blocks
+  ASSERT_NO_FATAL_FAILURE(this->Execute(31, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(129, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(1000, 1));
+  ASSERT_NO_FATAL_FAILURE(this->Execute(250, 4));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ExtremeValues) {
+  using c_type = typename TypeParam::c_type;
+  const c_type min = std::numeric_limits<c_type>::min();
+  const c_type max = std::numeric_limits<c_type>::max();
+
+  // Deltas overflowing the value type, with the widest bit width
+  std::vector<c_type> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(i % 3 == 0 ? min : (i % 3 == 1 ? max : 0));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+
+  // Constant and monotonic sequences have zero bit widths
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(std::vector<c_type>(300, max)));
+  std::vector<c_type> sequence(300);
+  std::iota(sequence.begin(), sequence.end(), min);
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(sequence));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, RoundTripSpaced) {
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, 0.1));
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 3, 0.5));
+}
+
+TEST(DeltaBitPackEncoding, KnownEncoding) {
+  // The example of the Parquet specification: a single block whose deltas
+  // are all equal to the minimum delta, so that no bits are needed
+  const std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  const std::vector<uint8_t> expected = {
+      0x80, 0x01,  // 128 values per block
+      0x04,        // 4 miniblocks per block
+      0x05,        // 5 values
+      0x02,        // first value: zigzag(1)
+      0x02,        // min delta: zigzag(1)
+      0x00, 0x00, 0x00, 0x00  // bit widths
+  };
+
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto encoded = encoder->FlushValues();
+  ASSERT_EQ(std::vector<uint8_t>(encoded->data(), encoded->data() + encoded->size()),
+            expected);
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(static_cast<int>(values.size()), expected.data(),
+                   static_cast<int>(expected.size()));
+  std::vector<int32_t> decoded(values.size());
+  ASSERT_EQ(static_cast<int>(values.size()),
+            decoder->Decode(decoded.data(), static_cast<int>(values.size())));
+  ASSERT_EQ(decoded, values);
+}
+
+TEST(DeltaBitPackEncoding, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests
+
+class DeltaByteArrayEncodingBase : public TestArrowBuilderDecoding {
+ public:
+  explicit DeltaByteArrayEncodingBase(Encoding::type encoding) : encoding_(encoding) {}
+
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(encoding_);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+  void CheckRoundtrip() {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding_);
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding_);
+    std::vector<std::string> strings = {"", "a", "abc", "abd", "abd", "b", "", "bcdef"};
+    for (int i = 0; i < 500; ++i) {
+      strings.push_back("prefix" + std::to_string(i * 7));
+    }
+    std::vector<ByteArray> values;
+    for (const auto& s : strings) {
+      values.emplace_back(static_cast<uint32_t>(s.size()),
+                          reinterpret_cast<const uint8_t*>(s.data()));
+    }
+
+    // Two pages, to check that the encoder state is reset
+    for (int page = 0; page < 2; ++page) {
+      encoder->Put(values.data(), static_cast<int>(values.size()));
+      auto encoded = encoder->FlushValues();
+      decoder->SetData(static_cast<int>(values.size()), encoded->data(),
+                       static_cast<int>(encoded->size()));
+      std::vector<ByteArray> decoded(values.size());
+      int num_decoded = 0;
+      while (num_decoded < static_cast<int>(values.size())) {
+        int step = decoder->Decode(decoded.data() + num_decoded, 100);
+        ASSERT_GT(step, 0);
+        num_decoded += step;
+      }
+      ASSERT_EQ(0, decoder->values_left());
+      for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], decoded[i]) << "at index " << i;
+      }
+    }
+  }
+
+ protected:
+  Encoding::type encoding_;
+};
+
+class DeltaLengthByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaLengthByteArrayEncoding()
+      : DeltaByteArrayEncodingBase(Encoding::DELTA_LENGTH_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, BasicRoundTrip) { this->CheckRoundtrip(); }
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaByteArrayEncoding() : DeltaByteArrayEncodingBase(Encoding::DELTA_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaByteArrayEncoding, BasicRoundTrip) { this->CheckRoundtrip(); }
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST(DeltaByteArrayEncodingAdHoc, ArrowBinaryDirectPut) {
+  const std::vector<std::string> strings = {"parquet", "parquetry", "par", "", "arrow"};
+  auto array = ::arrow::ArrayFromJSON(
+      ::arrow::utf8(), R"(["parquet", "parquetry", null, "par", "", "arrow"])");
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding);
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding);
+    ASSERT_NO_THROW(encoder->Put(*array));
+    auto encoded = encoder->FlushValues();
+    decoder->SetData(static_cast<int>(strings.size()), encoded->data(),
+                     static_cast<int>(encoded->size()));
+    std::vector<ByteArray> decoded(strings.size());
+    ASSERT_EQ(static_cast<int>(strings.size()),
+              decoder->Decode(decoded.data(), static_cast<int>(strings.size())));
+    for (size_t i = 0; i < strings.size(); ++i) {
+      ASSERT_EQ(strings[i], ByteArrayToString(decoded[i]));
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -30,6 +30,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -38,6 +39,7 @@
 #include "parquet/file_writer.h"
 #include "parquet/internal_file_decryptor.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -83,6 +85,36 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::shared_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
+std::shared_ptr<BloomFilter> RowGroupReader::GetBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -138,6 +170,36 @@ class SerializedRowGroup : public RowGroupReader::Contents {
 
   const ReaderProperties* properties() const override { return &properties_; }
 
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Encrypted page indexes are not supported
+    if (!col->has_column_index() || col->crypto_metadata() != nullptr) {
+      return nullptr;
+    }
+    auto buffer = ReadIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(*file_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index() || col->crypto_metadata() != nullptr) {
+      return nullptr;
+    }
+    auto buffer = ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::shared_ptr<BloomFilter> GetBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    // Encrypted Bloom filters are not supported
+    if (col->crypto_metadata() != nullptr || !col->has_bloom_filter()) {
+      return nullptr;
+    }
+    return BlockSplitBloomFilter::ReadWithHeader(source_.get(),
+                                                 col->bloom_filter_offset());
+  }
+
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
@@ -200,6 +262,19 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   }
 
  private:
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int32_t length) {
+    if (offset < 0 || length < 0 || offset + length > source_size_) {
+      throw ParquetException("Invalid page index location (offset: ", offset,
+                             ", length: ", length, ", file size: ", source_size_, ")");
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(offset, length));
+    if (buffer->size() != length) {
+      throw ParquetException("Page index was smaller (", buffer->size(),
+                             ") than expected (", length, ")");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -24,11 +24,13 @@
 
 #include "arrow/io/caching.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnReader;
 class FileMetaData;
 class PageReader;
@@ -45,6 +47,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int) { return NULLPTR; }
+    virtual std::shared_ptr<OffsetIndex> GetOffsetIndex(int) { return NULLPTR; }
+    virtual std::shared_ptr<BloomFilter> GetBloomFilter(int) { return NULLPTR; }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,6 +63,21 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  /// \brief Read the ColumnIndex of a column chunk
+  ///
+  /// \return null if the column chunk has no (readable) ColumnIndex
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  /// \brief Read the OffsetIndex of a column chunk
+  ///
+  /// \return null if the column chunk has no (readable) OffsetIndex
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  /// \brief Read the Bloom filter of a column chunk
+  ///
+  /// \return null if the column chunk has no (readable) Bloom filter
+  std::shared_ptr<BloomFilter> GetBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
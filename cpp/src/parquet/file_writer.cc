@@ -138,7 +138,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     std::unique_ptr<PageWriter> pager = PageWriter::Open(
         sink_, properties_->compression(path), properties_->compression_level(path),
         col_meta, row_group_ordinal_, static_cast<int16_t>(next_column_index_ - 1),
-        properties_->memory_pool(), false, meta_encryptor, data_encryptor);
+        properties_->memory_pool(), false, meta_encryptor, data_encryptor,
+        WritePageIndex(*col_meta->descr(), meta_encryptor, data_encryptor));
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
     return column_writers_[0].get();
   }
@@ -209,6 +210,15 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
 
+  // Page indexes are only written for flat, unencrypted columns: pages of
+  // repeated columns may not start at row boundaries
+  bool WritePageIndex(const ColumnDescriptor& descr,
+                      const std::shared_ptr<Encryptor>& meta_encryptor,
+                      const std::shared_ptr<Encryptor>& data_encryptor) const {
+    return properties_->write_page_index() && descr.max_repetition_level() == 0 &&
+           meta_encryptor == nullptr && data_encryptor == nullptr;
+  }
+
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
     if (!buffered_row_group_ && column_writers_.size() > 0 && column_writers_[0]) {
@@ -245,7 +255,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
           sink_, properties_->compression(path), properties_->compression_level(path),
           col_meta, static_cast<int16_t>(row_group_ordinal_),
           static_cast<int16_t>(next_column_index_++), properties_->memory_pool(),
-          buffered_row_group_, meta_encryptor, data_encryptor);
+          buffered_row_group_, meta_encryptor, data_encryptor,
+          WritePageIndex(*col_meta->descr(), meta_encryptor, data_encryptor));
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
     }
@@ -173,6 +173,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index (see parquet/page_index.h)
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // Bloom filter (see parquet/bloom_filter.h)
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -401,6 +413,11 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // location of the serialized page index of the column chunk
+  void SetColumnIndexLocation(int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int64_t offset, int32_t length);
+  // location of the serialized Bloom filter of the column chunk
+  void SetBloomFilterOffset(int64_t offset);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+namespace {
+
+class OffsetIndexImpl : public OffsetIndex {
+ public:
+  explicit OffsetIndexImpl(const format::OffsetIndex& offset_index) {
+    page_locations_.reserve(offset_index.page_locations.size());
+    for (const auto& location : offset_index.page_locations) {
+      if (!page_locations_.empty() &&
+          location.first_row_index < page_locations_.back().first_row_index) {
+        throw ParquetException("Invalid OffsetIndex: rows of pages are not ordered");
+      }
+      page_locations_.push_back(
+          {location.offset, location.compressed_page_size, location.first_row_index});
+    }
+    if (!page_locations_.empty() && page_locations_.front().first_row_index != 0) {
+      throw ParquetException("Invalid OffsetIndex: first page doesn't start at row 0");
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+class ColumnIndexImpl : public ColumnIndex {
+ public:
+  ColumnIndexImpl(const ColumnDescriptor& descr, const format::ColumnIndex& column_index)
+      : descr_(&descr),
+        null_pages_(column_index.null_pages),
+        min_values_(column_index.min_values),
+        max_values_(column_index.max_values),
+        boundary_order_(
+            static_cast<BoundaryOrder::type>(column_index.boundary_order)),
+        has_null_counts_(column_index.__isset.null_counts),
+        null_counts_(column_index.null_counts) {
+    const size_t num_pages = null_pages_.size();
+    if (min_values_.size() != num_pages || max_values_.size() != num_pages ||
+        (has_null_counts_ && null_counts_.size() != num_pages)) {
+      throw ParquetException("Invalid ColumnIndex: inconsistent number of pages");
+    }
+  }
+
+  int num_pages() const override { return static_cast<int>(null_pages_.size()); }
+
+  const std::vector<bool>& null_pages() const override { return null_pages_; }
+
+  const std::vector<std::string>& encoded_min_values() const override {
+    return min_values_;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const override {
+    return max_values_;
+  }
+
+  BoundaryOrder::type boundary_order() const override { return boundary_order_; }
+
+  bool has_null_counts() const override { return has_null_counts_; }
+
+  const std::vector<int64_t>& null_counts() const override { return null_counts_; }
+
+  std::shared_ptr<Statistics> page_statistics(int page, int64_t num_values,
+                                              MemoryPool* pool) const override {
+    if (page < 0 || page >= num_pages()) {
+      throw ParquetException("Page ", page, " out of bounds of ColumnIndex with ",
+                             num_pages(), " pages");
+    }
+    if (descr_->sort_order() == SortOrder::UNKNOWN) {
+      return nullptr;
+    }
+    if (null_pages_[page]) {
+      return Statistics::Make(descr_, "", "", /*num_values=*/0,
+                              /*null_count=*/num_values, /*distinct_count=*/0,
+                              /*has_min_max=*/false, /*has_null_count=*/true,
+                              /*has_distinct_count=*/false, pool);
+    }
+    const int64_t null_count = has_null_counts_ ? null_counts_[page] : 0;
+    return Statistics::Make(descr_, min_values_[page], max_values_[page],
+                            num_values - null_count, null_count, /*distinct_count=*/0,
+                            /*has_min_max=*/true, has_null_counts_,
+                            /*has_distinct_count=*/false, pool);
+  }
+
+ private:
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  BoundaryOrder::type boundary_order_;
+  bool has_null_counts_;
+  std::vector<int64_t> null_counts_;
+};
+
+// The rows of data page `i`
+RowRange PageRows(const std::vector<PageLocation>& pages, size_t i, int64_t num_rows) {
+  const int64_t end = i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows;
+  return {pages[i].first_row_index, end};
+}
+
+// The union of the pages overlapping `ranges`, as row ranges
+RowRanges WidenToPages(const RowRanges& ranges, const OffsetIndex& offset_index,
+                       int64_t num_rows) {
+  const auto& pages = offset_index.page_locations();
+  RowRanges widened;
+  size_t range_index = 0;
+  for (size_t i = 0; i < pages.size() && range_index < ranges.size(); ++i) {
+    const RowRange page = PageRows(pages, i, num_rows);
+    // Skip the ranges ending before this page
+    while (range_index < ranges.size() && ranges[range_index].end <= page.start) {
+      ++range_index;
+    }
+    if (range_index == ranges.size() || ranges[range_index].start >= page.end ||
+        page.length() == 0) {
+      continue;
+    }
+    if (!widened.empty() && widened.back().end == page.start) {
+      widened.back().end = page.end;
+    } else {
+      widened.push_back(page);
+    }
+  }
+  return widened;
+}
+
+}  // namespace
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &offset_index);
+  return std::unique_ptr<OffsetIndex>(new OffsetIndexImpl(offset_index));
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor& descr,
+                                               const void* serialized_index,
+                                               uint32_t index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), &index_len,
+                       &column_index);
+  return std::unique_ptr<ColumnIndex>(new ColumnIndexImpl(descr, column_index));
+}
+
+std::vector<bool> SelectPages(const RowRanges& ranges, const OffsetIndex& offset_index,
+                              int64_t num_rows) {
+  const auto& pages = offset_index.page_locations();
+  std::vector<bool> selected(pages.size(), false);
+  size_t range_index = 0;
+  for (size_t i = 0; i < pages.size(); ++i) {
+    const RowRange page = PageRows(pages, i, num_rows);
+    while (range_index < ranges.size() && ranges[range_index].end <= page.start) {
+      ++range_index;
+    }
+    selected[i] = range_index < ranges.size() && ranges[range_index].start < page.end;
+  }
+  return selected;
+}
+
+RowRanges AlignRowRangesToPages(RowRanges ranges,
+                                const std::vector<const OffsetIndex*>& offset_indexes,
+                                int64_t num_rows) {
+  // Widening to the pages of one column may cross page boundaries of another,
+  // so iterate until the ranges are stable. This terminates since ranges only
+  // grow, and only up to page boundaries.
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (const OffsetIndex* offset_index : offset_indexes) {
+      RowRanges widened = WidenToPages(ranges, *offset_index, num_rows);
+      if (widened != ranges) {
+        ranges = std::move(widened);
+        changed = true;
+      }
+    }
+  }
+  return ranges;
+}
+
+}  // namespace parquet
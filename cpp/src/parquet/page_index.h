@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Readers for the page index of a column chunk (the ColumnIndex and OffsetIndex
+// structures of the Parquet format), and utilities to select the data pages
+// holding a given set of rows.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class Statistics;
+
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+/// \brief The location of a data page, as recorded in the OffsetIndex
+struct PARQUET_EXPORT PageLocation {
+  /// Offset of the page header in the file
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief The OffsetIndex of a column chunk, locating each of its data pages
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Deserialize an OffsetIndex
+  ///
+  /// Throws ParquetException if the index is malformed.
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~OffsetIndex() = default;
+
+  /// \brief The locations of the data pages, in file order
+  virtual const std::vector<PageLocation>& page_locations() const = 0;
+};
+
+/// \brief The ColumnIndex of a column chunk, holding statistics of each of
+/// its data pages
+///
+/// Each entry refers to the page at the same position in the OffsetIndex.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Deserialize a ColumnIndex for the given column
+  ///
+  /// Throws ParquetException if the index is malformed. The descriptor must
+  /// outlive the ColumnIndex.
+  static std::unique_ptr<ColumnIndex> Make(const ColumnDescriptor& descr,
+                                           const void* serialized_index,
+                                           uint32_t index_len);
+
+  virtual ~ColumnIndex() = default;
+
+  virtual int num_pages() const = 0;
+
+  /// \brief Whether each page contains only null values
+  virtual const std::vector<bool>& null_pages() const = 0;
+
+  /// \brief Plain-encoded lower bounds of the pages (empty for null pages)
+  virtual const std::vector<std::string>& encoded_min_values() const = 0;
+
+  /// \brief Plain-encoded upper bounds of the pages (empty for null pages)
+  virtual const std::vector<std::string>& encoded_max_values() const = 0;
+
+  virtual BoundaryOrder::type boundary_order() const = 0;
+
+  virtual bool has_null_counts() const = 0;
+
+  /// \brief The number of nulls of each page; empty unless has_null_counts()
+  virtual const std::vector<int64_t>& null_counts() const = 0;
+
+  /// \brief Return the statistics of a page
+  ///
+  /// \param[in] page the ordinal of the page
+  /// \param[in] num_values the number of values of the page, including nulls
+  /// \param[in] pool memory pool used by the Statistics
+  /// \return the statistics of the page, or null if the column's sort order
+  /// is unknown. Pages containing only nulls have no min/max set.
+  virtual std::shared_ptr<Statistics> page_statistics(
+      int page, int64_t num_values,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool()) const = 0;
+};
+
+/// \brief A half-open range [start, end) of rows within a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t start;
+  int64_t end;
+
+  int64_t length() const { return end - start; }
+
+  bool operator==(const RowRange& other) const {
+    return start == other.start && end == other.end;
+  }
+};
+
+/// \brief Sorted, non-overlapping and non-adjacent row ranges
+using RowRanges = std::vector<RowRange>;
+
+/// \brief Select the data pages of a column chunk which overlap `ranges`
+///
+/// \param[in] ranges the rows to select
+/// \param[in] offset_index the OffsetIndex of the column chunk
+/// \param[in] num_rows the number of rows of the row group
+/// \return one entry per data page, true if the page must be read
+PARQUET_EXPORT
+std::vector<bool> SelectPages(const RowRanges& ranges, const OffsetIndex& offset_index,
+                              int64_t num_rows);
+
+/// \brief Widen `ranges` to page boundaries
+///
+/// Returns the smallest superset of `ranges` whose bounds are page boundaries
+/// in every one of the given column chunks. Reading the pages selected by
+/// SelectPages() for each of these columns then yields the same rows.
+///
+/// \param[in] ranges the rows to select
+/// \param[in] offset_indexes the OffsetIndex of each column chunk to read
+/// \param[in] num_rows the number of rows of the row group
+PARQUET_EXPORT
+RowRanges AlignRowRangesToPages(RowRanges ranges,
+                                const std::vector<const OffsetIndex*>& offset_indexes,
+                                int64_t num_rows);
+
+}  // namespace parquet
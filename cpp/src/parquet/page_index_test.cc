@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "parquet/column_page.h"
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/page_index.h"
+#include "parquet/platform.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/types.h"
+
+namespace parquet {
+namespace test {
+
+using schema::GroupNode;
+using schema::PrimitiveNode;
+
+class FakeOffsetIndex : public OffsetIndex {
+ public:
+  explicit FakeOffsetIndex(const std::vector<int64_t>& first_rows) {
+    for (int64_t first_row : first_rows) {
+      page_locations_.push_back({/*offset=*/0, /*compressed_page_size=*/0, first_row});
+    }
+  }
+
+  const std::vector<PageLocation>& page_locations() const override {
+    return page_locations_;
+  }
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+TEST(TestPageIndex, SelectPages) {
+  FakeOffsetIndex offset_index({0, 10, 20, 30});
+
+  ASSERT_EQ(SelectPages({{5, 12}, {35, 40}}, offset_index, 40),
+            std::vector<bool>({true, true, false, true}));
+  ASSERT_EQ(SelectPages({{10, 20}}, offset_index, 40),
+            std::vector<bool>({false, true, false, false}));
+  ASSERT_EQ(SelectPages({}, offset_index, 40),
+            std::vector<bool>({false, false, false, false}));
+}
+
+TEST(TestPageIndex, AlignRowRangesToPages) {
+  FakeOffsetIndex a({0, 10, 20, 30});
+  FakeOffsetIndex b({0, 15, 30});
+
+  ASSERT_EQ(AlignRowRangesToPages({{12, 13}}, {&a}, 40), RowRanges({{10, 20}}));
+  ASSERT_EQ(AlignRowRangesToPages({{12, 13}, {35, 36}}, {&a}, 40),
+            RowRanges({{10, 20}, {30, 40}}));
+  // Adjacent pages are merged
+  ASSERT_EQ(AlignRowRangesToPages({{9, 11}}, {&a}, 40), RowRanges({{0, 20}}));
+  // Widening to the pages of b crosses pages of a, and conversely
+  ASSERT_EQ(AlignRowRangesToPages({{12, 13}}, {&a, &b}, 40), RowRanges({{0, 30}}));
+  ASSERT_EQ(AlignRowRangesToPages({{31, 32}}, {&a, &b}, 40), RowRanges({{30, 40}}));
+  ASSERT_EQ(AlignRowRangesToPages({}, {&a, &b}, 40), RowRanges({}));
+}
+
+class TestPageIndexRoundTrip : public ::testing::Test {
+ public:
+  static constexpr int kNumRows = 1000;
+  static constexpr int kRowsPerPage = 100;
+
+  // Write a nullable INT64 column holding its row number, except for the rows
+  // of the sixth page which are null
+  std::shared_ptr<Buffer> WriteFile(bool write_page_index) {
+    auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+        "schema", Repetition::REQUIRED,
+        {PrimitiveNode::Make("x", Repetition::OPTIONAL, Type::INT64)}));
+
+    WriterProperties::Builder builder;
+    builder.write_batch_size(kRowsPerPage)->data_pagesize(1)->disable_dictionary();
+    if (write_page_index) {
+      builder.enable_write_page_index();
+    }
+
+    std::vector<int16_t> def_levels(kNumRows, 1);
+    std::vector<int64_t> values;
+    for (int i = 0; i < kNumRows; ++i) {
+      if (i / kRowsPerPage == 5) {
+        def_levels[i] = 0;
+      } else {
+        values.push_back(i);
+      }
+    }
+
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, builder.build());
+    auto column_writer =
+        static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+    column_writer->WriteBatch(kNumRows, def_levels.data(), nullptr, values.data());
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    return buffer;
+  }
+
+  std::unique_ptr<ParquetFileReader> OpenFile(const std::shared_ptr<Buffer>& buffer) {
+    return ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  }
+};
+
+TEST_F(TestPageIndexRoundTrip, NotWrittenByDefault) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/false));
+  auto row_group = file_reader->RowGroup(0);
+
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(0)->has_column_index());
+  ASSERT_FALSE(row_group->metadata()->ColumnChunk(0)->has_offset_index());
+  ASSERT_EQ(row_group->GetColumnIndex(0), nullptr);
+  ASSERT_EQ(row_group->GetOffsetIndex(0), nullptr);
+}
+
+TEST_F(TestPageIndexRoundTrip, ReadIndexes) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true));
+  auto row_group = file_reader->RowGroup(0);
+
+  auto offset_index = row_group->GetOffsetIndex(0);
+  ASSERT_NE(offset_index, nullptr);
+  const auto& pages = offset_index->page_locations();
+  ASSERT_EQ(pages.size(), kNumRows / kRowsPerPage);
+  for (size_t i = 0; i < pages.size(); ++i) {
+    ASSERT_EQ(pages[i].first_row_index, static_cast<int64_t>(i) * kRowsPerPage);
+    ASSERT_GT(pages[i].compressed_page_size, 0);
+  }
+  ASSERT_EQ(pages[0].offset, row_group->metadata()->ColumnChunk(0)->data_page_offset());
+
+  auto column_index = row_group->GetColumnIndex(0);
+  ASSERT_NE(column_index, nullptr);
+  ASSERT_EQ(column_index->num_pages(), static_cast<int>(pages.size()));
+  ASSERT_TRUE(column_index->has_null_counts());
+
+  for (int i = 0; i < column_index->num_pages(); ++i) {
+    auto stats = std::static_pointer_cast<Int64Statistics>(
+        column_index->page_statistics(i, kRowsPerPage));
+    ASSERT_NE(stats, nullptr);
+    if (i == 5) {
+      ASSERT_TRUE(column_index->null_pages()[i]);
+      ASSERT_FALSE(stats->HasMinMax());
+      ASSERT_EQ(stats->null_count(), kRowsPerPage);
+    } else {
+      ASSERT_FALSE(column_index->null_pages()[i]);
+      ASSERT_EQ(stats->min(), i * kRowsPerPage);
+      ASSERT_EQ(stats->max(), (i + 1) * kRowsPerPage - 1);
+      ASSERT_EQ(stats->null_count(), 0);
+    }
+  }
+}
+
+TEST_F(TestPageIndexRoundTrip, SkipDataPages) {
+  auto file_reader = OpenFile(WriteFile(/*write_page_index=*/true));
+  auto page_reader = file_reader->RowGroup(0)->GetColumnPageReader(0);
+  page_reader->set_data_page_filter(
+      [](int32_t data_page_ordinal) { return data_page_ordinal % 2 == 1; });
+
+  int num_data_pages = 0;
+  std::shared_ptr<Page> page;
+  while ((page = page_reader->NextPage()) != nullptr) {
+    if (page->type() == PageType::DATA_PAGE || page->type() == PageType::DATA_PAGE_V2) {
+      auto data_page = std::static_pointer_cast<DataPage>(page);
+      ASSERT_EQ(data_page->num_values(), kRowsPerPage);
+      ++num_data_pages;
+    }
+  }
+  ASSERT_EQ(num_data_pages, kNumRows / kRowsPerPage / 2);
+}
+
+}  // namespace test
+}  // namespace parquet
@@ -113,6 +113,14 @@ static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief Sizing of the Bloom filter written for a column chunk
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected number of distinct values in a column chunk
+  int32_t ndv = 1 << 20;
+  /// False positive probability of the Bloom filter for that many values
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -147,6 +155,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_options(const BloomFilterOptions& bloom_filter_options) {
+    bloom_filter_options_ = bloom_filter_options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -159,6 +175,10 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  const BloomFilterOptions& bloom_filter_options() const { return bloom_filter_options_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -166,6 +186,8 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_ = false;
+  BloomFilterOptions bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -180,7 +202,8 @@ class PARQUET_EXPORT WriterProperties {
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -251,6 +274,21 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Write a ColumnIndex (per-page min/max/null counts) and an OffsetIndex
+    /// (page locations) for each column chunk, allowing readers to skip
+    /// individual data pages.
+    ///
+    /// Page indexes are not written for repeated or encrypted columns.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
     /**
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
@@ -397,6 +435,33 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write a Bloom filter for each chunk of the column described by
+    /// path, sized according to options.
+    ///
+    /// Bloom filters allow readers to skip row groups when looking up values
+    /// absent from them, even when the min/max statistics cover those values.
+    /// They are not written for BOOLEAN and encrypted columns.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -415,11 +480,16 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          default_column_properties_, column_properties, data_page_version_,
+          write_page_index_));
     }
 
    private:
@@ -431,6 +501,7 @@ class PARQUET_EXPORT WriterProperties {
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -441,6 +512,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, BloomFilterOptions> bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -461,6 +534,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -508,6 +583,15 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  const BloomFilterOptions& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -529,7 +613,7 @@ class PARQUET_EXPORT WriterProperties {
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool write_page_index)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -538,6 +622,7 @@ class PARQUET_EXPORT WriterProperties {
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        write_page_index_(write_page_index),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -550,6 +635,7 @@ class PARQUET_EXPORT WriterProperties {
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool write_page_index_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
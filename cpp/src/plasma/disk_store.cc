@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/disk_store.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "arrow/io/file.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace plasma {
+
+using arrow::internal::PlatformFilename;
+
+namespace {
+
+constexpr char kDiskStorePrefix[] = "disk://";
+
+Status WriteObject(const std::string& path, const Buffer& data) {
+  ARROW_ASSIGN_OR_RAISE(auto file_name, PlatformFilename::FromString(path));
+  ARROW_ASSIGN_OR_RAISE(int fd, arrow::internal::FileOpenWritable(file_name));
+  Status st = arrow::internal::FileWrite(fd, data.data(), data.size());
+  st &= arrow::internal::FileClose(fd);
+  if (!st.ok()) {
+    ARROW_UNUSED(arrow::internal::DeleteFile(file_name));
+  }
+  return st;
+}
+
+Status ReadObject(const std::string& path, Buffer* out) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto file, arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ));
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  if (size != out->size()) {
+    return Status::IOError("Spilled object ", path, " has size ", size, ", expected ",
+                           out->size());
+  }
+  // Reads from a memory-mapped file are zero-copy
+  ARROW_ASSIGN_OR_RAISE(auto data, file->ReadAt(0, size));
+  std::memcpy(out->mutable_data(), data->data(), static_cast<size_t>(size));
+  return file->Close();
+}
+
+// Run task(i) for every object on the IO thread pool and wait for all of them
+template <typename Task>
+Status RunOnIOThreads(size_t num_objects, Task&& task) {
+  auto pool = arrow::io::internal::GetIOThreadPool();
+  std::vector<arrow::Future<>> futures;
+  futures.reserve(num_objects);
+  Status st;
+  for (size_t i = 0; i < num_objects; ++i) {
+    auto maybe_future = pool->Submit(task, i);
+    if (!maybe_future.ok()) {
+      st &= maybe_future.status();
+      break;
+    }
+    futures.push_back(maybe_future.MoveValueUnsafe());
+  }
+  for (auto& future : futures) {
+    st &= future.status();
+  }
+  return st;
+}
+
+}  // namespace
+
+DiskStore::~DiskStore() {
+  for (const auto& id : spilled_) {
+    ARROW_UNUSED(DiskStore::DeleteObjectFile(id));
+  }
+}
+
+Status DiskStore::Connect(const std::string& endpoint) {
+  const size_t prefix_length = sizeof(kDiskStorePrefix) - 1;
+  if (endpoint.compare(0, prefix_length, kDiskStorePrefix) != 0 ||
+      endpoint.size() == prefix_length) {
+    return Status::Invalid("Expected an endpoint of the form disk://{directory}, got ",
+                           endpoint);
+  }
+  directory_ = endpoint.substr(prefix_length);
+  ARROW_ASSIGN_OR_RAISE(auto dir_name, PlatformFilename::FromString(directory_));
+  RETURN_NOT_OK(arrow::internal::CreateDirTree(dir_name));
+  if (directory_.back() != '/') {
+    directory_ += '/';
+  }
+  ARROW_LOG(INFO) << "Spilling evicted objects to " << directory_;
+  return Status::OK();
+}
+
+std::string DiskStore::ObjectPath(const ObjectID& id) const {
+  return directory_ + id.hex();
+}
+
+Status DiskStore::DeleteObjectFile(const ObjectID& id) {
+  ARROW_ASSIGN_OR_RAISE(auto file_name, PlatformFilename::FromString(ObjectPath(id)));
+  return arrow::internal::DeleteFile(file_name).status();
+}
+
+Status DiskStore::Put(const std::vector<ObjectID>& ids,
+                      const std::vector<std::shared_ptr<Buffer>>& data) {
+  ARROW_CHECK(ids.size() == data.size());
+  Status st = RunOnIOThreads(ids.size(), [&](size_t i) {
+    return WriteObject(ObjectPath(ids[i]), *data[i]);
+  });
+  if (!st.ok()) {
+    // The objects stay in the Plasma store, so drop whatever was written
+    for (const auto& id : ids) {
+      ARROW_UNUSED(DeleteObjectFile(id));
+    }
+    return st;
+  }
+  spilled_.insert(ids.begin(), ids.end());
+  return Status::OK();
+}
+
+Status DiskStore::Get(const std::vector<ObjectID>& ids,
+                      std::vector<std::shared_ptr<Buffer>> buffers) {
+  ARROW_CHECK(ids.size() == buffers.size());
+  for (const auto& id : ids) {
+    if (spilled_.count(id) == 0) {
+      return Status::KeyError("Object ", id.hex(), " was not spilled to ", directory_);
+    }
+  }
+  RETURN_NOT_OK(RunOnIOThreads(ids.size(), [&](size_t i) {
+    return ReadObject(ObjectPath(ids[i]), buffers[i].get());
+  }));
+
+  // The objects are back in the Plasma store, and will be written again if
+  // they are evicted again, so failing to remove a file must not fail the
+  // restore: the store would otherwise consider objects still spilled whose
+  // files are already gone
+  for (const auto& id : ids) {
+    Status st = DeleteObjectFile(id);
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to remove spilled object " << ObjectPath(id)
+                         << ": " << st;
+    }
+    spilled_.erase(id);
+  }
+  return Status::OK();
+}
+
+REGISTER_EXTERNAL_STORE("disk", DiskStore);
+
+}  // namespace plasma
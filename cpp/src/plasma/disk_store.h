@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "plasma/external_store.h"
+
+namespace plasma {
+
+// An external store spilling evicted objects to files in a local directory.
+// The endpoint has the form disk://{directory}; the directory is created if
+// needed. Each evicted object is written to its own file, named after the hex
+// object ID, and the file is removed once the object has been restored.
+
+class DiskStore : public ExternalStore {
+ public:
+  DiskStore() = default;
+
+  ~DiskStore() override;
+
+  Status Connect(const std::string& endpoint) override;
+
+  /// The objects are written concurrently on the IO thread pool. This returns
+  /// once all the files are written, since the store frees the memory of the
+  /// objects afterwards.
+  Status Put(const std::vector<ObjectID>& ids,
+             const std::vector<std::shared_ptr<Buffer>>& data) override;
+
+  /// The spilled files are memory-mapped and copied into the buffers. Once all
+  /// are read, the files are removed; failing to remove one is only logged,
+  /// since the objects are back in memory.
+  Status Get(const std::vector<ObjectID>& ids,
+             std::vector<std::shared_ptr<Buffer>> buffers) override;
+
+ protected:
+  /// Remove the file of an object, if any
+  virtual Status DeleteObjectFile(const ObjectID& id);
+
+  std::string ObjectPath(const ObjectID& id) const;
+
+ private:
+  std::string directory_;
+  // The objects which currently have a file in the directory
+  std::unordered_set<ObjectID> spilled_;
+};
+
+}  // namespace plasma
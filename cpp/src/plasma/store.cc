@@ -160,10 +160,9 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     std::vector<ObjectID> client_objects_to_evict;
     bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
                                                            &client_objects_to_evict);
-    if (!quota_ok) {
+    if (!quota_ok || !EvictObjects(client_objects_to_evict).ok()) {
       return nullptr;
     }
-    EvictObjects(client_objects_to_evict);
   }
 
   // Try to evict objects until there is enough space.
@@ -186,10 +185,9 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, bool evict_if_full, int* fd,
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
     bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
-    EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
     // create the object.
-    if (!success) {
+    if (!EvictObjects(objects_to_evict).ok() || !success) {
       break;
     }
   }
@@ -501,8 +499,10 @@ void PlasmaStore::ProcessGetRequest(Client* client,
     std::vector<std::shared_ptr<Buffer>> buffers;
     for (size_t i = 0; i < evicted_ids.size(); ++i) {
       ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
+      // The external store holds both the data and the metadata
+      buffers.emplace_back(new arrow::MutableBuffer(
+          evicted_entries[i]->pointer,
+          evicted_entries[i]->data_size + evicted_entries[i]->metadata_size));
     }
     if (external_store_->Get(evicted_ids, buffers).ok()) {
       for (size_t i = 0; i < evicted_ids.size(); ++i) {
@@ -555,7 +555,8 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
         deletion_cache_.erase(object_id);
-        EvictObjects({object_id});
+        // If the eviction fails, the object stays in the LRU cache
+        ARROW_UNUSED(EvictObjects({object_id}));
       }
     }
     // Return 1 to indicate that the client was removed.
@@ -679,9 +680,9 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
   return PlasmaError::OK;
 }
 
-void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
+Status PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
   if (object_ids.size() == 0) {
-    return;
+    return Status::OK();
   }
 
   std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
@@ -718,13 +719,23 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
   }
 
   if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
+    Status st = external_store_->Put(object_ids, evicted_object_data);
+    if (!st.ok()) {
+      // Keep the objects in memory, and let the eviction policy choose them again
+      ARROW_LOG(WARNING) << "Failed to evict " << object_ids.size()
+                         << " objects to the external store: " << st;
+      for (const auto& object_id : object_ids) {
+        eviction_policy_.ObjectCreated(object_id, nullptr, false);
+      }
+      return st;
+    }
     for (auto entry : evicted_entries) {
       PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
       entry->pointer = nullptr;
       entry->state = ObjectState::PLASMA_EVICTED;
     }
   }
+  return Status::OK();
 }
 
 void PlasmaStore::ConnectClient(int listener_sock) {
@@ -1101,7 +1112,9 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
           eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
-      EvictObjects(objects_to_evict);
+      if (!EvictObjects(objects_to_evict).ok()) {
+        num_bytes_evicted = 0;
+      }
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaRefreshLRURequest: {
@@ -1232,7 +1245,8 @@ void ExitWithUsageError(const char* error_msg) {
 DEFINE_string(d, SHM_DEFAULT_PATH, "directory where to create the memory-backed file");
 DEFINE_string(e, "",
               "endpoint for external storage service, where objects "
-              "evicted from Plasma store can be written to, optional");
+              "evicted from Plasma store can be written to, optional. "
+              "disk://{directory} spills them to files in a local directory");
 DEFINE_bool(h, false, "whether to enable hugepage support");
 DEFINE_string(s, "",
               "socket name where the Plasma store will listen for requests, required");
@@ -117,7 +117,9 @@ class PlasmaStore {
   /// Evict objects returned by the eviction policy.
   ///
   /// \param object_ids Object IDs of the objects to be evicted.
-  void EvictObjects(const std::vector<ObjectID>& object_ids);
+  /// \return The status of putting the objects into the external store. If it
+  ///  failed, the objects are kept in memory and returned to the eviction policy.
+  Status EvictObjects(const std::vector<ObjectID>& object_ids);
 
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
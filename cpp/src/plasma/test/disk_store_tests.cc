@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+#include "plasma/common.h"
+#include "plasma/disk_store.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+using arrow::internal::TemporaryDir;
+
+// A DiskStore failing to remove the files of restored objects
+class UndeletableDiskStore : public DiskStore {
+ public:
+  bool fail_deletes = false;
+
+ protected:
+  Status DeleteObjectFile(const ObjectID& id) override {
+    if (fail_deletes) {
+      return Status::IOError("Cannot delete ", ObjectPath(id));
+    }
+    return DiskStore::DeleteObjectFile(id);
+  }
+};
+
+class TestDiskStore : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("disk-store-test-"));
+    ASSERT_OK(store_.Connect("disk://" + temp_dir_->path().ToString() + "spill"));
+    for (int i = 0; i < 3; ++i) {
+      ids_.push_back(random_object_id());
+      data_.push_back(std::make_shared<Buffer>(std::string(1000 + i, 'a' + i)));
+    }
+  }
+
+  // Restore the objects of the given indices and check their data
+  void AssertGet(const std::vector<size_t>& indices) {
+    std::vector<ObjectID> ids;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (size_t i : indices) {
+      ids.push_back(ids_[i]);
+      ASSERT_OK_AND_ASSIGN(auto buffer, arrow::AllocateBuffer(data_[i]->size()));
+      buffers.push_back(std::move(buffer));
+    }
+    ASSERT_OK(store_.Get(ids, buffers));
+    for (size_t j = 0; j < indices.size(); ++j) {
+      arrow::AssertBufferEqual(*buffers[j], *data_[indices[j]]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  UndeletableDiskStore store_;
+  std::vector<ObjectID> ids_;
+  std::vector<std::shared_ptr<Buffer>> data_;
+};
+
+TEST_F(TestDiskStore, PutGet) {
+  ASSERT_OK(store_.Put(ids_, data_));
+  AssertGet({2, 0});
+  AssertGet({1});
+
+  // Restored objects are no longer in the store
+  std::vector<std::shared_ptr<Buffer>> buffers = {data_[0]};
+  ASSERT_RAISES(KeyError, store_.Get({ids_[0]}, buffers));
+}
+
+TEST_F(TestDiskStore, FailingDeletesDontLoseObjects) {
+  ASSERT_OK(store_.Put(ids_, data_));
+  store_.fail_deletes = true;
+  AssertGet({0, 1});
+
+  // The objects can be spilled and restored again
+  store_.fail_deletes = false;
+  ASSERT_OK(store_.Put({ids_[0], ids_[1]}, {data_[0], data_[1]}));
+  AssertGet({0, 1, 2});
+}
+
+}  // namespace plasma
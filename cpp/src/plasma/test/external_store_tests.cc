@@ -49,19 +49,23 @@ void AssertObjectBufferEqual(const ObjectBuffer& object_buffer,
   arrow::AssertBufferEqual(*object_buffer.data, data);
 }
 
-class TestPlasmaStoreWithExternal : public ::testing::Test {
+// The parameter is the name of the external store
+class TestPlasmaStoreWithExternal : public ::testing::TestWithParam<std::string> {
  public:
   // TODO(pcm): At the moment, stdout of the test gets mixed up with
   // stdout of the object store. Consider changing that.
   void SetUp() override {
     ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("ext-test-"));
     store_socket_name_ = temp_dir_->path().ToString() + "store";
+    std::string endpoint = GetParam() == "disk"
+                               ? "disk://" + temp_dir_->path().ToString() + "spill"
+                               : GetParam() + "://test";
 
     std::string plasma_directory =
         external_test_executable.substr(0, external_test_executable.find_last_of('/'));
     std::string plasma_command = plasma_directory +
-                                 "/plasma-store-server -m 1024000 -e " +
-                                 "hashtable://test -s " + store_socket_name_ +
+                                 "/plasma-store-server -m 1024000 -e " + endpoint +
+                                 " -s " + store_socket_name_ +
                                  " 1> /tmp/log.stdout 2> /tmp/log.stderr & " +
                                  "echo $! > " + store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
@@ -90,10 +94,10 @@ class TestPlasmaStoreWithExternal : public ::testing::Test {
   std::string store_socket_name_;
 };
 
-TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
+TEST_P(TestPlasmaStoreWithExternal, EvictionTest) {
   std::vector<ObjectID> object_ids;
   std::string data(100 * 1024, 'x');
-  std::string metadata;
+  std::string metadata = "meta";
   for (int i = 0; i < 20; i++) {
     ObjectID object_id = random_object_id();
     object_ids.push_back(object_id);
@@ -134,6 +138,27 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+// Objects much larger in total than the store are created and read back
+TEST_P(TestPlasmaStoreWithExternal, SpillBurst) {
+  std::vector<ObjectID> object_ids;
+  std::vector<std::string> data;
+  for (int i = 0; i < 50; i++) {
+    object_ids.push_back(random_object_id());
+    data.emplace_back(200 * 1024, static_cast<char>('a' + i % 26));
+    ASSERT_OK(client_.CreateAndSeal(object_ids[i], data[i], std::to_string(i)));
+  }
+
+  for (int i = 49; i >= 0; i--) {
+    std::vector<ObjectBuffer> object_buffers;
+    ASSERT_OK(client_.Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_EQ(object_buffers.size(), 1);
+    AssertObjectBufferEqual(object_buffers[0], std::to_string(i), data[i]);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ExternalStores, TestPlasmaStoreWithExternal,
+                         ::testing::Values("hashtable", "disk"));
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
@@ -721,7 +721,9 @@ def open_csv(input_file, read_options=None, parse_options=None,
     """
     Open a streaming reader of CSV data.
 
-    Reading using this function is always single-threaded.
+    If ``read_options.use_threads`` is true, blocks of data are parsed and
+    converted ahead of the consumer on the CPU thread pool; batches are
+    still yielded in file order.
 
     Parameters
     ----------